@@ -0,0 +1,231 @@
+/******************************************************************************
+* File Name:   adc_result.c
+*
+* Description: This file contains the device independent processing of the SAR
+*              ADC conversion results: decoding of the output formats, conversion
+*              to milli volt and running statistics. It does not access the
+*              hardware, so it can be built into host tools that process captured
+*              data with the same code as the firmware.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "adc_result.h"
+#include "tcm_placement.h"
+
+/*******************************************************************************
+* Function Name: adc_result_decode
+********************************************************************************
+* Summary:
+*  Converts a raw AN0 conversion result into a 12-bit code according to the
+*  output format it was converted with.
+*
+* Parameters:
+*  uint16_t resultRaw   - Raw conversion result
+*  int32_t outputFormat - Output format of the channel (enum OutputFmt)
+*
+* Return:
+*  uint16_t - Decoded result
+*
+*******************************************************************************/
+TCM_CODE uint16_t adc_result_decode(uint16_t resultRaw, int32_t outputFormat)
+{
+    uint16_t result = resultRaw;
+
+    if (outputFormat == SIGNED_RIGHT_ALIGNED)
+    {
+        result = (resultRaw & 0xFFF);
+
+        /* The 12-bit code for a signal at VREFH/2 is 0x800.
+         * This means 0x800 is considered 0, any value below 0x800 is on considered negative,
+         * and values above 0x800 are considered positive
+         */
+        if ((result & 0x800) != 0)
+        {
+            result -= 0x800;
+        }
+        else
+        {
+            result += 0x800;
+        }
+    }
+    else if (outputFormat == LEFT_ALIGNED)
+    {
+        result = (resultRaw >> 4) & 0xFFF;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: adc_result_to_mv
+********************************************************************************
+* Summary:
+*  Converts a decoded result into milli volt using the band gap conversion
+*  result as the reference.
+*
+* Parameters:
+*  uint16_t result    - Decoded result
+*  uint16_t resultVBG - Conversion result of the band gap channel
+*
+* Return:
+*  uint32_t - Voltage in milli volt, 0 if the band gap result is 0
+*
+*******************************************************************************/
+TCM_CODE uint32_t adc_result_to_mv(uint16_t result, uint16_t resultVBG)
+{
+    if (resultVBG == 0u)
+    {
+        return 0u;
+    }
+
+    return ((uint32_t)result * BAND_GAP_MV) / (uint32_t)resultVBG;
+}
+
+/*******************************************************************************
+* Function Name: adc_stats_reset
+********************************************************************************
+* Summary:
+*  Clears the statistics.
+*
+* Parameters:
+*  adc_stats_t *stats - Statistics to be cleared
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void adc_stats_reset(adc_stats_t *stats)
+{
+    stats->count = 0u;
+    stats->min = UINT16_MAX;
+    stats->max = 0u;
+    stats->mean = 0.0;
+    stats->m2 = 0.0;
+}
+
+/*******************************************************************************
+* Function Name: adc_stats_add
+********************************************************************************
+* Summary:
+*  Adds one result to the statistics (Welford's online algorithm).
+*
+* Parameters:
+*  adc_stats_t *stats - Statistics to be updated
+*  uint16_t value     - Result to be added
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void adc_stats_add(adc_stats_t *stats, uint16_t value)
+{
+    double delta = (double)value - stats->mean;
+
+    stats->count++;
+    stats->mean += delta / (double)stats->count;
+    stats->m2 += delta * ((double)value - stats->mean);
+
+    if (value < stats->min)
+    {
+        stats->min = value;
+    }
+    if (value > stats->max)
+    {
+        stats->max = value;
+    }
+}
+
+/*******************************************************************************
+* Function Name: adc_stats_merge
+********************************************************************************
+* Summary:
+*  Combines the statistics of another part of the sequence into stats, as if
+*  all of its results had been added to stats (Chan's parallel algorithm).
+*  Parts can be merged in any order.
+*
+* Parameters:
+*  adc_stats_t *stats       - Statistics to be updated
+*  const adc_stats_t *other - Statistics to be merged in
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void adc_stats_merge(adc_stats_t *stats, const adc_stats_t *other)
+{
+    double count;
+    double delta;
+
+    if (other->count == 0u)
+    {
+        return;
+    }
+
+    count = (double)stats->count + (double)other->count;
+    delta = other->mean - stats->mean;
+
+    stats->mean += delta * ((double)other->count / count);
+    stats->m2 += other->m2 + (delta * delta * (((double)stats->count * (double)other->count) / count));
+    stats->count += other->count;
+
+    if (other->min < stats->min)
+    {
+        stats->min = other->min;
+    }
+    if (other->max > stats->max)
+    {
+        stats->max = other->max;
+    }
+}
+
+/*******************************************************************************
+* Function Name: adc_stats_variance
+********************************************************************************
+* Summary:
+*  Returns the sample variance of the results added so far.
+*
+* Parameters:
+*  const adc_stats_t *stats - Statistics
+*
+* Return:
+*  double - Variance in squared counts, 0 for fewer than two results
+*
+*******************************************************************************/
+double adc_stats_variance(const adc_stats_t *stats)
+{
+    return (stats->count > 1u) ? (stats->m2 / (double)(stats->count - 1u)) : 0.0;
+}
+/* [] END OF FILE */
@@ -0,0 +1,97 @@
+/******************************************************************************
+* File Name:   adc_result.h
+*
+* Description: This file contains the interface of the device independent
+*              processing of the SAR ADC conversion results.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ADC_RESULT_H
+#define ADC_RESULT_H
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Result output format  */
+enum OutputFmt
+{
+    UNSIGNED_RIGHT_ALIGNED,
+    SIGNED_RIGHT_ALIGNED,
+    LEFT_ALIGNED,
+    FORMAT_NUM
+};
+
+/* Internal band gap reference voltage */
+#define BAND_GAP_MV (900u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Running statistics of a sequence of results. Statistics of separate parts
+ * of a sequence can be combined with adc_stats_merge().
+ */
+typedef struct
+{
+    uint32_t count;
+    uint16_t min;
+    uint16_t max;
+    double mean;
+    double m2;      /* Sum of squared differences from the mean */
+} adc_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint16_t adc_result_decode(uint16_t resultRaw, int32_t outputFormat);
+uint32_t adc_result_to_mv(uint16_t result, uint16_t resultVBG);
+
+void adc_stats_reset(adc_stats_t *stats);
+void adc_stats_add(adc_stats_t *stats, uint16_t value);
+void adc_stats_merge(adc_stats_t *stats, const adc_stats_t *other);
+double adc_stats_variance(const adc_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* ADC_RESULT_H */
+/* [] END OF FILE */
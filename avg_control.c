@@ -0,0 +1,168 @@
+/******************************************************************************
+* File Name:   avg_control.c
+*
+* Description: This file contains the adaptive averaging controller. It
+*              estimates the noise variance of the decoded results from the
+*              differences of consecutive results, and doubles or halves the
+*              hardware average count until the noise is below the target at
+*              the highest possible result rate.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "avg_control.h"
+#include "tcm_placement.h"
+
+/*******************************************************************************
+* Function Name: avg_control_init
+********************************************************************************
+* Summary:
+*  Starts the controller with a noise target and the average count currently
+*  programmed.
+*
+* Parameters:
+*  avg_control_t *ctrl    - Controller
+*  uint32_t targetVarQ8   - Highest acceptable noise variance in codes^2, Q8
+*                           (see AVG_CONTROL_VAR_Q8())
+*  uint32_t averageCount  - Current average count
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void avg_control_init(avg_control_t *ctrl, uint32_t targetVarQ8, uint32_t averageCount)
+{
+    ctrl->targetVarQ8 = targetVarQ8;
+    ctrl->averageCount = averageCount;
+    ctrl->count = 0u;
+    ctrl->last = 0u;
+    ctrl->sumSq = 0u;
+    ctrl->lastVarQ8 = 0u;
+    ctrl->countLimit = AVG_CONTROL_COUNT_MAX;
+    ctrl->retry = 0u;
+    ctrl->raised = false;
+}
+
+/*******************************************************************************
+* Function Name: avg_control_add
+********************************************************************************
+* Summary:
+*  Adds one decoded result taken with ctrl->averageCount. After every
+*  AVG_CONTROL_WINDOW results, the noise variance is estimated as half the
+*  mean squared difference of consecutive results, which removes slow signal
+*  changes from the estimate. White noise variance falls by half when the
+*  average count doubles, so:
+*  - the average count is doubled when the variance is above the target
+*  - it is halved when the variance would stay below 2/3 of the target after
+*    halving, so that the count does not toggle between two settings
+*  When doubling the count did not reduce the variance by at least a quarter,
+*  the variance comes from the input moving rather than from noise. The
+*  count is then halved again and kept at or below that value for
+*  AVG_CONTROL_RETRY measurements, so that the controller does not average a
+*  moving input away.
+*  A new measurement starts after every change, with the results of the new
+*  setting only.
+*
+* Parameters:
+*  avg_control_t *ctrl - Controller
+*  uint16_t result     - Decoded result
+*
+* Return:
+*  bool - true if ctrl->averageCount was changed and must be programmed
+*
+*******************************************************************************/
+TCM_CODE bool avg_control_add(avg_control_t *ctrl, uint16_t result)
+{
+    int32_t diff = (int32_t)result - (int32_t)ctrl->last;
+    uint64_t limit;
+    uint32_t varQ8;
+    bool changed = false;
+
+    ctrl->last = result;
+
+    /* The first result of a measurement has no predecessor */
+    if (ctrl->count++ != 0u)
+    {
+        ctrl->sumSq += (uint64_t)((int64_t)diff * diff);
+    }
+
+    if (ctrl->count < AVG_CONTROL_WINDOW)
+    {
+        return false;
+    }
+
+    /* variance = sumSq / (2 * (count - 1)), compared in Q8 */
+    limit = (uint64_t)ctrl->targetVarQ8 * (2u * (ctrl->count - 1u));
+    varQ8 = (uint32_t)((ctrl->sumSq * 256u) / (2u * (ctrl->count - 1u)));
+
+    if ((ctrl->retry != 0u) && (--ctrl->retry == 0u))
+    {
+        ctrl->countLimit = AVG_CONTROL_COUNT_MAX;
+    }
+
+    if (ctrl->raised && (((uint64_t)varQ8 * 4u) > ((uint64_t)ctrl->lastVarQ8 * 3u)))
+    {
+        /* Doubling did not help, the input is moving */
+        ctrl->averageCount >>= 1;
+        ctrl->countLimit = ctrl->averageCount;
+        ctrl->retry = AVG_CONTROL_RETRY;
+        ctrl->raised = false;
+        changed = true;
+    }
+    else if (((ctrl->sumSq * 256u) > limit) && (ctrl->averageCount < ctrl->countLimit))
+    {
+        ctrl->averageCount <<= 1;
+        ctrl->raised = true;
+        changed = true;
+    }
+    else if (((ctrl->sumSq * 256u * 3u) < limit) && (ctrl->averageCount > AVG_CONTROL_COUNT_MIN))
+    {
+        ctrl->averageCount >>= 1;
+        ctrl->raised = false;
+        changed = true;
+    }
+    else
+    {
+        ctrl->raised = false;
+    }
+
+    ctrl->lastVarQ8 = varQ8;
+
+    ctrl->count = 0u;
+    ctrl->sumSq = 0u;
+
+    return changed;
+}
+/* [] END OF FILE */
@@ -0,0 +1,97 @@
+/******************************************************************************
+* File Name:   avg_control.h
+*
+* Description: This file contains the declarations of the adaptive averaging
+*              controller, which selects the hardware average count from the
+*              noise measured on the decoded results.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef AVG_CONTROL_H
+#define AVG_CONTROL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Range of the average count, powers of two only */
+#define AVG_CONTROL_COUNT_MIN (1u)
+#define AVG_CONTROL_COUNT_MAX (256u)
+
+/* Number of results of one noise measurement */
+#define AVG_CONTROL_WINDOW (256u)
+
+/* Measurements after which a limit set by a moving input is tried again */
+#define AVG_CONTROL_RETRY (64u)
+
+/* Conversion of a noise variance in codes^2 to Q8 */
+#define AVG_CONTROL_VAR_Q8(var) ((uint32_t)((var) * 256.0))
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Controller state */
+typedef struct
+{
+    uint32_t targetVarQ8;   /* Highest acceptable noise variance in codes^2, Q8 */
+    uint32_t averageCount;  /* Average count the results are taken with */
+    uint32_t count;         /* Results in the current measurement */
+    uint16_t last;          /* Previous result */
+    uint64_t sumSq;         /* Sum of the squared differences of consecutive results */
+    uint32_t lastVarQ8;     /* Noise variance of the last complete measurement, Q8 */
+    uint32_t countLimit;    /* Highest average count that reduced the variance */
+    uint32_t retry;         /* Measurements until countLimit is lifted */
+    bool raised;            /* The last change doubled the average count */
+} avg_control_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void avg_control_init(avg_control_t *ctrl, uint32_t targetVarQ8, uint32_t averageCount);
+bool avg_control_add(avg_control_t *ctrl, uint16_t result);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* AVG_CONTROL_H */
+/* [] END OF FILE */
@@ -0,0 +1,199 @@
+/******************************************************************************
+* File Name:   avg_plan.c
+*
+* Description: This file contains the averaging planner. It splits an averaging
+*              factor between the SAR2 hardware averaging and a software
+*              accumulator stage so that the CPU load is as low as possible at the
+*              requested output rate.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "avg_plan.h"
+#include "sar2_model.h"
+#include "tcm_placement.h"
+
+/*******************************************************************************
+* Function Name: avg_plan_load_ppm
+********************************************************************************
+* Summary:
+*  Returns the CPU load of producing outputRateHz outputs per second from
+*  swCount hardware results each.
+*
+* Parameters:
+*  const avg_plan_cost_t *cost - Costs and limits
+*  uint32_t swCount            - Hardware results per output
+*  uint32_t outputRateHz       - Outputs per second
+*
+* Return:
+*  uint32_t - CPU load in parts per million, saturated at UINT32_MAX
+*
+*******************************************************************************/
+uint32_t avg_plan_load_ppm(const avg_plan_cost_t *cost, uint32_t swCount, uint32_t outputRateHz)
+{
+    uint64_t cycles = ((uint64_t)swCount * cost->cyclesPerResult) + cost->cyclesPerOutput;
+    uint64_t load = (cycles * outputRateHz * 1000000u) / cost->cpuClockHz;
+
+    return (load > UINT32_MAX) ? UINT32_MAX : (uint32_t)load;
+}
+
+/*******************************************************************************
+* Function Name: avg_plan_select
+********************************************************************************
+* Summary:
+*  Splits factor into a SAR2 average count (a power of two up to
+*  AVG_PLAN_HW_COUNT_MAX) times a software count. The software count is
+*  rounded up, so a hardware count that does not divide factor averages more
+*  conversions than requested: 1000 is 8 * 125, or 256 * 4 = 1024
+*  conversions. The conversion rate of a split, plan->factor * outputRateHz,
+*  must not exceed cost->conversionRateHz. The CPU load grows with the number
+*  of hardware results per output, so a higher hardware count saves CPU time
+*  but may need too many conversions for the rate. Among the splits meeting
+*  the rate, the one with the lowest load is taken.
+*
+* Parameters:
+*  uint32_t factor             - Lowest number of conversions averaged per output
+*  uint32_t outputRateHz       - Outputs per second
+*  const avg_plan_cost_t *cost - Costs and limits
+*  avg_plan_t *plan            - Selected split
+*
+* Return:
+*  bool - false if no split meets the rate and the load limit, plan is then
+*         the split with the lowest load among those meeting the rate, or
+*         among all if none does
+*
+*******************************************************************************/
+bool avg_plan_select(uint32_t factor, uint32_t outputRateHz, const avg_plan_cost_t *cost, avg_plan_t *plan)
+{
+    uint32_t hwCount;
+    bool found = false;
+    bool rateMet = false;
+
+    plan->hwCount = 1u;
+    plan->hwShift = 0u;
+    plan->swCount = factor;
+    plan->factor = factor;
+    plan->resultRateHz = 0u;
+    plan->cpuLoadPpm = UINT32_MAX;
+
+    if (factor == 0u)
+    {
+        return false;
+    }
+
+    for (hwCount = 1u; hwCount <= AVG_PLAN_HW_COUNT_MAX; hwCount <<= 1)
+    {
+        uint32_t swCount = (factor / hwCount) + (((factor % hwCount) != 0u) ? 1u : 0u);
+        bool meets = (((uint64_t)hwCount * swCount * outputRateHz) <= cost->conversionRateHz);
+        uint32_t load = avg_plan_load_ppm(cost, swCount, outputRateHz);
+
+        /* A split meeting the rate beats one that does not, then the lower load wins */
+        if ((swCount <= AVG_PLAN_SW_COUNT_MAX) &&
+            (!found || (meets && !rateMet) || ((meets == rateMet) && (load < plan->cpuLoadPpm))))
+        {
+            plan->hwCount = hwCount;
+            plan->hwShift = sar2_model_right_shift(hwCount);
+            plan->swCount = swCount;
+            plan->factor = hwCount * swCount;
+            plan->resultRateHz = swCount * outputRateHz;
+            plan->cpuLoadPpm = load;
+            found = true;
+            rateMet = meets;
+        }
+
+        /* A higher hardware count only adds conversions */
+        if (swCount == 1u)
+        {
+            break;
+        }
+    }
+
+    return rateMet && (plan->cpuLoadPpm <= cost->maxLoadPpm);
+}
+
+/*******************************************************************************
+* Function Name: avg_accum_init
+********************************************************************************
+* Summary:
+*  Starts the software averaging stage with count results per output.
+*
+* Parameters:
+*  avg_accum_t *accum - Software averaging stage
+*  uint32_t count     - Results per output (1 to AVG_PLAN_SW_COUNT_MAX)
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void avg_accum_init(avg_accum_t *accum, uint32_t count)
+{
+    accum->count = count;
+    accum->n = 0u;
+    accum->sum = 0u;
+}
+
+/*******************************************************************************
+* Function Name: avg_accum_add
+********************************************************************************
+* Summary:
+*  Adds one 12-bit hardware result. Every accum->count results, the rounded
+*  mean of the results is returned in *output. The sum of up to
+*  AVG_PLAN_SW_COUNT_MAX results of 12 bits fits in 32 bits.
+*
+* Parameters:
+*  avg_accum_t *accum - Software averaging stage
+*  uint16_t result    - Decoded hardware result
+*  uint16_t *output   - Mean of the last accum->count results
+*
+* Return:
+*  bool - true if *output was written
+*
+*******************************************************************************/
+TCM_CODE bool avg_accum_add(avg_accum_t *accum, uint16_t result, uint16_t *output)
+{
+    accum->sum += result;
+
+    if (++accum->n < accum->count)
+    {
+        return false;
+    }
+
+    *output = (uint16_t)((accum->sum + (accum->count / 2u)) / accum->count);
+    accum->n = 0u;
+    accum->sum = 0u;
+
+    return true;
+}
+/* [] END OF FILE */
@@ -0,0 +1,105 @@
+/******************************************************************************
+* File Name:   avg_plan.h
+*
+* Description: This file contains the public interface of the averaging planner.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef AVG_PLAN_H
+#define AVG_PLAN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Highest average count of the SAR2 hardware, powers of two only */
+#define AVG_PLAN_HW_COUNT_MAX (256u)
+
+/* Highest number of results summed by the software stage */
+#define AVG_PLAN_SW_COUNT_MAX (65536u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Split of an averaging factor between the SAR2 and the software stage */
+typedef struct
+{
+    uint32_t hwCount;       /* SAR2 average count */
+    uint8_t hwShift;        /* SAR2 right shift, scales the hardware sum back to 12 bits */
+    uint32_t swCount;       /* Hardware results averaged by software per output */
+    uint32_t factor;        /* Conversions averaged per output, hwCount * swCount */
+    uint32_t resultRateHz;  /* SAR2 results (interrupts) per second */
+    uint32_t cpuLoadPpm;    /* Estimated CPU load in parts per million */
+} avg_plan_t;
+
+/* Costs and limits the split is planned with */
+typedef struct
+{
+    uint32_t conversionRateHz;  /* Highest number of AN0 conversions per second */
+    uint32_t cpuClockHz;        /* CPU clock */
+    uint32_t cyclesPerResult;   /* CPU cycles per SAR2 result: interrupt, read, decode and accumulation */
+    uint32_t cyclesPerOutput;   /* CPU cycles per averaged output */
+    uint32_t maxLoadPpm;        /* Highest acceptable CPU load in parts per million */
+} avg_plan_cost_t;
+
+/* Software averaging stage */
+typedef struct
+{
+    uint32_t count;     /* Results per output */
+    uint32_t n;         /* Results summed so far */
+    uint32_t sum;       /* Sum of the results */
+} avg_accum_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool avg_plan_select(uint32_t factor, uint32_t outputRateHz, const avg_plan_cost_t *cost, avg_plan_t *plan);
+uint32_t avg_plan_load_ppm(const avg_plan_cost_t *cost, uint32_t swCount, uint32_t outputRateHz);
+void avg_accum_init(avg_accum_t *accum, uint32_t count);
+bool avg_accum_add(avg_accum_t *accum, uint16_t result, uint16_t *output);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* AVG_PLAN_H */
+/* [] END OF FILE */
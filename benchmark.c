@@ -0,0 +1,414 @@
+/******************************************************************************
+* File Name:   benchmark.c
+*
+* Description: This file contains the benchmark of the result processing pipeline.
+*              Every stage (result decoding, milli volt conversion, statistics,
+*              formatting, stream encoding and framing) is run over batches of
+*              synthetic results of several sizes and timed with cycle_probe_now().
+*              The results are printed as CSV sections with a fixed set of
+*              columns each, so that they can be compared between builds.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "benchmark.h"
+
+#if (BENCHMARK_ENABLE)
+
+#include <stdio.h>
+#include <inttypes.h>
+#include "adc_result.h"
+#include "avg_plan.h"
+#include "cycle_probe.h"
+#include "signal_source.h"
+#include "sar2_model.h"
+#include "stream_codec.h"
+#include "stream_frame.h"
+#include "uart_format.h"
+#include "timebase.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest batch size */
+#define BENCHMARK_BATCH_MAX (256u)
+
+/* Number of timed runs of every stage and batch size */
+#define BENCHMARK_REPEAT (16u)
+
+/* Seed of the synthetic input */
+#define BENCHMARK_SEED (240997u)
+
+/* Outputs timed per run of an averaging split */
+#define BENCHMARK_SPLIT_OUTPUTS (4u)
+
+/* AN0 conversions per second the splits are planned for, see the burst capture */
+#define BENCHMARK_CONVERSION_RATE_HZ (1000000u)
+
+/* Pipeline stages */
+enum BenchmarkStage
+{
+    STAGE_DECODE,
+    STAGE_TO_MV,
+    STAGE_STATS,
+    STAGE_FORMAT,
+    STAGE_ENCODE,
+    STAGE_FRAME,
+    STAGE_TIMESTAMP,
+    STAGE_NUM
+};
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *STAGE_STR[STAGE_NUM] =
+{
+    "decode",
+    "to_mv",
+    "stats",
+    "format",
+    "encode",
+    "frame",
+    "timestamp"
+};
+
+static const uint32_t BATCH_SIZES[] = { 1u, 8u, 32u, 256u };
+
+/* Averaging factors of the split benchmark */
+static const uint32_t SPLIT_FACTORS[] = { 256u, 1000u, 4096u };
+
+/* Averaging factors planned with the measured cost, and their output rates */
+static const uint32_t PLAN_FACTORS[] = { 256u, 1000u, 1000u, 4096u };
+static const uint32_t PLAN_RATES_HZ[] = { 1000u, 900u, 1000u, 200u };
+
+/* Input and intermediate data of the stages */
+static uint16_t benchRaw[BENCHMARK_BATCH_MAX];
+static uint16_t benchVBG[BENCHMARK_BATCH_MAX];
+static uint16_t benchDecoded[BENCHMARK_BATCH_MAX];
+static uint32_t benchMv[BENCHMARK_BATCH_MAX];
+static char benchText[BENCHMARK_BATCH_MAX * UART_FORMAT_U32_MAX_LEN];
+static uint32_t benchStamp[BENCHMARK_BATCH_MAX];
+static uint8_t benchFrame[STREAM_FRAME_OVERHEAD + STREAM_FRAME_VARINT_MAX_SIZE + STREAM_BLOCK_MAX_SIZE];
+
+/* Keeps the compiler from removing the work being timed */
+static volatile uint32_t benchSink;
+
+/*******************************************************************************
+* Function Name: run_stage
+********************************************************************************
+* Summary:
+*  Runs one stage over the first batch entries of the input data.
+*
+*******************************************************************************/
+static void run_stage(uint32_t stage, uint32_t batch)
+{
+    adc_stats_t stats;
+    uint64_t frameTime = 0u;
+    uint32_t len = 0u;
+    uint32_t i;
+
+    switch (stage)
+    {
+        case STAGE_DECODE:
+            for (i = 0u; i < batch; i++)
+            {
+                benchDecoded[i] = adc_result_decode(benchRaw[i], SIGNED_RIGHT_ALIGNED);
+            }
+            break;
+
+        case STAGE_TO_MV:
+            for (i = 0u; i < batch; i++)
+            {
+                benchMv[i] = adc_result_to_mv(benchDecoded[i], benchVBG[i]);
+            }
+            break;
+
+        case STAGE_STATS:
+            adc_stats_reset(&stats);
+            for (i = 0u; i < batch; i++)
+            {
+                adc_stats_add(&stats, benchDecoded[i]);
+            }
+            len = stats.count;
+            break;
+
+        case STAGE_FORMAT:
+            for (i = 0u; i < batch; i++)
+            {
+                len += uart_format_u32(&benchText[len], benchMv[i]);
+            }
+            break;
+
+        case STAGE_ENCODE:
+            for (i = 0u; i < batch; i += STREAM_BLOCK_SAMPLES)
+            {
+                uint32_t count = ((batch - i) < STREAM_BLOCK_SAMPLES) ? (batch - i) : STREAM_BLOCK_SAMPLES;
+                len += stream_encode_block(&benchDecoded[i], count, &benchFrame[STREAM_FRAME_HEADER_SIZE]);
+            }
+            break;
+
+        case STAGE_FRAME:
+            for (i = 0u; i < batch; i += STREAM_BLOCK_SAMPLES)
+            {
+                uint32_t count = ((batch - i) < STREAM_BLOCK_SAMPLES) ? (batch - i) : STREAM_BLOCK_SAMPLES;
+                len += stream_frame_finish(benchFrame, STREAM_FRAME_TYPE_SAMPLES, (uint16_t)i,
+                                           (count * 2u) + STREAM_BLOCK_HEADER_SIZE);
+            }
+            break;
+
+        case STAGE_TIMESTAMP:
+            /* Time stamp of every result, extension and time delta of every block */
+            for (i = 0u; i < batch; i++)
+            {
+                benchStamp[i] = cycle_probe_now();
+            }
+            frameTime = timebase_extend(benchStamp[0]);
+            for (i = 0u; i < batch; i += STREAM_BLOCK_SAMPLES)
+            {
+                uint64_t blockTime = timebase_extend(benchStamp[i]);
+
+                len += stream_frame_pack_varint(&benchFrame[STREAM_FRAME_HEADER_SIZE], blockTime - frameTime);
+                frameTime = blockTime;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    benchSink = len;
+}
+
+/*******************************************************************************
+* Function Name: run_split
+********************************************************************************
+* Summary:
+*  Produces BENCHMARK_SPLIT_OUTPUTS outputs from swCount hardware results
+*  each: every result is decoded and added to the software averaging stage.
+*
+*******************************************************************************/
+static void run_split(uint32_t swCount)
+{
+    avg_accum_t accum;
+    uint16_t output = 0u;
+    uint32_t len = 0u;
+    uint32_t i;
+
+    avg_accum_init(&accum, swCount);
+    for (i = 0u; i < (swCount * BENCHMARK_SPLIT_OUTPUTS); i++)
+    {
+        uint16_t result = adc_result_decode(benchRaw[i % BENCHMARK_BATCH_MAX], SIGNED_RIGHT_ALIGNED);
+
+        if (avg_accum_add(&accum, result, &output))
+        {
+            len += output;
+        }
+    }
+
+    benchSink = len;
+}
+
+/*******************************************************************************
+* Function Name: benchmark_splits
+********************************************************************************
+* Summary:
+*  Times the software side of every split of the SPLIT_FACTORS between the
+*  SAR2 average count and the software averaging stage, with the software
+*  count rounded up as avg_plan_select() does, and prints the [splits]
+*  section with one line per split and the minimum time per output in
+*  ticks. The hardware averaging itself costs no CPU time, but each of its
+*  results costs an interrupt on the device, which is not included here (see
+*  PROBE_ISR in the 'p' report). The planner then selects a split for every
+*  PLAN_FACTORS at its PLAN_RATES_HZ, with the measured time per result as
+*  the cost, and the [plans] section lists them.
+*
+*******************************************************************************/
+static void benchmark_splits(uint32_t overhead)
+{
+    uint32_t perResult = UINT32_MAX;
+    avg_plan_cost_t cost;
+    uint32_t f;
+
+    printf("[splits]\r\nfactor,hw_count,sw_count,min_per_output\r\n");
+
+    for (f = 0u; f < (sizeof(SPLIT_FACTORS) / sizeof(SPLIT_FACTORS[0])); f++)
+    {
+        uint32_t factor = SPLIT_FACTORS[f];
+        uint32_t swCount = factor;
+        uint32_t hwCount;
+
+        for (hwCount = 1u; (hwCount <= AVG_PLAN_HW_COUNT_MAX) && (swCount > 1u); hwCount <<= 1)
+        {
+            uint32_t min = UINT32_MAX;
+            uint32_t r;
+
+            swCount = (factor + hwCount - 1u) / hwCount;
+
+            for (r = 0u; r < BENCHMARK_REPEAT; r++)
+            {
+                uint32_t start = cycle_probe_now();
+                uint32_t elapsed;
+
+                run_split(swCount);
+                elapsed = cycle_probe_elapsed(start);
+                elapsed = (elapsed > overhead) ? (elapsed - overhead) : 0u;
+
+                if (elapsed < min)
+                {
+                    min = elapsed;
+                }
+            }
+
+            /* The split without hardware averaging of the largest factor gives the cost of one result */
+            if (hwCount == 1u)
+            {
+                perResult = min / (swCount * BENCHMARK_SPLIT_OUTPUTS);
+            }
+
+            printf("%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "\r\n", factor, hwCount, swCount,
+                   min / BENCHMARK_SPLIT_OUTPUTS);
+        }
+    }
+
+    cost.conversionRateHz = BENCHMARK_CONVERSION_RATE_HZ;
+    cost.cpuClockHz = timebase_hz();
+    cost.cyclesPerResult = (perResult != 0u) ? perResult : 1u;
+    cost.cyclesPerOutput = 0u;
+    cost.maxLoadPpm = 1000000u;
+
+    printf("[plans]\r\nfactor,output_rate_hz,hw_count,hw_shift,sw_count,conversions,result_rate_hz,load_ppm,met\r\n");
+
+    for (f = 0u; f < (sizeof(PLAN_FACTORS) / sizeof(PLAN_FACTORS[0])); f++)
+    {
+        avg_plan_t plan;
+        bool met = avg_plan_select(PLAN_FACTORS[f], PLAN_RATES_HZ[f], &cost, &plan);
+
+        printf("%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%u,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%u\r\n",
+               PLAN_FACTORS[f], PLAN_RATES_HZ[f], plan.hwCount, (unsigned)plan.hwShift, plan.swCount, plan.factor,
+               plan.resultRateHz, plan.cpuLoadPpm, met ? 1u : 0u);
+    }
+}
+
+/*******************************************************************************
+* Function Name: benchmark_run
+********************************************************************************
+* Summary:
+*  Runs every stage over every batch size BENCHMARK_REPEAT times and prints
+*  the results as CSV sections, each a line with its name in brackets, a
+*  header line, and the records. [timer] gives the tick frequency of
+*  cycle_probe_now(), in which all times are counted, and the overhead of
+*  reading the time stamps, which is subtracted. [stages] has one line per
+*  stage and batch size with the minimum and mean time of a batch and the
+*  minimum time per result (in 1/1000 ticks). The input is a noisy sine from the
+*  synthetic signal source, so every run processes the same data. The
+*  averaging splits are timed last, see benchmark_splits().
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void benchmark_run(void)
+{
+    signal_source_t source;
+    uint32_t overhead = UINT32_MAX;
+    uint32_t stage;
+    uint32_t b;
+    uint32_t r;
+    uint32_t i;
+
+    signal_source_init(&source, SIGNAL_SINE, BENCHMARK_SEED);
+    for (i = 0u; i < BENCHMARK_BATCH_MAX; i++)
+    {
+        benchRaw[i] = signal_source_next_result(&source, 1u, 0u, SIGNED_RIGHT_ALIGNED);
+        benchVBG[i] = 1117u;
+    }
+
+    /* Cost of taking two time stamps back to back */
+    for (r = 0u; r < BENCHMARK_REPEAT; r++)
+    {
+        uint32_t start = cycle_probe_now();
+        uint32_t elapsed = cycle_probe_elapsed(start);
+
+        if (elapsed < overhead)
+        {
+            overhead = elapsed;
+        }
+    }
+
+    printf("[timer]\r\ntick_hz,overhead\r\n%" PRIu32 ",%" PRIu32 "\r\n", timebase_hz(), overhead);
+    printf("[stages]\r\nstage,batch,min,mean,min_per_result_x1000\r\n");
+
+    for (stage = 0u; stage < STAGE_NUM; stage++)
+    {
+        for (b = 0u; b < (sizeof(BATCH_SIZES) / sizeof(BATCH_SIZES[0])); b++)
+        {
+            uint32_t batch = BATCH_SIZES[b];
+            uint32_t min = UINT32_MAX;
+            uint64_t sum = 0u;
+
+            /* Later stages read the output of the earlier ones */
+            run_stage(STAGE_DECODE, batch);
+            run_stage(STAGE_TO_MV, batch);
+
+            for (r = 0u; r < BENCHMARK_REPEAT; r++)
+            {
+                uint32_t start = cycle_probe_now();
+                uint32_t elapsed;
+
+                run_stage(stage, batch);
+                elapsed = cycle_probe_elapsed(start);
+                elapsed = (elapsed > overhead) ? (elapsed - overhead) : 0u;
+
+                sum += elapsed;
+                if (elapsed < min)
+                {
+                    min = elapsed;
+                }
+            }
+
+            printf("%s,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "\r\n", STAGE_STR[stage], batch,
+                   min, (uint32_t)(sum / BENCHMARK_REPEAT),
+                   (uint32_t)(((uint64_t)min * 1000u) / batch));
+        }
+    }
+
+    benchmark_splits(overhead);
+}
+
+#endif /* BENCHMARK_ENABLE */
+/* [] END OF FILE */
@@ -0,0 +1,174 @@
+/******************************************************************************
+* File Name:   burst_capture.c
+*
+* Description: This file contains the burst capture. Results of back-to-back
+*              conversions are stored in a RAM buffer until it holds the
+*              requested number of samples; the interval between samples is
+*              tracked so that the achieved rate and any gaps can be reported.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "burst_capture.h"
+#include "cycle_probe.h"
+#include "tcm_placement.h"
+
+/*******************************************************************************
+* Function Name: burst_capture_start
+********************************************************************************
+* Summary:
+*  Empties the buffer and prepares the capture of the given number of
+*  samples, limited to BURST_CAPTURE_SIZE. Must be called before the
+*  producer is started.
+*
+* Parameters:
+*  burst_capture_t *burst - Burst capture
+*  uint32_t samples       - Number of samples to be captured
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void burst_capture_start(burst_capture_t *burst, uint32_t samples)
+{
+    burst->count = 0u;
+    burst->target = (samples < BURST_CAPTURE_SIZE) ? samples : BURST_CAPTURE_SIZE;
+    burst->lastTime = 0u;
+    burst->elapsed = 0u;
+    burst->minInterval = UINT32_MAX;
+    burst->maxInterval = 0u;
+    burst->gaps = 0u;
+    burst->done = (burst->target == 0u);
+}
+
+/*******************************************************************************
+* Function Name: burst_capture_add
+********************************************************************************
+* Summary:
+*  Stores one sample with the time stamp of its arrival. The intervals are
+*  accumulated one by one, so the total time may exceed the wrap around
+*  period of the time stamp counter. Samples are ignored once the capture
+*  is done.
+*
+* Parameters:
+*  burst_capture_t *burst - Burst capture
+*  uint16_t sample        - Conversion result
+*  uint32_t timestamp     - cycle_probe_now() at the arrival of the sample
+*
+* Return:
+*  bool - true when the buffer is full and the producer can be stopped
+*
+*******************************************************************************/
+TCM_CODE bool burst_capture_add(burst_capture_t *burst, uint16_t sample, uint32_t timestamp)
+{
+    uint32_t interval;
+
+    if (burst->done)
+    {
+        return true;
+    }
+
+    if (burst->count != 0u)
+    {
+        interval = cycle_probe_diff(timestamp, burst->lastTime);
+        burst->elapsed += interval;
+
+        if (interval < burst->minInterval)
+        {
+            burst->minInterval = interval;
+        }
+        if (interval > burst->maxInterval)
+        {
+            burst->maxInterval = interval;
+        }
+    }
+
+    burst->lastTime = timestamp;
+    burst->buf[burst->count++] = sample;
+
+    if (burst->count == burst->target)
+    {
+        burst->done = true;
+    }
+
+    return burst->done;
+}
+
+/*******************************************************************************
+* Function Name: burst_capture_gap
+********************************************************************************
+* Summary:
+*  Counts an overflow event: the producer was not serviced in time, and one
+*  or more results were lost.
+*
+* Parameters:
+*  burst_capture_t *burst - Burst capture
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+TCM_CODE void burst_capture_gap(burst_capture_t *burst)
+{
+    if (!burst->done)
+    {
+        burst->gaps++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: burst_capture_rate
+********************************************************************************
+* Summary:
+*  Returns the achieved sample rate, from the first to the last sample.
+*
+* Parameters:
+*  const burst_capture_t *burst - Burst capture
+*  uint32_t clockHz             - Frequency of the time stamp counter
+*
+* Return:
+*  uint32_t - Samples per second, 0 if fewer than 2 samples were stored
+*
+*******************************************************************************/
+uint32_t burst_capture_rate(const burst_capture_t *burst, uint32_t clockHz)
+{
+    if ((burst->count < 2u) || (burst->elapsed == 0u))
+    {
+        return 0u;
+    }
+
+    return (uint32_t)(((uint64_t)(burst->count - 1u) * clockHz) / burst->elapsed);
+}
+/* [] END OF FILE */
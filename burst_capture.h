@@ -0,0 +1,91 @@
+/******************************************************************************
+* File Name:   burst_capture.h
+*
+* Description: This file contains the declarations of the burst capture,
+*              which stores back-to-back conversion results in RAM and
+*              measures the achieved sample rate.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef BURST_CAPTURE_H
+#define BURST_CAPTURE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Capacity of the burst buffer in samples (2 bytes each) */
+#ifndef BURST_CAPTURE_SIZE
+#define BURST_CAPTURE_SIZE (16384u)
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Burst state. The timing is kept in time stamp units of cycle_probe_now() */
+typedef struct
+{
+    uint16_t buf[BURST_CAPTURE_SIZE];
+    uint32_t count;         /* Samples stored */
+    uint32_t target;        /* Samples to be stored */
+    uint32_t lastTime;      /* Time stamp of the last sample */
+    uint64_t elapsed;       /* Time from the first to the last sample */
+    uint32_t minInterval;   /* Shortest and longest time between two samples */
+    uint32_t maxInterval;
+    uint32_t gaps;          /* Group overflow events, each loses one or more results */
+    volatile bool done;
+} burst_capture_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void burst_capture_start(burst_capture_t *burst, uint32_t samples);
+bool burst_capture_add(burst_capture_t *burst, uint16_t sample, uint32_t timestamp);
+void burst_capture_gap(burst_capture_t *burst);
+uint32_t burst_capture_rate(const burst_capture_t *burst, uint32_t clockHz);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* BURST_CAPTURE_H */
+/* [] END OF FILE */
@@ -0,0 +1,270 @@
+/******************************************************************************
+* File Name:   cycle_probe.c
+*
+* Description: This file contains the cycle counter probes. Each probe zone keeps
+*              the minimum, maximum and mean duration and a log2 histogram of the
+*              durations, measured with the Cortex-M7 DWT cycle counter or
+*              optionally the SysTick timer.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+/* clock_gettime() and CLOCK_MONOTONIC are POSIX, a strict ISO C host build
+ * (-std=c11) only declares them with the feature test macro set before the
+ * first system header.
+ */
+#if !defined(__ARM_ARCH) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "cycle_probe.h"
+#include "tcm_placement.h"
+
+#if !defined(__ARM_ARCH)
+#include <time.h>
+#endif
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+const char *PROBE_ZONE_STR[PROBE_ZONE_NUM] =
+{
+    "ISR     ",
+    "Decode  ",
+    "Format  ",
+    "UART    ",
+    "Reconfig",
+    "Latency ",
+    "Jitter  "
+};
+
+static cycle_probe_zone_t probeZones[PROBE_ZONE_NUM];
+
+/*******************************************************************************
+* Function Name: log2_bin
+********************************************************************************
+* Summary:
+*  Returns the histogram bin of a duration: the number of significant bits,
+*  limited to the last bin.
+*
+*******************************************************************************/
+static inline uint32_t log2_bin(uint32_t cycles)
+{
+#if defined(__ARM_ARCH)
+    uint32_t bin = 32u - __CLZ(cycles);
+#else
+    uint32_t bin = (cycles != 0u) ? (32u - (uint32_t)__builtin_clz(cycles)) : 0u;
+#endif
+
+    return (bin < CYCLE_PROBE_HIST_BINS) ? bin : (CYCLE_PROBE_HIST_BINS - 1u);
+}
+
+/*******************************************************************************
+* Function Name: cycle_probe_init
+********************************************************************************
+* Summary:
+*  Starts the time base of the probes (the DWT cycle counter, or the SysTick
+*  timer free running over its full 24-bit range, with the interrupt that
+*  counts its wrap arounds for timebase.c) and clears the statistics of all
+*  zones.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void cycle_probe_init(void)
+{
+#if defined(__ARM_ARCH) && (CYCLE_PROBE_SYSTICK)
+    SysTick->LOAD = CYCLE_PROBE_COUNTER_MASK;
+    SysTick->VAL = 0u;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+#elif defined(__ARM_ARCH)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0u;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    cycle_probe_reset();
+}
+
+/*******************************************************************************
+* Function Name: cycle_probe_reset
+********************************************************************************
+* Summary:
+*  Clears the statistics of all zones.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void cycle_probe_reset(void)
+{
+    uint32_t zone;
+
+    for (zone = 0u; zone < PROBE_ZONE_NUM; zone++)
+    {
+        cycle_probe_reset_zone(zone);
+    }
+}
+
+/*******************************************************************************
+* Function Name: cycle_probe_reset_zone
+********************************************************************************
+* Summary:
+*  Clears the statistics of one zone. Zones are updated from interrupt
+*  context, so the zone is cleared with interrupts disabled.
+*
+* Parameters:
+*  uint32_t zone - Zone (enum ProbeZone)
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void cycle_probe_reset_zone(uint32_t zone)
+{
+    cycle_probe_zone_t *z = &probeZones[zone];
+    uint32_t bin;
+#if defined(__ARM_ARCH)
+    uint32_t interruptState = Cy_SysLib_EnterCriticalSection();
+#endif
+
+    z->count = 0u;
+    z->min = UINT32_MAX;
+    z->max = 0u;
+    z->sum = 0u;
+
+    for (bin = 0u; bin < CYCLE_PROBE_HIST_BINS; bin++)
+    {
+        z->hist[bin] = 0u;
+    }
+
+#if defined(__ARM_ARCH)
+    Cy_SysLib_ExitCriticalSection(interruptState);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: cycle_probe_record
+********************************************************************************
+* Summary:
+*  Adds one measured duration to the statistics of a zone. Usually called
+*  through CYCLE_PROBE_STOP().
+*
+* Parameters:
+*  uint32_t zone   - Zone (enum ProbeZone)
+*  uint32_t cycles - Measured duration
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+TCM_CODE void cycle_probe_record(uint32_t zone, uint32_t cycles)
+{
+    cycle_probe_zone_t *z = &probeZones[zone];
+
+    z->count++;
+    z->sum += cycles;
+
+    if (cycles < z->min)
+    {
+        z->min = cycles;
+    }
+    if (cycles > z->max)
+    {
+        z->max = cycles;
+    }
+
+    z->hist[log2_bin(cycles)]++;
+}
+
+#if !defined(__ARM_ARCH)
+/*******************************************************************************
+* Function Name: cycle_probe_host_now
+********************************************************************************
+* Summary:
+*  Returns the time stamp of a host build: the monotonic clock in nanoseconds,
+*  truncated to 32 bits like the DWT cycle counter.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t - Time stamp
+*
+*******************************************************************************/
+uint32_t cycle_probe_host_now(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec);
+}
+#endif
+
+/*******************************************************************************
+* Function Name: cycle_probe_read
+********************************************************************************
+* Summary:
+*  Copies the statistics of a zone. Zones are updated from interrupt context,
+*  so the copy is taken with interrupts disabled.
+*
+* Parameters:
+*  uint32_t zone             - Zone (enum ProbeZone)
+*  cycle_probe_zone_t *stats - Receives the statistics
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void cycle_probe_read(uint32_t zone, cycle_probe_zone_t *stats)
+{
+#if defined(__ARM_ARCH)
+    uint32_t interruptState = Cy_SysLib_EnterCriticalSection();
+#endif
+
+    *stats = probeZones[zone];
+
+#if defined(__ARM_ARCH)
+    Cy_SysLib_ExitCriticalSection(interruptState);
+#endif
+}
+/* [] END OF FILE */
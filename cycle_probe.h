@@ -0,0 +1,190 @@
+/******************************************************************************
+* File Name:   cycle_probe.h
+*
+* Description: This file contains the interface of the cycle counter probes that
+*              measure the execution time of the code zones of the result
+*              processing.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CYCLE_PROBE_H
+#define CYCLE_PROBE_H
+
+#include <stdint.h>
+
+#if defined(__ARM_ARCH)
+#include "cy_pdl.h"
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 to compile the probes in, 0 to compile them out (see Makefile) */
+#ifndef CYCLE_PROBE_ENABLE
+#define CYCLE_PROBE_ENABLE (1)
+#endif
+
+/* Set to 1 to take the time stamps from the SysTick timer instead of the DWT
+ * cycle counter, for cores or emulators (such as QEMU in -icount mode) without
+ * a DWT. SysTick is a 24-bit counter, so single durations must be shorter
+ * than 2^24 cycles.
+ */
+#ifndef CYCLE_PROBE_SYSTICK
+#define CYCLE_PROBE_SYSTICK (0)
+#endif
+
+/* Valid bits of a time stamp difference */
+#if defined(__ARM_ARCH) && (CYCLE_PROBE_SYSTICK)
+#define CYCLE_PROBE_COUNTER_MASK (0x00FFFFFFu)
+#else
+#define CYCLE_PROBE_COUNTER_MASK (0xFFFFFFFFu)
+#endif
+
+/* Number of log2 histogram bins. Bin n counts durations in [2^(n-1), 2^n),
+ * the last bin also counts all longer durations.
+ */
+#define CYCLE_PROBE_HIST_BINS (24u)
+
+/* Measured code zones */
+enum ProbeZone
+{
+    PROBE_ISR,          /* handle_SAR_ADC_IRQ() */
+    PROBE_DECODE,       /* Result decode and milli volt conversion */
+    PROBE_FORMAT,       /* Building the result lines */
+    PROBE_UART,         /* Queuing the result lines for the UART */
+    PROBE_RECONFIG,     /* configure_SAR_ADC() */
+    PROBE_IRQ_LATENCY,  /* Software trigger to entry of handle_SAR_ADC_IRQ() */
+    PROBE_IRQ_JITTER,   /* Change of the interval between handler entries */
+    PROBE_ZONE_NUM
+};
+
+#if (CYCLE_PROBE_ENABLE)
+/* Starts a measurement, declaring the variable that holds the start time */
+#define CYCLE_PROBE_START(start)        uint32_t start = cycle_probe_now()
+
+/* Ends a measurement started with CYCLE_PROBE_START() */
+#define CYCLE_PROBE_STOP(zone, start)   cycle_probe_record((zone), cycle_probe_elapsed(start))
+#else
+#define CYCLE_PROBE_START(start)
+#define CYCLE_PROBE_STOP(zone, start)
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Statistics of one zone. On the target the durations are in CPU cycles,
+ * in a host build in nanoseconds.
+ */
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t hist[CYCLE_PROBE_HIST_BINS];
+} cycle_probe_zone_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void cycle_probe_init(void);
+void cycle_probe_reset(void);
+void cycle_probe_reset_zone(uint32_t zone);
+void cycle_probe_record(uint32_t zone, uint32_t cycles);
+void cycle_probe_read(uint32_t zone, cycle_probe_zone_t *stats);
+#if !defined(__ARM_ARCH)
+uint32_t cycle_probe_host_now(void);
+#endif
+
+extern const char *PROBE_ZONE_STR[PROBE_ZONE_NUM];
+
+/*******************************************************************************
+* Function Name: cycle_probe_now
+********************************************************************************
+* Summary:
+*  Returns the current time stamp: the DWT cycle counter (or the SysTick
+*  timer) on the target, a monotonic clock in nanoseconds in a host build.
+*  Only differences of time stamps taken with cycle_probe_diff() are
+*  meaningful.
+*
+*******************************************************************************/
+static inline uint32_t cycle_probe_now(void)
+{
+#if defined(__ARM_ARCH) && (CYCLE_PROBE_SYSTICK)
+    /* SysTick counts down, invert it to get a rising time stamp */
+    return ~SysTick->VAL;
+#elif defined(__ARM_ARCH)
+    return DWT->CYCCNT;
+#else
+    return cycle_probe_host_now();
+#endif
+}
+
+/*******************************************************************************
+* Function Name: cycle_probe_diff
+********************************************************************************
+* Summary:
+*  Returns the time from time stamp start to time stamp end, taking the
+*  wrap around of the counter into account.
+*
+*******************************************************************************/
+static inline uint32_t cycle_probe_diff(uint32_t end, uint32_t start)
+{
+    return (end - start) & CYCLE_PROBE_COUNTER_MASK;
+}
+
+/*******************************************************************************
+* Function Name: cycle_probe_elapsed
+********************************************************************************
+* Summary:
+*  Returns the time elapsed since time stamp start.
+*
+*******************************************************************************/
+static inline uint32_t cycle_probe_elapsed(uint32_t start)
+{
+    return cycle_probe_diff(cycle_probe_now(), start);
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CYCLE_PROBE_H */
+/* [] END OF FILE */
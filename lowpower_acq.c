@@ -0,0 +1,269 @@
+/******************************************************************************
+* File Name:   lowpower_acq.c
+*
+* Description: This file contains the low-power block acquisition: the block buffers
+*              filled by the interrupt handler, the selection of the CPU clock divider
+*              for a sample rate, and the estimate of the CPU time and the average
+*              current of the acquisition with CPU sleep and wake-up.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "lowpower_acq.h"
+#include "sample_ring.h"
+#include "tcm_placement.h"
+#include <stddef.h>
+
+/*******************************************************************************
+* Function Name: cycles_to_ns
+********************************************************************************
+* Summary:
+*  Converts CPU cycles at clockHz into nanoseconds, rounded up.
+*
+*******************************************************************************/
+static uint64_t cycles_to_ns(uint32_t cycles, uint32_t clockHz)
+{
+    return (((uint64_t)cycles * 1000000000u) + clockHz - 1u) / clockHz;
+}
+
+/*******************************************************************************
+* Function Name: busy_ns
+********************************************************************************
+* Summary:
+*  Returns the time the CPU runs per second of acquisition at rateHz and
+*  clockHz: the wake-up from sleep and the interrupt handler of every
+*  result, and the processing of every block.
+*
+*******************************************************************************/
+static uint64_t busy_ns(const lowpower_cost_t *cost, uint32_t rateHz, uint32_t clockHz)
+{
+    uint64_t sampleNs = cost->wakeupNs + cycles_to_ns(cost->sampleCycles, clockHz);
+    uint64_t blockNs = cycles_to_ns(cost->blockCycles, clockHz);
+
+    return (rateHz * sampleNs) + ((rateHz * blockNs) / LOWPOWER_BLOCK_SAMPLES);
+}
+
+/*******************************************************************************
+* Function Name: lowpower_acq_reset
+********************************************************************************
+* Summary:
+*  Empties the block buffers. Must not be called while the interrupt handler
+*  adds results.
+*
+* Parameters:
+*  lowpower_acq_t *acq - Block buffers
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void lowpower_acq_reset(lowpower_acq_t *acq)
+{
+    acq->count = 0u;
+    acq->head = 0u;
+    acq->tail = 0u;
+    acq->overruns = 0u;
+    acq->late = 0u;
+}
+
+/*******************************************************************************
+* Function Name: lowpower_acq_add
+********************************************************************************
+* Summary:
+*  Adds one result to the block being filled. Called by the interrupt
+*  handler only. When every block is full, the result is dropped and counted
+*  as an overrun.
+*
+* Parameters:
+*  lowpower_acq_t *acq - Block buffers
+*  uint16_t result     - Result
+*
+* Return:
+*  bool - true if the result completed a block, the main loop must then be
+*         woken to process it
+*
+*******************************************************************************/
+TCM_CODE bool lowpower_acq_add(lowpower_acq_t *acq, uint16_t result)
+{
+    uint32_t head = acq->head;
+
+    if ((head - acq->tail) >= LOWPOWER_BLOCK_NUM)
+    {
+        acq->overruns++;
+        return false;
+    }
+
+    acq->blocks[head % LOWPOWER_BLOCK_NUM][acq->count] = result;
+
+    if (++acq->count < LOWPOWER_BLOCK_SAMPLES)
+    {
+        return false;
+    }
+
+    /* The block must be complete before the main loop can see it */
+    acq->count = 0u;
+    SAMPLE_RING_BARRIER();
+    acq->head = head + 1u;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: lowpower_acq_block
+********************************************************************************
+* Summary:
+*  Returns the oldest complete block. It stays valid until
+*  lowpower_acq_release() is called.
+*
+* Parameters:
+*  lowpower_acq_t *acq - Block buffers
+*
+* Return:
+*  const uint16_t * - LOWPOWER_BLOCK_SAMPLES results, NULL if no block is
+*                     complete
+*
+*******************************************************************************/
+const uint16_t *lowpower_acq_block(lowpower_acq_t *acq)
+{
+    uint32_t tail = acq->tail;
+
+    if (acq->head == tail)
+    {
+        return NULL;
+    }
+
+    SAMPLE_RING_BARRIER();
+    return acq->blocks[tail % LOWPOWER_BLOCK_NUM];
+}
+
+/*******************************************************************************
+* Function Name: lowpower_acq_release
+********************************************************************************
+* Summary:
+*  Hands the block returned by lowpower_acq_block() back to the interrupt
+*  handler.
+*
+* Parameters:
+*  lowpower_acq_t *acq - Block buffers
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void lowpower_acq_release(lowpower_acq_t *acq)
+{
+    /* The block must have been read before the handler can refill it */
+    SAMPLE_RING_BARRIER();
+    acq->tail = acq->tail + 1u;
+}
+
+/*******************************************************************************
+* Function Name: lowpower_select_divider
+********************************************************************************
+* Summary:
+*  Returns the highest CPU clock divider (1 to LOWPOWER_DIVIDER_MAX, powers
+*  of two) at which the acquisition at rateHz keeps the CPU busy for no more
+*  than LOWPOWER_LOAD_MAX_PCT percent of the time. The busy time of a result
+*  includes the wake-up from sleep. A lower clock lowers the current in both
+*  the running and the sleeping state.
+*
+* Parameters:
+*  const lowpower_cost_t *cost - Costs and currents
+*  uint32_t rateHz             - Results per second
+*
+* Return:
+*  uint32_t - Clock divider, 0 if even the undivided clock is too slow
+*
+*******************************************************************************/
+uint32_t lowpower_select_divider(const lowpower_cost_t *cost, uint32_t rateHz)
+{
+    uint32_t divider;
+
+    for (divider = LOWPOWER_DIVIDER_MAX; divider != 0u; divider >>= 1)
+    {
+        uint64_t busyNs = busy_ns(cost, rateHz, cost->cpuClockHz / divider);
+
+        if ((busyNs * 100u) <= (1000000000ull * LOWPOWER_LOAD_MAX_PCT))
+        {
+            return divider;
+        }
+    }
+
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: lowpower_estimate
+********************************************************************************
+* Summary:
+*  Estimates the share of the time the CPU runs and the average current of
+*  the acquisition at rateHz with the CPU clock divided by divider, from the
+*  same busy time as lowpower_select_divider(). The average current is the
+*  time-weighted current of the running and sleeping CPU plus the SAR ADC
+*  during the conversions. A busy time beyond the sample period is limited
+*  to the whole time; the acquisition then loses results, which the
+*  estimate does not show.
+*
+* Parameters:
+*  const lowpower_cost_t *cost    - Costs and currents
+*  uint32_t rateHz                - Results per second
+*  uint32_t divider               - CPU clock divider
+*  lowpower_estimate_t *estimate  - Estimated CPU time and current
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void lowpower_estimate(const lowpower_cost_t *cost, uint32_t rateHz, uint32_t divider,
+                       lowpower_estimate_t *estimate)
+{
+    uint32_t clockHz = cost->cpuClockHz / divider;
+    uint64_t activeNs = busy_ns(cost, rateHz, clockHz);
+    uint64_t charge;
+
+    if (activeNs > 1000000000u)
+    {
+        activeNs = 1000000000u;
+    }
+
+    /* Charge per second in uA * ns */
+    charge = (activeNs * (cost->staticUa + (((uint64_t)cost->activeUaPerMhz * clockHz) / 1000000u))) +
+             ((1000000000u - activeNs) * (cost->staticUa + (((uint64_t)cost->sleepUaPerMhz * clockHz) / 1000000u))) +
+             ((uint64_t)rateHz * cost->conversionNs * cost->sarUa);
+
+    estimate->activePpm = (uint32_t)(activeNs / 1000u);
+    estimate->averageUa = (uint32_t)(charge / 1000000000u);
+}
+/* [] END OF FILE */
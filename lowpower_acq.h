@@ -0,0 +1,122 @@
+/******************************************************************************
+* File Name:   lowpower_acq.h
+*
+* Description: This file contains the public interface of the low-power block
+*              acquisition.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef LOWPOWER_ACQ_H
+#define LOWPOWER_ACQ_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Results per block, the CPU processes one block at a time */
+#define LOWPOWER_BLOCK_SAMPLES (256u)
+
+/* Number of blocks, one is filled while the other is processed */
+#define LOWPOWER_BLOCK_NUM (2u)
+
+/* Highest CPU clock divider, the dividers are powers of two */
+#define LOWPOWER_DIVIDER_MAX (8u)
+
+/* Share of the CPU time the acquisition may use at the selected clock, in percent */
+#define LOWPOWER_LOAD_MAX_PCT (50u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Block buffers, filled by the interrupt handler and processed by the main loop.
+ * head counts the blocks completed, tail the blocks released.
+ */
+typedef struct
+{
+    uint16_t blocks[LOWPOWER_BLOCK_NUM][LOWPOWER_BLOCK_SAMPLES];
+    uint32_t count;                 /* Results in the block being filled */
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile uint32_t overruns;     /* Results dropped, every block was full */
+    volatile uint32_t late;         /* Sample periods that ended while the handler of the previous one was running */
+} lowpower_acq_t;
+
+/* Costs and currents of the acquisition. The currents are those of the whole
+ * device in the given state; take them from the datasheet of the device.
+ */
+typedef struct
+{
+    uint32_t cpuClockHz;        /* Undivided CPU clock */
+    uint32_t sampleCycles;      /* CPU cycles per result: interrupt, read, store, trigger */
+    uint32_t blockCycles;       /* CPU cycles per block: processing and output */
+    uint32_t wakeupNs;          /* Time from the interrupt to the handler when sleeping */
+    uint32_t conversionNs;      /* Conversion time of the group */
+    uint32_t staticUa;          /* Current independent of the CPU clock */
+    uint32_t activeUaPerMhz;    /* Additional current of the running CPU per MHz */
+    uint32_t sleepUaPerMhz;     /* Additional current of the sleeping CPU per MHz, clocks running */
+    uint32_t sarUa;             /* Additional current of the SAR ADC while converting */
+} lowpower_cost_t;
+
+/* Estimated CPU time and current of the acquisition */
+typedef struct
+{
+    uint32_t activePpm;     /* Share of the time the CPU is running, in parts per million */
+    uint32_t averageUa;     /* Average current */
+} lowpower_estimate_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void lowpower_acq_reset(lowpower_acq_t *acq);
+bool lowpower_acq_add(lowpower_acq_t *acq, uint16_t result);
+const uint16_t *lowpower_acq_block(lowpower_acq_t *acq);
+void lowpower_acq_release(lowpower_acq_t *acq);
+uint32_t lowpower_select_divider(const lowpower_cost_t *cost, uint32_t rateHz);
+void lowpower_estimate(const lowpower_cost_t *cost, uint32_t rateHz, uint32_t divider,
+                       lowpower_estimate_t *estimate);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LOWPOWER_ACQ_H */
+/* [] END OF FILE */
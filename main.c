@@ -42,28 +42,119 @@
 #include "cy_pdl.h"
 #include "cybsp.h"
 #include "cy_retarget_io.h"
+#include "adc_result.h"
+#include "uart_format.h"
+#include "sample_ring.h"
+#include "stream_codec.h"
+#include "stream_frame.h"
+#include "tx_queue.h"
+#include "timebase.h"
+#include "replay.h"
+#include "sar2_model.h"
+#include "signal_source.h"
+#include "trigger_capture.h"
+#include "burst_capture.h"
+#include "avg_control.h"
+#include "avg_plan.h"
+#include "range_monitor.h"
+#include "lowpower_acq.h"
+#include "cycle_probe.h"
+#include "benchmark.h"
+#include "tcm_placement.h"
 #include <inttypes.h>
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
-/* Result output format  */
-enum OutputFmt
+/* Result output mode */
+enum OutputMode
 {
-    UNSIGNED_RIGHT_ALIGNED,
-    SIGNED_RIGHT_ALIGNED,
-    LEFT_ALIGNED,
-    FORMAT_NUM
+    OUTPUT_DISPLAY,
+    OUTPUT_STREAM,
+    OUTPUT_EVENTS,
+    OUTPUT_BLOCKS
 };
 
 /* Lower level of average count  */
 #define AVERAGE_COUNT_MIN (1u)
 
-/* Upper level of average count  */
-#define AVERAGE_COUNT_MAX (256u)
+/* Upper level of average count, above SAR2_MODEL_AVERAGE_MAX with the software averaging stage */
+#define AVERAGE_COUNT_MAX (4096u)
 
-/* Internal band gap reference voltage */
-#define BAND_GAP_MV (900u)
+/* AN0 conversions per second the average count is split for: the SAR clock of the kit,
+ * 100 MHz / 26, over the 120 + 16 cycles of a conversion, see the ADC configuration in
+ * design.modus. The band gap conversion of every group comes on top of it */
+#define AVERAGE_CONVERSION_RATE_HZ ((100000000u / 26u) / (120u + 16u))
+
+/* Output rate the average count is split for, AVERAGE_COUNT_MAX conversions per output still fit at it */
+#define AVERAGE_OUTPUT_RATE_HZ (5u)
+
+/* Number of results produced by one run of a synthetic signal source */
+#define SIGNAL_RUN_RESULTS (4096u)
+
+/* Seed of the synthetic signal sources, a run is repeatable for a given seed */
+#define SIGNAL_SOURCE_SEED (240997u)
+
+/* Samples kept before and collected after the trigger of a capture */
+#define TRIGGER_PRE_SAMPLES (128u)
+#define TRIGGER_POST_SAMPLES (255u)
+
+/* Number of predefined trigger settings */
+#define TRIGGER_CONFIG_NUM (4u)
+
+/* Number of samples of a burst capture */
+#define BURST_SAMPLES (BURST_CAPTURE_SIZE)
+
+/* Time a burst capture may take before it is given up, in ms. The SAR ADC
+ * needs a small fraction of it even at the slowest sample time */
+#define BURST_TIMEOUT_MS (2000u)
+
+/* Noise variance the automatic average count selection aims for, 0.25 codes^2 (0.5 LSB RMS) */
+#define AVG_CONTROL_TARGET_VAR_Q8 (AVG_CONTROL_VAR_Q8(0.25))
+
+/* Number of low-power sample rates */
+#define LOWPOWER_RATE_NUM (4u)
+
+/* CLK_HF path clocking the CM7 cores, divided down in low-power mode */
+#define LOWPOWER_CLK_HF (1u)
+
+/* Size of the buffer holding the result lines of one conversion */
+#define RESULT_LINES_BUF_SIZE (160u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* SAR2 unit doing the conversions: its instance, ePASS, and configuration, the
+ * channels of the conversion group with their configurations, and the group-done
+ * interrupt. All accesses to the unit go through this descriptor, so another unit
+ * of the ePASS converts in parallel with its own descriptor, interrupt handler,
+ * and sample ring.
+ */
+typedef struct
+{
+    PASS_SAR_Type *base;
+    PASS_EPASS_MMIO_Type *epass;                /* ePASS of the unit, holds the reference buffer */
+    const cy_stc_sar2_config_t *config;
+    uint32_t vbgChannel;                        /* Band gap, first channel of the group, software triggered */
+    uint32_t an0Channel;                        /* AN0, last channel of the group, signals group-done */
+    cy_stc_sar2_channel_config_t *vbgConfig;    /* Channel configurations applied by Cy_SAR2_Init() */
+    cy_stc_sar2_channel_config_t *an0Config;
+    const cy_stc_sysint_t *irqCfg;
+    IRQn_Type irqn;                             /* CPU interrupt the SAR interrupt is routed to */
+} sar_unit_t;
+
+/* Results lost or not shown along the acquisition chain, see print_loss_report() */
+typedef struct
+{
+    uint32_t results;           /* Group-done events serviced */
+    uint32_t invalidResults;    /* Results read without the valid flag, not processed */
+    uint32_t resultOverflows;   /* Channel results overwritten before they were read */
+    uint32_t groupOverruns;     /* Group overflow events, each loses one or more results */
+    uint32_t ringDrops;         /* Results not queued for the stream, the sample ring was full */
+    uint32_t streamGaps;        /* Runs of consecutive ring drops, i.e. places where the stream skips results */
+    uint32_t displaySkips;      /* Result displays skipped while the previous lines were being sent */
+    uint32_t txDrops;           /* Lines not queued, the transmit queue was full */
+} loss_counters_t;
 
 /*******************************************************************************
 * Global Variables
@@ -75,11 +166,172 @@ const cy_stc_sysint_t IRQ_CFG =
     .intrPriority = 2UL
 };
 
+/* SAR2 unit converting the band gap and AN0, see the ADC configuration in design.modus */
+const sar_unit_t SAR_UNIT =
+{
+    .base = PASS0_SAR0,
+    .epass = PASS0_EPASS_MMIO,
+    .config = &CE_SAR2_config,
+    .vbgChannel = CE_SAR2_VBG_IDX,
+    .an0Channel = CE_SAR2_AN0_IDX,
+    .vbgConfig = &CE_SAR2_VBG_config,
+    .an0Config = &CE_SAR2_AN0_config,
+    .irqCfg = &IRQ_CFG,
+    .irqn = NvicMux3_IRQn
+};
+
 int32_t g_nextOutputFormat = UNSIGNED_RIGHT_ALIGNED;
 int32_t g_nextAverageCount = 1;
 int32_t g_outputFormat = -1;
 int32_t g_averageCount = -1;
 
+/* Result output mode, written by the main loop and read by the interrupt handler */
+volatile int32_t g_outputMode = OUTPUT_DISPLAY;
+
+/* Set while a software triggered conversion has not been serviced yet */
+volatile bool g_conversionPending = false;
+
+/* Set while another source feeds the processing, the interrupt handler then stops re-triggering */
+volatile bool g_conversionsPaused = false;
+
+/* Loss accounting, written by the interrupt handlers and reset by the main loop */
+volatile loss_counters_t g_loss;
+
+/* Set while the results are not being queued for the stream, cleared when the stream restarts */
+bool g_ringDropping = false;
+
+#if (CYCLE_PROBE_ENABLE)
+/* Time stamp of the last software trigger */
+uint32_t g_triggerTime = 0u;
+
+/* Entry time of the last interrupt handler call and the interval before it */
+uint32_t g_lastIsrEntry = 0u;
+uint32_t g_lastIsrInterval = 0u;
+
+/* Number of consecutive handler calls with valid entry time and interval (0 to 2) */
+uint32_t g_isrTimingHistory = 0u;
+#endif
+
+/* Capture of REPLAY_CORPUS replayed next */
+uint32_t g_replayIndex = 0u;
+
+/* Signal shape of the synthetic AN0 source run next */
+int32_t g_signalType = SIGNAL_DC_NOISE;
+
+/* Pre/post-trigger capture of the decoded AN0 results */
+TCM_DATA trigger_capture_t g_triggerCapture;
+
+/* Trigger of TRIGGER_CONFIG armed next */
+uint32_t g_triggerIndex = 0u;
+
+/* Results of the last burst capture */
+burst_capture_t g_burstCapture;
+
+/* Set while the average count follows the measured noise, written by the main loop */
+volatile bool g_autoAveraging = false;
+
+/* Noise driven average count selection, updated by the interrupt handler */
+avg_control_t g_avgControl;
+
+/* Costs the split of the average count is planned with. The cycle counts are rough values
+ * for the interrupt handler and the processing of one output; cpuClockHz is set at startup.
+ */
+avg_plan_cost_t g_avgPlanCost =
+{
+    .conversionRateHz = AVERAGE_CONVERSION_RATE_HZ,
+    .cpuClockHz = 0u,
+    .cyclesPerResult = 400u,
+    .cyclesPerOutput = 2000u,
+    .maxLoadPpm = 500000u
+};
+
+/* Split of g_averageCount between the SAR2 and the software stage, and the software stage */
+avg_plan_t g_avgPlan;
+TCM_DATA avg_accum_t g_avgAccum;
+
+/* Window of the AN0 results in range event mode */
+const range_window_t RANGE_WINDOW_AN0 =
+{
+    .lo = 0x400u,
+    .hi = 0xC00u,
+    .hysteresis = 0x40u
+};
+
+/* State of AN0 relative to RANGE_WINDOW_AN0 */
+range_monitor_t g_rangeMonitor;
+
+/* AN0 interrupt mask and range detection of the ADC configuration, restored when leaving range event mode */
+cy_stc_sar2_channel_config_t g_an0SavedConfig;
+
+/* Sample rates of the low-power mode, selected in turn with the 'z' key */
+const uint32_t LOWPOWER_RATES_HZ[LOWPOWER_RATE_NUM] = { 100u, 1000u, 10000u, 100000u };
+
+/* CLK_HF dividers for the dividers 1, 2, 4, and 8 of lowpower_select_divider() */
+const cy_en_clkhf_dividers_t LOWPOWER_CLK_DIVIDERS[] =
+{
+    CY_SYSCLK_CLKHF_NO_DIVIDE,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_2,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_4,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_8
+};
+
+/* Costs and currents the CPU clock and the current estimate of the low-power mode are based on.
+ * The cycle counts are rough values for this application; the currents are placeholders to be
+ * replaced by the datasheet values of the device. cpuClockHz is set at startup.
+ */
+lowpower_cost_t g_lowpowerCost =
+{
+    .cpuClockHz = 0u,
+    .sampleCycles = 400u,
+    .blockCycles = 40000u,
+    .wakeupNs = 1000u,
+    .conversionNs = 2000u,
+    .staticUa = 20000u,
+    .activeUaPerMhz = 150u,
+    .sleepUaPerMhz = 50u,
+    .sarUa = 3000u
+};
+
+/* Sample rate of LOWPOWER_RATES_HZ in use */
+uint32_t g_lowpowerRateIndex = 0u;
+
+/* Blocks of AN0 results, filled by the SysTick handler in low-power mode */
+TCM_DATA lowpower_acq_t g_lowpowerAcq;
+
+/* Number of blocks processed since low-power mode was entered */
+uint32_t g_lowpowerBlocks = 0u;
+
+/* Results waiting to be encoded into the output stream. Held in normal SRAM even
+ * with TCM_PLACEMENT, so that it stays usable between cores (see sample_ring.h) */
+CY_ALIGN(SAMPLE_RING_CACHE_LINE) sample_ring_t g_sampleRing;
+
+/* Bytes waiting for the UART, written by the producers and drained by the main loop */
+TCM_DATA tx_queue_t g_txQueue;
+
+/* Block of samples being collected for the stream encoder */
+uint16_t g_streamBlock[STREAM_BLOCK_SAMPLES];
+uint32_t g_streamBlockCount = 0u;
+
+/* Sequence number of the next stream frame */
+uint16_t g_streamSequence = 0u;
+
+/* 64-bit time of the first sample of the current block, and of the last block sent or announced */
+uint64_t g_streamBlockTime = 0u;
+uint64_t g_streamFrameTime = 0u;
+
+/* Settings announced by the last configuration frame */
+int32_t g_streamOutputFormat = -1;
+int32_t g_streamAverageCount = -1;
+
+/* Trigger settings selected in turn with the 't' key, levels in 12-bit codes */
+const trigger_config_t TRIGGER_CONFIG[TRIGGER_CONFIG_NUM] =
+{
+    { .type = TRIGGER_LEVEL,        .level = 0xC00u, .high = 0u,     .preSamples = TRIGGER_PRE_SAMPLES, .postSamples = TRIGGER_POST_SAMPLES },
+    { .type = TRIGGER_RISING_EDGE,  .level = 0x800u, .high = 0u,     .preSamples = TRIGGER_PRE_SAMPLES, .postSamples = TRIGGER_POST_SAMPLES },
+    { .type = TRIGGER_FALLING_EDGE, .level = 0x800u, .high = 0u,     .preSamples = TRIGGER_PRE_SAMPLES, .postSamples = TRIGGER_POST_SAMPLES },
+    { .type = TRIGGER_WINDOW,       .level = 0x400u, .high = 0xC00u, .preSamples = TRIGGER_PRE_SAMPLES, .postSamples = TRIGGER_POST_SAMPLES }
+};
+
 const char *OUTPUT_FORMAT_STR[FORMAT_NUM] =
 {
     "Unsigned/Right Aligned",
@@ -90,8 +342,42 @@ const char *OUTPUT_FORMAT_STR[FORMAT_NUM] =
 /*******************************************************************************
 * Function Prototypes
 *******************************************************************************/
+void handle_command(uint8_t uartReadValue);
 void handle_SAR_ADC_IRQ(void);
+void record_irq_timing(uint32_t isrEntry);
+void process_conversion(uint16_t resultVBG, uint16_t resultAN0_raw);
+void replay_capture(const replay_capture_t *capture, bool realTime);
+void generate_signal(int32_t signalType);
+void pause_conversions(void);
+void resume_conversions(void);
 void configure_SAR_ADC(int32_t outputFormat, int32_t averageCount);
+void plan_averaging(int32_t averageCount);
+bool average_result(uint16_t resultAN0_raw, uint16_t *averageAN0_raw);
+void configure_AN0_channel(const sar_unit_t *unit, int32_t outputFormat, int32_t averageCount);
+void init_SAR_unit(const sar_unit_t *unit, cy_israddress handler, bool continuous);
+void run_burst(void);
+void handle_burst_IRQ(void);
+void start_range_events(void);
+void stop_range_events(void);
+void init_range_detection(void);
+void configure_AN0_range(const sar_unit_t *unit, const range_detect_t *detect);
+void handle_range_IRQ(void);
+void output_range_event(uint16_t resultAN0);
+void start_lowpower(void);
+void stop_lowpower(void);
+void set_cpu_clock_divider(uint32_t divider);
+void lowpower_output(void);
+void output_result(uint16_t resultAN0_raw, uint32_t voltageMv);
+void stream_output(bool flush);
+void stream_send_block(void);
+void stream_send_config(const adc_sample_t *sample);
+void uart_tx_service(void);
+void uart_tx_write(const void *data, uint32_t size);
+void uart_tx_flush(void);
+void print_probe_report(void);
+void print_loss_report(void);
+void arm_trigger(const trigger_config_t *config);
+void export_capture(void);
 
 /*******************************************************************************
 * Function Name: main
@@ -123,6 +409,13 @@ int main(void)
         CY_ASSERT(0);
     }
 
+    /* Start the cycle counter used by the probes */
+    cycle_probe_init();
+
+    /* The low-power mode divides this clock, the averaging is planned with it */
+    g_lowpowerCost.cpuClockHz = SystemCoreClock;
+    g_avgPlanCost.cpuClockHz = SystemCoreClock;
+
     /* Enable global interrupts */
     __enable_irq();
 
@@ -142,44 +435,263 @@ int main(void)
 
     printf("****************** Code Example: SAR ADC Various Processing of Conversion Result ******************\r\n");
     printf("Press 'a' key to decrease the average count:\r\n"
-           "    [256 -> 128 -> 64 -> 32 -> 16 -> 8 -> 4 -> 2 -> 1]\r\n"
+           "    [4096 -> 2048 -> ... -> 256 -> 128 -> 64 -> 32 -> 16 -> 8 -> 4 -> 2 -> 1]\r\n"
            "Press 'd' key to increase the average count:\r\n"
-           "    [1 -> 2 -> 4 -> 8 -> 16 -> 32 -> 64 -> 128 -> 256]\r\n"
+           "    [1 -> 2 -> 4 -> 8 -> 16 -> 32 -> 64 -> 128 -> 256 -> ... -> 2048 -> 4096]\r\n"
+           "    (above 256, the SAR2 averages 256 conversions and the CPU averages the results)\r\n"
            "Press 's' key to change the output format:\r\n"
-           "    [(Unsigned/Right Aligned) -> (Signed/Right Aligned) -> (Left Aligned) -> (Unsigned/Right Aligned)...]\r\n\n");
+           "    [(Unsigned/Right Aligned) -> (Signed/Right Aligned) -> (Left Aligned) -> (Unsigned/Right Aligned)...]\r\n"
+           "Press 'm' key to toggle between this display and the compressed sample stream\r\n"
+           "Press 'r' key to replay the next built-in capture at full speed, 'R' key at its original timing:\r\n"
+           "    [ramp -> sine -> noise -> ramp...]\r\n"
+           "Press 'g' key to process the next synthetic signal instead of AN0:\r\n"
+           "    [DC + noise -> ramp -> sine -> chirp -> step + glitch -> band gap -> DC + noise...]\r\n"
+           "Press 'p' key to print and restart the execution time measurements\r\n"
+           "Press 't' key to arm the next trigger of the pre/post-trigger capture:\r\n"
+           "    [level -> rising edge -> falling edge -> window -> level...]\r\n"
+           "Press 'f' key to capture a burst of back-to-back conversions without averaging\r\n"
+           "Press 'n' key to toggle the average count selection from the measured noise\r\n"
+           "Press 'w' key to toggle between this display and the AN0 window events\r\n"
+           "Press 'l' key to print and restart the loss counters\r\n"
+           "Press 'z' key to enter the low-power block acquisition and select its next sample rate:\r\n"
+           "    [100 Hz -> 1 kHz -> 10 kHz -> 100 kHz -> this display]\r\n");
+#if (BENCHMARK_ENABLE)
+    printf("Press 'b' key to run the processing pipeline benchmark\r\n");
+#endif
+    printf("\r\n");
 
     /* \x1b[?25l - ESC sequence for clear cursor (not a pure VT100 escape sequence, but it works in TeraTerm) */
     printf("\x1b[?25l");
 
+    /* The result lines bypass stdio, so drain it before the first conversion */
+    fflush(stdout);
+
+    tx_queue_reset(&g_txQueue);
+
     /* Configure SAR-ADC */
     configure_SAR_ADC(g_nextOutputFormat, g_nextAverageCount);
 
     for (;;)
     {
-        uint8_t uartReadValue;
+        /* Keep the 64-bit time base running, it must be read once per counter period */
+        (void)timebase_now();
 
-        /* Check if any of valid keys was pressed */
-        uartReadValue = Cy_SCB_UART_Get(UART_HW);
-        if ((uartReadValue == 'a') || (uartReadValue == 'd'))
+        /* Processing: encode the results collected by the interrupt handler into stream frames */
+        if (g_outputMode == OUTPUT_STREAM)
         {
-            /* Check for limits and increment/decrement accordingly */
-            if ((uartReadValue == 'a') && (g_nextAverageCount != AVERAGE_COUNT_MIN))
-            {
-                g_nextAverageCount >>= 1;
-            }
-            else if ((uartReadValue == 'd') && (g_nextAverageCount != AVERAGE_COUNT_MAX))
+            stream_output(false);
+        }
+        else if (g_outputMode == OUTPUT_BLOCKS)
+        {
+            lowpower_output();
+        }
+
+        /* Send a completed trigger capture */
+        export_capture();
+
+        /* Output: move the queued output to the UART FIFO */
+        uart_tx_service();
+
+        /* Command: apply the key pressed on the terminal, if any */
+        handle_command((uint8_t)Cy_SCB_UART_Get(UART_HW));
+
+        /* Sleep: in low-power mode, wait for the next interrupt once there is nothing left to do */
+        if ((g_outputMode == OUTPUT_BLOCKS) && (lowpower_acq_block(&g_lowpowerAcq) == NULL) &&
+            (tx_queue_used(&g_txQueue) == 0u))
+        {
+            (void)Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: handle_command
+********************************************************************************
+* Summary:
+*  This function applies one key pressed on the terminal. Average count and
+*  output format changes are stored in global variables and picked up by the
+*  next configure_SAR_ADC() call; the other keys start their action directly.
+*
+* Parameters:
+*  uint8_t uartReadValue - Received character, 0 if no key was pressed
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void handle_command(uint8_t uartReadValue)
+{
+    /* The low-power mode only takes the keys that change its rate or report its losses */
+    if ((g_outputMode == OUTPUT_BLOCKS) && (uartReadValue != 'z') && (uartReadValue != 'l'))
+    {
+        return;
+    }
+
+    /* The stream mode refuses the keys that print text, which would corrupt the frames on the same UART */
+    if ((g_outputMode == OUTPUT_STREAM) &&
+        ((uartReadValue == 'p') || (uartReadValue == 'l') || (uartReadValue == 't') ||
+         (uartReadValue == 'f') || (uartReadValue == 'b') || (uartReadValue == 'z')))
+    {
+        return;
+    }
+
+    if ((uartReadValue == 'a') || (uartReadValue == 'd'))
+    {
+        /* A manual setting ends the noise driven selection */
+        g_autoAveraging = false;
+
+        /* Check for limits and increment/decrement accordingly */
+        if ((uartReadValue == 'a') && (g_nextAverageCount != AVERAGE_COUNT_MIN))
+        {
+            g_nextAverageCount >>= 1;
+        }
+        else if ((uartReadValue == 'd') && (g_nextAverageCount != AVERAGE_COUNT_MAX))
+        {
+            g_nextAverageCount <<= 1;
+        }
+
+        /* The range detection has no per-conversion reconfiguration to pick up the setting */
+        if (g_outputMode == OUTPUT_EVENTS)
+        {
+            init_range_detection();
+        }
+    }
+    else if (uartReadValue == 'n')
+    {
+        if (!g_autoAveraging)
+        {
+            /* Start from the current setting, within the range of the hardware averaging */
+            if (g_nextAverageCount > (int32_t)AVG_CONTROL_COUNT_MAX)
             {
-                g_nextAverageCount <<= 1;
+                g_nextAverageCount = (int32_t)AVG_CONTROL_COUNT_MAX;
             }
+
+            /* The interrupt handler takes over from here */
+            avg_control_init(&g_avgControl, AVG_CONTROL_TARGET_VAR_Q8, (uint32_t)g_nextAverageCount);
+        }
+        g_autoAveraging = !g_autoAveraging;
+    }
+    else if (uartReadValue == 's')
+    {
+        /* change the output format to next one */
+        if (++g_nextOutputFormat > LEFT_ALIGNED)
+        {
+            g_nextOutputFormat = UNSIGNED_RIGHT_ALIGNED;
+        }
+
+        if (g_outputMode == OUTPUT_EVENTS)
+        {
+            init_range_detection();
+        }
+    }
+    else if (uartReadValue == 'm')
+    {
+        if (g_outputMode == OUTPUT_DISPLAY)
+        {
+            g_streamBlockCount = 0u;
+            g_streamOutputFormat = -1;
+            g_streamAverageCount = -1;
+            sample_ring_reset(&g_sampleRing);
+            g_ringDropping = false;
+            g_outputMode = OUTPUT_STREAM;
+        }
+        else if (g_outputMode == OUTPUT_STREAM)
+        {
+            /* Stop collecting, then send what is left as a final partial block. The conversions
+             * are paused meanwhile, so that no result line is queued in between the frames */
+            pause_conversions();
+            g_outputMode = OUTPUT_DISPLAY;
+            stream_output(true);
+            resume_conversions();
+        }
+    }
+    else if ((uartReadValue == 'r') || (uartReadValue == 'R'))
+    {
+        replay_capture(&REPLAY_CORPUS[g_replayIndex], (uartReadValue == 'R'));
+
+        if (++g_replayIndex >= REPLAY_CORPUS_NUM)
+        {
+            g_replayIndex = 0u;
+        }
+    }
+    else if (uartReadValue == 'p')
+    {
+        print_probe_report();
+    }
+    else if (uartReadValue == 'l')
+    {
+        print_loss_report();
+    }
+    else if (uartReadValue == 'z')
+    {
+#if (CYCLE_PROBE_SYSTICK)
+        uart_tx_flush();
+        printf("\x1b[4E\r\nThe low-power mode needs the SysTick timer, which the cycle probes use\r\n\r\n");
+        fflush(stdout);
+#else
+        if (g_outputMode == OUTPUT_DISPLAY)
+        {
+            g_lowpowerRateIndex = 0u;
+            start_lowpower();
         }
-        else if (uartReadValue == 's')
+        else if (g_outputMode == OUTPUT_BLOCKS)
         {
-            /* change the output format to next one */
-            if (++g_nextOutputFormat > LEFT_ALIGNED)
+            if (++g_lowpowerRateIndex < LOWPOWER_RATE_NUM)
+            {
+                start_lowpower();
+            }
+            else
             {
-                g_nextOutputFormat = UNSIGNED_RIGHT_ALIGNED;
+                stop_lowpower();
             }
         }
+#endif
+    }
+#if (BENCHMARK_ENABLE)
+    else if (uartReadValue == 'b')
+    {
+        /* Keep the interrupt handler from disturbing the measurements */
+        pause_conversions();
+        uart_tx_flush();
+        printf("\x1b[4E\r\n");
+        benchmark_run();
+        printf("\r\n");
+        fflush(stdout);
+        resume_conversions();
+    }
+#endif
+    else if (uartReadValue == 't')
+    {
+        arm_trigger(&TRIGGER_CONFIG[g_triggerIndex]);
+
+        if (++g_triggerIndex >= TRIGGER_CONFIG_NUM)
+        {
+            g_triggerIndex = 0u;
+        }
+    }
+    else if (uartReadValue == 'f')
+    {
+        run_burst();
+    }
+    else if (uartReadValue == 'w')
+    {
+        if (g_outputMode == OUTPUT_DISPLAY)
+        {
+            start_range_events();
+        }
+        else if (g_outputMode == OUTPUT_EVENTS)
+        {
+            stop_range_events();
+        }
+    }
+    else if (uartReadValue == 'g')
+    {
+        generate_signal(g_signalType);
+
+        if (++g_signalType >= SIGNAL_TYPE_NUM)
+        {
+            g_signalType = SIGNAL_DC_NOISE;
+        }
     }
 }
 
@@ -199,113 +711,1588 @@ int main(void)
 *  none
 *
 *******************************************************************************/
-void handle_SAR_ADC_IRQ(void)
+TCM_CODE void handle_SAR_ADC_IRQ(void)
 {
+    CYCLE_PROBE_START(isrStart);
+
     /* Get interrupt source */
-    uint32_t intr = Cy_SAR2_Channel_GetInterruptStatus(PASS0_SAR0, CE_SAR2_AN0_IDX);
+    uint32_t intr = Cy_SAR2_Channel_GetInterruptStatus(SAR_UNIT.base, SAR_UNIT.an0Channel);
 
     /* Clear interrupt source */
-    Cy_SAR2_Channel_ClearInterrupt(PASS0_SAR0, CE_SAR2_AN0_IDX, intr);
+    Cy_SAR2_Channel_ClearInterrupt(SAR_UNIT.base, SAR_UNIT.an0Channel, intr);
+
+    /* A group completed again before the previous group-done was serviced */
+    if ((intr & CY_SAR2_INT_GRP_OVERFLOW) != 0u)
+    {
+        g_loss.groupOverruns++;
+    }
 
     /* if the interrupt is group-done */
-    if (intr == CY_SAR2_INT_GRP_DONE)
+    if ((intr & CY_SAR2_INT_GRP_DONE) != 0u)
     {
-        /* Get conversion results in counts, do not obtain or analyze status here */
-        uint16_t resultVBG = Cy_SAR2_Channel_GetResult(PASS0_SAR0, CE_SAR2_VBG_IDX, NULL);
-        uint16_t resultAN0_raw = Cy_SAR2_Channel_GetResult(PASS0_SAR0, CE_SAR2_AN0_IDX, NULL);
-        uint16_t resultAN0 = resultAN0_raw;
+#if (CYCLE_PROBE_ENABLE)
+        record_irq_timing(isrStart);
+#endif
 
-        if (g_outputFormat == SIGNED_RIGHT_ALIGNED)
+        /* Get conversion results in counts with their status */
+        uint32_t statusVBG;
+        uint32_t statusAN0;
+        uint16_t resultVBG = Cy_SAR2_Channel_GetResult(SAR_UNIT.base, SAR_UNIT.vbgChannel, &statusVBG);
+        uint16_t resultAN0_raw = Cy_SAR2_Channel_GetResult(SAR_UNIT.base, SAR_UNIT.an0Channel, &statusAN0);
+
+        /* A result written while the previous one was still unread sets the overflow of its channel */
+        uint32_t overflowVBG = Cy_SAR2_Channel_GetInterruptStatus(SAR_UNIT.base, SAR_UNIT.vbgChannel) &
+                               CY_SAR2_INT_CH_OVERFLOW;
+
+        if (overflowVBG != 0u)
+        {
+            Cy_SAR2_Channel_ClearInterrupt(SAR_UNIT.base, SAR_UNIT.vbgChannel, overflowVBG);
+            g_loss.resultOverflows++;
+        }
+        if ((intr & CY_SAR2_INT_CH_OVERFLOW) != 0u)
         {
-            resultAN0 = (resultAN0_raw & 0xFFF);
+            g_loss.resultOverflows++;
+        }
 
-            /* The 12-bit code for a signal at VREFH/2 is 0x800.
-             * This means 0x800 is considered 0, any value below 0x800 is on considered negative,
-             * and values above 0x800 are considered positive
-             */
-            if ((resultAN0 & 0x800) != 0)
-            {
-                resultAN0 -= 0x800;
-            }
-            else
+        g_loss.results++;
+        g_conversionPending = false;
+
+        if (((statusVBG & statusAN0) & CY_SAR2_STATUS_VALID) != 0u)
+        {
+            /* Above the SAR2 average count, only every g_avgPlan.swCount-th result completes an output */
+            if (average_result(resultAN0_raw, &resultAN0_raw))
             {
-                resultAN0 += 0x800;
+                process_conversion(resultVBG, resultAN0_raw);
             }
         }
-        else if (g_outputFormat == LEFT_ALIGNED)
+        else
         {
-            resultAN0 = (resultAN0_raw >> 4) & 0xFFF;
+            g_loss.invalidResults++;
         }
 
-        /* Update the current configuration and the conversion result then move cursor to previous line */
-        printf("Output format: %s\r\nAverage count: %" PRId32 "\r\n", OUTPUT_FORMAT_STR[g_outputFormat], g_averageCount);
-        printf("Conversion result raw value: 0x%" PRIu16 "\r\n", resultAN0_raw);
-        printf("Potentiometer voltage: %" PRIu32 "mV\r\n", ((uint32_t)resultAN0 * BAND_GAP_MV) / (uint32_t)resultVBG);
-        printf("\x1b[4F");
+        /* No new conversion while another source feeds the processing */
+        if (!g_conversionsPaused)
+        {
+            configure_SAR_ADC(g_nextOutputFormat, g_nextAverageCount);
+        }
+    }
 
-        configure_SAR_ADC(g_nextOutputFormat, g_nextAverageCount);
+    CYCLE_PROBE_STOP(PROBE_ISR, isrStart);
+}
+
+#if (CYCLE_PROBE_ENABLE)
+/*******************************************************************************
+* Function Name: record_irq_timing
+********************************************************************************
+* Summary:
+*  This function records the interrupt timing of one group-done event:
+*  - Latency: cycles from the software trigger to the first instruction of
+*    handle_SAR_ADC_IRQ(). It includes the conversion time of the group,
+*    which is constant for a given configuration, so the minimum is the
+*    baseline and the spread above it is the time the interrupt waited.
+*  - Jitter: absolute change of the interval between two handler entries
+*    compared with the previous interval.
+*  The history is restarted whenever the SAR ADC is re-initialized.
+*
+* Parameters:
+*  uint32_t isrEntry - Time stamp taken at the entry of the handler
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+TCM_CODE void record_irq_timing(uint32_t isrEntry)
+{
+    uint32_t interval = cycle_probe_diff(isrEntry, g_lastIsrEntry);
+
+    cycle_probe_record(PROBE_IRQ_LATENCY, cycle_probe_diff(isrEntry, g_triggerTime));
+
+    if (g_isrTimingHistory == 2u)
+    {
+        cycle_probe_record(PROBE_IRQ_JITTER, (interval > g_lastIsrInterval) ?
+                           (interval - g_lastIsrInterval) : (g_lastIsrInterval - interval));
     }
+    else
+    {
+        g_isrTimingHistory++;
+    }
+
+    g_lastIsrInterval = interval;
+    g_lastIsrEntry = isrEntry;
 }
+#endif
 
 /*******************************************************************************
-* Function Name: configure_SAR_ADC
+* Function Name: process_conversion
 ********************************************************************************
 * Summary:
-*  This function configures SAR ADC with specified setting.
+*  This function processes the conversion results of one group-done interrupt
+*  according to the current output format and output mode. It is called by
+*  the interrupt handler with the results read from the SAR ADC, and by the
+*  replay source with recorded results.
 *
 * Parameters:
-*  int32_t outputFormat - The received output format from user input
-*  int32_t averageCount - The received average count from user input
+*  uint16_t resultVBG     - Conversion result of the band gap channel
+*  uint16_t resultAN0_raw - Raw conversion result of AN0
 *
 * Return:
 *  none
 *
 *******************************************************************************/
-void configure_SAR_ADC(int32_t outputFormat, int32_t averageCount)
+TCM_CODE void process_conversion(uint16_t resultVBG, uint16_t resultAN0_raw)
 {
-    if ((g_outputFormat != outputFormat) || (g_averageCount != averageCount))
+    CYCLE_PROBE_START(decodeStart);
+    uint16_t resultAN0 = adc_result_decode(resultAN0_raw, g_outputFormat);
+    uint32_t voltageMv = adc_result_to_mv(resultAN0, resultVBG);
+    CYCLE_PROBE_STOP(PROBE_DECODE, decodeStart);
+
+    trigger_capture_add(&g_triggerCapture, resultAN0);
+
+    /* Only the SAR ADC results follow the average count, not replayed or synthetic ones */
+    if (g_autoAveraging && !g_conversionsPaused && avg_control_add(&g_avgControl, resultAN0))
     {
-        /* De-initialize the SAR2 module */
-        Cy_SAR2_DeInit(PASS0_SAR0);
+        /* Applied by the configure_SAR_ADC() call after this conversion */
+        g_nextAverageCount = (int32_t)g_avgControl.averageCount;
+    }
 
-        /* Reflect specified configuration into the structure value */
-        CE_SAR2_AN0_config.rightShift = (uint8_t)(log(averageCount) / log(2));
-        CE_SAR2_AN0_config.averageCount = (uint16_t)averageCount;
+    if (g_outputMode == OUTPUT_STREAM)
+    {
+        /* Hand the result over to the main loop, which encodes and sends it */
+        adc_sample_t sample =
+        {
+            .resultAN0 = resultAN0,
+            .resultVBG = resultVBG,
+            .timestamp = cycle_probe_now(),
+            .averageCount = (uint16_t)g_averageCount,
+            .outputFormat = (uint8_t)g_outputFormat
+        };
 
-        if (outputFormat == UNSIGNED_RIGHT_ALIGNED)
+        if (!sample_ring_push(&g_sampleRing, &sample))
         {
-            CE_SAR2_AN0_config.resultAlignment = CY_SAR2_RESULT_ALIGNMENT_RIGHT;
-            CE_SAR2_AN0_config.signExtention = CY_SAR2_SIGN_EXTENTION_UNSIGNED;
+            if (!g_ringDropping)
+            {
+                g_loss.streamGaps++;
+            }
+            g_loss.ringDrops++;
+            g_ringDropping = true;
         }
-        else if (outputFormat == SIGNED_RIGHT_ALIGNED)
+        else
         {
-            CE_SAR2_AN0_config.resultAlignment = CY_SAR2_RESULT_ALIGNMENT_RIGHT;
-            CE_SAR2_AN0_config.signExtention = CY_SAR2_SIGN_EXTENTION_SIGNED;
+            g_ringDropping = false;
         }
-        else
+    }
+    else if (g_outputMode == OUTPUT_EVENTS)
+    {
+        /* Replayed and synthetic results have no range detection, apply the window in software */
+        if (range_monitor_update(&g_rangeMonitor, resultAN0))
         {
-            CE_SAR2_AN0_config.resultAlignment = CY_SAR2_RESULT_ALIGNMENT_LEFT;
-            CE_SAR2_AN0_config.signExtention = CY_SAR2_SIGN_EXTENTION_UNSIGNED;
+            output_range_event(resultAN0);
         }
+    }
+    else
+    {
+        /* Update the current configuration and the conversion result then move cursor to previous line */
+        output_result(resultAN0_raw, voltageMv);
+    }
+}
 
-        /* Initialize the SAR2 module */
-        Cy_SAR2_Init(PASS0_SAR0, &CE_SAR2_config);
+/*******************************************************************************
+* Function Name: replay_capture
+********************************************************************************
+* Summary:
+*  This function stops the software triggered conversions and feeds the
+*  records of a capture into process_conversion(), exactly as the interrupt
+*  handler would have done, so the same input can be processed again and
+*  again. The records are converted with the SAR2 result model into the
+*  output format currently selected by the user. The conversions are
+*  restarted with the user settings afterwards.
+*
+* Parameters:
+*  const replay_capture_t *capture - Capture to be replayed
+*  bool realTime                   - true to keep the original interval between
+*                                    the records, false to replay at full speed
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void replay_capture(const replay_capture_t *capture, bool realTime)
+{
+    uint32_t i;
+    uint16_t resultAN0_raw;
 
-        /* Set ePASS MMIO reference buffer mode for bangap voltage */
-        Cy_SAR2_SetReferenceBufferMode(PASS0_EPASS_MMIO, CY_SAR2_REF_BUF_MODE_ON);
+    pause_conversions();
 
-        /* Interrupt settings */
-        Cy_SAR2_Channel_SetInterruptMask(PASS0_SAR0, CE_SAR2_AN0_IDX, CY_SAR2_INT_GRP_DONE);
-        Cy_SysInt_Init(&IRQ_CFG, &handle_SAR_ADC_IRQ);
-        NVIC_SetPriority((IRQn_Type) NvicMux3_IRQn, 2UL);
-        NVIC_EnableIRQ((IRQn_Type) NvicMux3_IRQn);
+    g_outputFormat = g_nextOutputFormat;
+    g_averageCount = capture->averageCount;
+
+    for (i = 0u; i < capture->count; i++)
+    {
+        /* Re-encode the recorded result as the SAR2 would return it in the selected format */
+        resultAN0_raw = adc_result_decode(capture->records[i].resultAN0_raw, capture->outputFormat);
+        resultAN0_raw = sar2_model_format(resultAN0_raw, g_outputFormat);
+
+        process_conversion(capture->records[i].resultVBG, resultAN0_raw);
+
+        if (g_outputMode == OUTPUT_STREAM)
+        {
+            stream_output(false);
+        }
+        uart_tx_service();
+
+        if (realTime)
+        {
+            Cy_SysLib_DelayUs((uint16_t)capture->samplePeriodUs);
+        }
     }
 
-    /* Update current configuration */
-    g_outputFormat = outputFormat;
-    g_averageCount = averageCount;
+    resume_conversions();
+}
 
-    /* Scenario: Obtaining conversion results in counts */
-    Cy_SAR2_Channel_SoftwareTrigger(PASS0_SAR0, CE_SAR2_VBG_IDX);
+/*******************************************************************************
+* Function Name: generate_signal
+********************************************************************************
+* Summary:
+*  This function stops the software triggered conversions and processes
+*  SIGNAL_RUN_RESULTS results of a synthetic signal on AN0 and a drifting band
+*  gap on VBG instead. The synthetic conversions are averaged and formatted by
+*  the SAR2 result model and the software averaging stage, split as for the
+*  SAR ADC, with the average count and output format currently selected by
+*  the user. The name of the signal is printed below the result
+*  display first, except in stream mode where it would corrupt the frames.
+*  The conversions are restarted afterwards.
+*
+* Parameters:
+*  int32_t signalType - Signal shape on AN0 (enum SignalType)
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void generate_signal(int32_t signalType)
+{
+    signal_source_t sourceAN0;
+    signal_source_t sourceVBG;
+    uint32_t i;
+
+    pause_conversions();
+
+    g_outputFormat = g_nextOutputFormat;
+    g_averageCount = g_nextAverageCount;
+    plan_averaging(g_averageCount);
+
+    if (g_outputMode != OUTPUT_STREAM)
+    {
+        uart_tx_flush();
+
+        /* \x1b[4E - move the cursor below the 4 result lines */
+        printf("\x1b[4E\r\nSynthetic signal on AN0 (%" PRIu32 " results): %s\r\n\r\n",
+               (uint32_t)SIGNAL_RUN_RESULTS, SIGNAL_TYPE_STR[signalType]);
+        fflush(stdout);
+    }
+
+    signal_source_init(&sourceAN0, signalType, SIGNAL_SOURCE_SEED);
+    signal_source_init(&sourceVBG, SIGNAL_BANDGAP_DRIFT, SIGNAL_SOURCE_SEED + 1u);
+
+    for (i = 0u; i < SIGNAL_RUN_RESULTS; i++)
+    {
+        /* The VBG channel is not averaged, see CE_SAR2_VBG_config */
+        uint16_t resultVBG = signal_source_next_result(&sourceVBG, 1u, 0u, UNSIGNED_RIGHT_ALIGNED);
+        uint16_t resultAN0_raw = signal_source_next_result(&sourceAN0, g_avgPlan.hwCount, g_avgPlan.hwShift,
+                                                           g_outputFormat);
+
+        if (average_result(resultAN0_raw, &resultAN0_raw))
+        {
+            process_conversion(resultVBG, resultAN0_raw);
+        }
+
+        if (g_outputMode == OUTPUT_STREAM)
+        {
+            stream_output(false);
+        }
+        uart_tx_service();
+    }
+
+    resume_conversions();
+}
+
+/*******************************************************************************
+* Function Name: pause_conversions
+********************************************************************************
+* Summary:
+*  This function stops the software triggered conversions and waits until
+*  the conversion in flight has been serviced by the interrupt handler, so
+*  that another source can feed process_conversion(). In range event mode the
+*  range interrupt is disabled instead, as the hardware keeps converting.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void pause_conversions(void)
+{
+    g_conversionsPaused = true;
+
+    /* No conversion is pending in range event mode, handle_range_IRQ() would keep
+     * using the tx queue and the range monitor */
+    if (g_outputMode == OUTPUT_EVENTS)
+    {
+        NVIC_DisableIRQ(SAR_UNIT.irqn);
+    }
+
+    while (g_conversionPending)
+    {
+    }
+}
+
+/*******************************************************************************
+* Function Name: resume_conversions
+********************************************************************************
+* Summary:
+*  This function re-initializes the SAR ADC with the user settings, which also
+*  restarts the software triggered conversions, or the range detection in
+*  range event mode.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void resume_conversions(void)
+{
+    /* Force re-initialization, the previous source may have changed the settings */
+    g_outputFormat = -1;
+    g_conversionsPaused = false;
+
+    if (g_outputMode == OUTPUT_EVENTS)
+    {
+        init_range_detection();
+    }
+    else
+    {
+        configure_SAR_ADC(g_nextOutputFormat, g_nextAverageCount);
+    }
+}
+
+/*******************************************************************************
+* Function Name: configure_SAR_ADC
+********************************************************************************
+* Summary:
+*  This function configures SAR ADC with specified setting. The average
+*  count is split between the SAR2 and the software averaging stage by
+*  plan_averaging().
+*
+* Parameters:
+*  int32_t outputFormat - The received output format from user input
+*  int32_t averageCount - The received average count from user input
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+TCM_CODE void configure_SAR_ADC(int32_t outputFormat, int32_t averageCount)
+{
+    CYCLE_PROBE_START(reconfigStart);
+
+    if ((g_outputFormat != outputFormat) || (g_averageCount != averageCount))
+    {
+        /* De-initialize the SAR2 module */
+        Cy_SAR2_DeInit(SAR_UNIT.base);
+
+        /* Reflect specified configuration into the structure value, with the SAR2 part of the average count */
+        plan_averaging(averageCount);
+        configure_AN0_channel(&SAR_UNIT, outputFormat, (int32_t)g_avgPlan.hwCount);
+
+#if (CYCLE_PROBE_ENABLE)
+        /* The conversion time changes with the configuration, restart the interrupt timing */
+        g_isrTimingHistory = 0u;
+        cycle_probe_reset_zone(PROBE_IRQ_LATENCY);
+        cycle_probe_reset_zone(PROBE_IRQ_JITTER);
+#endif
+
+        /* Initialize the SAR2 module */
+        init_SAR_unit(&SAR_UNIT, &handle_SAR_ADC_IRQ, false);
+    }
+
+    /* Update current configuration */
+    g_outputFormat = outputFormat;
+    g_averageCount = averageCount;
+
+    /* Scenario: Obtaining conversion results in counts */
+    g_conversionPending = true;
+#if (CYCLE_PROBE_ENABLE)
+    g_triggerTime = cycle_probe_now();
+#endif
+    Cy_SAR2_Channel_SoftwareTrigger(SAR_UNIT.base, SAR_UNIT.vbgChannel);
+
+    CYCLE_PROBE_STOP(PROBE_RECONFIG, reconfigStart);
+}
+
+/*******************************************************************************
+* Function Name: plan_averaging
+********************************************************************************
+* Summary:
+*  This function splits an average count between the SAR2 average count and
+*  the software averaging stage with avg_plan_select(), for
+*  AVERAGE_OUTPUT_RATE_HZ outputs per second, and restarts the software
+*  stage. Up to SAR2_MODEL_AVERAGE_MAX, the SAR2 averages alone as long as
+*  the conversion rate allows it. If no split meets the rate, the one with
+*  the lowest CPU load is used and the outputs come slower.
+*
+* Parameters:
+*  int32_t averageCount - Average count (AVERAGE_COUNT_MIN to AVERAGE_COUNT_MAX)
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void plan_averaging(int32_t averageCount)
+{
+    (void)avg_plan_select((uint32_t)averageCount, AVERAGE_OUTPUT_RATE_HZ, &g_avgPlanCost, &g_avgPlan);
+    avg_accum_init(&g_avgAccum, g_avgPlan.swCount);
+}
+
+/*******************************************************************************
+* Function Name: average_result
+********************************************************************************
+* Summary:
+*  This function adds one AN0 result of the SAR2 to the software averaging
+*  stage of g_avgPlan. When the stage completes an output, the rounded mean
+*  is returned in the current output format, as the SAR2 would return the
+*  whole average count. Without a software stage, the result is passed on as
+*  it is.
+*
+* Parameters:
+*  uint16_t resultAN0_raw   - Raw conversion result of AN0
+*  uint16_t *averageAN0_raw - Raw value of the averaged result
+*
+* Return:
+*  bool - true if *averageAN0_raw was written
+*
+*******************************************************************************/
+TCM_CODE bool average_result(uint16_t resultAN0_raw, uint16_t *averageAN0_raw)
+{
+    uint16_t mean;
+
+    if (g_avgAccum.count <= 1u)
+    {
+        *averageAN0_raw = resultAN0_raw;
+        return true;
+    }
+
+    if (!avg_accum_add(&g_avgAccum, adc_result_decode(resultAN0_raw, g_outputFormat), &mean))
+    {
+        return false;
+    }
+
+    *averageAN0_raw = sar2_model_format(mean, g_outputFormat);
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: init_SAR_unit
+********************************************************************************
+* Summary:
+*  This function initializes a SAR2 unit with its configuration and enables
+*  its group-done interrupt with the given handler. The unit must have been
+*  de-initialized before.
+*
+* Parameters:
+*  const sar_unit_t *unit - SAR2 unit
+*  cy_israddress handler  - Group-done interrupt handler, NULL to leave the
+*                           interrupt disabled and poll the results
+*  bool continuous        - true to restart the group by hardware as soon as
+*                           it is done, false for software triggers
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void init_SAR_unit(const sar_unit_t *unit, cy_israddress handler, bool continuous)
+{
+    cy_en_sar2_trigger_selection_t trigger = unit->vbgConfig->triggerSelection;
+
+    /* The trigger selection is only needed by Cy_SAR2_Init() */
+    if (continuous)
+    {
+        unit->vbgConfig->triggerSelection = CY_SAR2_TRIGGER_CONTINUOUS;
+    }
+    Cy_SAR2_Init(unit->base, unit->config);
+    unit->vbgConfig->triggerSelection = trigger;
+
+    /* Set ePASS MMIO reference buffer mode for bangap voltage */
+    Cy_SAR2_SetReferenceBufferMode(unit->epass, CY_SAR2_REF_BUF_MODE_ON);
+
+    /* Interrupt settings */
+    if (handler != NULL)
+    {
+        Cy_SAR2_Channel_SetInterruptMask(unit->base, unit->an0Channel, CY_SAR2_INT_GRP_DONE);
+        Cy_SysInt_Init(unit->irqCfg, handler);
+        NVIC_SetPriority(unit->irqn, unit->irqCfg->intrPriority);
+        NVIC_EnableIRQ(unit->irqn);
+    }
+}
+
+/*******************************************************************************
+* Function Name: configure_AN0_channel
+********************************************************************************
+* Summary:
+*  This function reflects the output format and the average count into the
+*  AN0 channel configuration of a unit, which is applied by the next
+*  Cy_SAR2_Init().
+*
+* Parameters:
+*  const sar_unit_t *unit - SAR2 unit
+*  int32_t outputFormat   - Output format (enum OutputFmt)
+*  int32_t averageCount   - SAR2 average count (1 to SAR2_MODEL_AVERAGE_MAX)
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void configure_AN0_channel(const sar_unit_t *unit, int32_t outputFormat, int32_t averageCount)
+{
+    unit->an0Config->rightShift = sar2_model_right_shift((uint32_t)averageCount);
+    unit->an0Config->averageCount = (uint16_t)averageCount;
+
+    if (outputFormat == UNSIGNED_RIGHT_ALIGNED)
+    {
+        unit->an0Config->resultAlignment = CY_SAR2_RESULT_ALIGNMENT_RIGHT;
+        unit->an0Config->signExtention = CY_SAR2_SIGN_EXTENTION_UNSIGNED;
+    }
+    else if (outputFormat == SIGNED_RIGHT_ALIGNED)
+    {
+        unit->an0Config->resultAlignment = CY_SAR2_RESULT_ALIGNMENT_RIGHT;
+        unit->an0Config->signExtention = CY_SAR2_SIGN_EXTENTION_SIGNED;
+    }
+    else
+    {
+        unit->an0Config->resultAlignment = CY_SAR2_RESULT_ALIGNMENT_LEFT;
+        unit->an0Config->signExtention = CY_SAR2_SIGN_EXTENTION_UNSIGNED;
+    }
+}
+
+/*******************************************************************************
+* Function Name: run_burst
+********************************************************************************
+* Summary:
+*  This function captures BURST_SAMPLES results of AN0 at the maximum rate of
+*  the SAR ADC and prints a report below the result display. The software
+*  triggered conversions are paused, AN0 is set to an average count of 1 in
+*  the selected output format, and the group is re-triggered continuously by
+*  the hardware. handle_burst_IRQ() only stores the results. The report gives
+*  the achieved rate, the shortest and longest interval between results, the
+*  number of group overflow events, and the range of the decoded results.
+*  If the buffer is not full after BURST_TIMEOUT_MS, the capture is stopped
+*  and reported as timed out, with the samples captured so far. The software
+*  triggered conversions are restarted afterwards.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void run_burst(void)
+{
+    adc_stats_t stats;
+    uint64_t deadline;
+    bool timedOut = false;
+    uint32_t i;
+
+    pause_conversions();
+
+    burst_capture_start(&g_burstCapture, BURST_SAMPLES);
+
+    /* De-initialize the SAR2 module */
+    Cy_SAR2_DeInit(SAR_UNIT.base);
+
+    g_outputFormat = g_nextOutputFormat;
+    g_averageCount = 1;
+    configure_AN0_channel(&SAR_UNIT, g_outputFormat, g_averageCount);
+
+    /* The group restarts as soon as it is done */
+    init_SAR_unit(&SAR_UNIT, &handle_burst_IRQ, true);
+
+    deadline = timebase_now() + (((uint64_t)timebase_hz() * BURST_TIMEOUT_MS) / 1000u);
+    Cy_SAR2_Channel_SoftwareTrigger(SAR_UNIT.base, SAR_UNIT.vbgChannel);
+
+    while (!g_burstCapture.done)
+    {
+        if (timebase_now() >= deadline)
+        {
+            /* No more results are stored once the interrupt is disabled */
+            NVIC_DisableIRQ(SAR_UNIT.irqn);
+            timedOut = !g_burstCapture.done;
+            break;
+        }
+    }
+
+    adc_stats_reset(&stats);
+    for (i = 0u; i < g_burstCapture.count; i++)
+    {
+        adc_stats_add(&stats, adc_result_decode(g_burstCapture.buf[i], g_outputFormat));
+    }
+
+    uart_tx_flush();
+
+    /* \x1b[4E - move the cursor below the 4 result lines */
+    printf("\x1b[4E\r\n");
+    if (timedOut)
+    {
+        printf("Burst timed out after %" PRIu32 " ms with %" PRIu32 " of %" PRIu32 " samples\r\n",
+               BURST_TIMEOUT_MS, g_burstCapture.count, BURST_SAMPLES);
+    }
+    printf("Burst: %" PRIu32 " samples, %" PRIu32 " samples/s\r\n", g_burstCapture.count,
+           burst_capture_rate(&g_burstCapture, SystemCoreClock));
+    printf("Interval min/max: %" PRIu32 "/%" PRIu32 " cycles, overflow events: %" PRIu32 "\r\n",
+           g_burstCapture.minInterval, g_burstCapture.maxInterval, g_burstCapture.gaps);
+    if (g_burstCapture.count != 0u)
+    {
+        printf("Result min/mean/max: %" PRIu16 "/%" PRIu32 "/%" PRIu16 "\r\n", stats.min,
+               (uint32_t)stats.mean, stats.max);
+    }
+    printf("\r\n");
+    fflush(stdout);
+
+    /* Re-initializes the SAR ADC, which also registers handle_SAR_ADC_IRQ() again */
+    resume_conversions();
+}
+
+/*******************************************************************************
+* Function Name: handle_burst_IRQ
+********************************************************************************
+* Summary:
+*  This is the interrupt handler of the burst capture. It stores the AN0
+*  result of every group-done event with its time stamp, and counts the group
+*  overflow events. The interrupt is disabled once the buffer is
+*  full.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+TCM_CODE void handle_burst_IRQ(void)
+{
+    uint32_t now = cycle_probe_now();
+    uint32_t intr = Cy_SAR2_Channel_GetInterruptStatus(SAR_UNIT.base, SAR_UNIT.an0Channel);
+
+    Cy_SAR2_Channel_ClearInterrupt(SAR_UNIT.base, SAR_UNIT.an0Channel, intr);
+
+    if ((intr & CY_SAR2_INT_GRP_OVERFLOW) != 0u)
+    {
+        burst_capture_gap(&g_burstCapture);
+    }
+
+    if ((intr & CY_SAR2_INT_GRP_DONE) != 0u)
+    {
+        if (burst_capture_add(&g_burstCapture, Cy_SAR2_Channel_GetResult(SAR_UNIT.base, SAR_UNIT.an0Channel, NULL), now))
+        {
+            NVIC_DisableIRQ(SAR_UNIT.irqn);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: start_range_events
+********************************************************************************
+* Summary:
+*  This function switches from the result display to range event mode. The
+*  software triggered conversions are stopped and the group is converted
+*  continuously by the hardware, with the range detection of AN0 as the only
+*  interrupt. One line is printed per event, when AN0 leaves or enters
+*  RANGE_WINDOW_AN0.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void start_range_events(void)
+{
+    pause_conversions();
+
+    /* Leave the result display in place and start the event lines below it */
+    uart_tx_flush();
+    printf("\x1b[4E\r\ntime_ms,channel,event,result\r\n");
+    fflush(stdout);
+
+    g_an0SavedConfig = *SAR_UNIT.an0Config;
+    range_monitor_init(&g_rangeMonitor, &RANGE_WINDOW_AN0);
+    g_outputMode = OUTPUT_EVENTS;
+    resume_conversions();
+}
+
+/*******************************************************************************
+* Function Name: stop_range_events
+********************************************************************************
+* Summary:
+*  This function restores the AN0 interrupt and range detection settings and
+*  returns to the result display with software triggered conversions.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void stop_range_events(void)
+{
+    NVIC_DisableIRQ(SAR_UNIT.irqn);
+    Cy_SAR2_DeInit(SAR_UNIT.base);
+
+    SAR_UNIT.an0Config->rangeDetectionMode = g_an0SavedConfig.rangeDetectionMode;
+    SAR_UNIT.an0Config->rangeDetectionLoThreshold = g_an0SavedConfig.rangeDetectionLoThreshold;
+    SAR_UNIT.an0Config->rangeDetectionHiThreshold = g_an0SavedConfig.rangeDetectionHiThreshold;
+    SAR_UNIT.an0Config->interruptMask = g_an0SavedConfig.interruptMask;
+
+    uart_tx_flush();
+    printf("\r\n");
+    fflush(stdout);
+
+    g_outputMode = OUTPUT_DISPLAY;
+    resume_conversions();
+}
+
+/*******************************************************************************
+* Function Name: init_range_detection
+********************************************************************************
+* Summary:
+*  This function re-initializes the SAR ADC for range event mode with the
+*  user settings. The range detection of AN0 is set from the state of the
+*  range monitor, and the group is re-triggered continuously by the hardware.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void init_range_detection(void)
+{
+    range_detect_t detect;
+
+    NVIC_DisableIRQ(SAR_UNIT.irqn);
+    Cy_SAR2_DeInit(SAR_UNIT.base);
+
+    g_outputFormat = g_nextOutputFormat;
+    g_averageCount = g_nextAverageCount;
+
+    /* Every SAR2 result is used on its own, without the software averaging stage */
+    if (g_averageCount > (int32_t)SAR2_MODEL_AVERAGE_MAX)
+    {
+        g_averageCount = (int32_t)SAR2_MODEL_AVERAGE_MAX;
+    }
+    configure_AN0_channel(&SAR_UNIT, g_outputFormat, g_averageCount);
+
+    range_monitor_detect(&g_rangeMonitor, g_outputFormat, &detect);
+    configure_AN0_range(&SAR_UNIT, &detect);
+    SAR_UNIT.an0Config->interruptMask = CY_SAR2_INT_CH_RANGE;
+
+    /* The group restarts as soon as it is done */
+    init_SAR_unit(&SAR_UNIT, &handle_range_IRQ, true);
+
+    /* Only the range events wake the CPU */
+    Cy_SAR2_Channel_SetInterruptMask(SAR_UNIT.base, SAR_UNIT.an0Channel, CY_SAR2_INT_CH_RANGE);
+
+    Cy_SAR2_Channel_SoftwareTrigger(SAR_UNIT.base, SAR_UNIT.vbgChannel);
+}
+
+/*******************************************************************************
+* Function Name: configure_AN0_range
+********************************************************************************
+* Summary:
+*  This function reflects a range detection setting into the AN0 channel
+*  configuration of a unit, which is applied by the next Cy_SAR2_Init() or
+*  Cy_SAR2_Channel_Init().
+*
+* Parameters:
+*  const sar_unit_t *unit       - SAR2 unit
+*  const range_detect_t *detect - Range detection setting
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+TCM_CODE void configure_AN0_range(const sar_unit_t *unit, const range_detect_t *detect)
+{
+    /* enum Sar2RangeMode follows the order of the PDL modes */
+    unit->an0Config->rangeDetectionMode = (cy_en_sar2_range_detection_mode_t)detect->mode;
+    unit->an0Config->rangeDetectionLoThreshold = detect->lo;
+    unit->an0Config->rangeDetectionHiThreshold = detect->hi;
+}
+
+/*******************************************************************************
+* Function Name: handle_range_IRQ
+********************************************************************************
+* Summary:
+*  AN0 range interrupt handler of range event mode. The range detection is
+*  always set up for the next event, so every interrupt is one: the monitor
+*  is updated, the range detection of AN0 is set up for the event after it,
+*  and the event line is queued.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+TCM_CODE void handle_range_IRQ(void)
+{
+    uint32_t intr = Cy_SAR2_Channel_GetInterruptStatus(SAR_UNIT.base, SAR_UNIT.an0Channel);
+
+    Cy_SAR2_Channel_ClearInterrupt(SAR_UNIT.base, SAR_UNIT.an0Channel, intr);
+
+    if ((intr & CY_SAR2_INT_CH_RANGE) != 0u)
+    {
+        uint16_t resultAN0 = adc_result_decode(Cy_SAR2_Channel_GetResult(SAR_UNIT.base, SAR_UNIT.an0Channel, NULL),
+                                               g_outputFormat);
+
+        if (range_monitor_update(&g_rangeMonitor, resultAN0))
+        {
+            range_detect_t detect;
+
+            range_monitor_detect(&g_rangeMonitor, g_outputFormat, &detect);
+            configure_AN0_range(&SAR_UNIT, &detect);
+            (void)Cy_SAR2_Channel_Init(SAR_UNIT.base, SAR_UNIT.an0Channel, SAR_UNIT.an0Config);
+
+            output_range_event(resultAN0);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: output_range_event
+********************************************************************************
+* Summary:
+*  This function queues the line of a range event in CSV format: the time in
+*  milliseconds, the channel, "enter" or "leave", and the decoded result.
+*  Unlike the result display, no event line is skipped while the previous
+*  ones are being sent.
+*
+* Parameters:
+*  uint16_t resultAN0 - Decoded AN0 result that caused the event
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+TCM_CODE void output_range_event(uint16_t resultAN0)
+{
+    char buf[RESULT_LINES_BUF_SIZE];
+    uint32_t len = 0u;
+    uint32_t timeMs = (uint32_t)(timebase_now() / (timebase_hz() / 1000u));
+
+    len += uart_format_u32(&buf[len], timeMs);
+    len += uart_format_str(&buf[len], ",AN0,");
+    len += uart_format_str(&buf[len], g_rangeMonitor.inside ? "enter," : "leave,");
+    len += uart_format_u32(&buf[len], resultAN0);
+    len += uart_format_str(&buf[len], "\r\n");
+
+    if (!tx_queue_write(&g_txQueue, buf, len))
+    {
+        g_loss.txDrops++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: start_lowpower
+********************************************************************************
+* Summary:
+*  This function starts the low-power block acquisition at the sample rate
+*  LOWPOWER_RATES_HZ[g_lowpowerRateIndex], or changes to that rate. The
+*  group-done interrupt is disabled; the SysTick timer interrupts once per
+*  sample, and its handler stores the previous AN0 result and triggers the
+*  next conversion. The CPU clock is divided by the highest divider that
+*  keeps the acquisition within LOWPOWER_LOAD_MAX_PCT of the CPU time, and
+*  the main loop sleeps whenever it has no complete block to process. The
+*  selected clock and the CPU time and average current estimated by
+*  lowpower_estimate() are printed, followed by one CSV line per block.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void start_lowpower(void)
+{
+    uint32_t rateHz = LOWPOWER_RATES_HZ[g_lowpowerRateIndex];
+    uint32_t divider = lowpower_select_divider(&g_lowpowerCost, rateHz);
+    bool fromDisplay = (g_outputMode != OUTPUT_BLOCKS);
+    lowpower_estimate_t estimate;
+
+    if (fromDisplay)
+    {
+        pause_conversions();
+    }
+    else
+    {
+        /* Stop the acquisition at the previous rate */
+        SysTick->CTRL = 0u;
+    }
+
+    /* Too fast for the load limit: run at the full clock anyway, the report shows the overruns */
+    if (divider == 0u)
+    {
+        divider = 1u;
+    }
+
+    lowpower_estimate(&g_lowpowerCost, rateHz, divider, &estimate);
+
+    uart_tx_flush();
+
+    /* \x1b[4E - move the cursor below the 4 result lines */
+    printf("%sLow-power mode: %" PRIu32 " Hz, CPU clock divided by %" PRIu32 ", estimated %" PRIu32
+           " uA (CPU running %" PRIu32 ".%" PRIu32 " %%)\r\nblock,min,mean,max,overruns,late,invalid\r\n",
+           fromDisplay ? "\x1b[4E\r\n" : "", rateHz, divider, estimate.averageUa,
+           estimate.activePpm / 10000u, (estimate.activePpm / 1000u) % 10u);
+    fflush(stdout);
+
+    set_cpu_clock_divider(divider);
+
+    /* Software triggered group, without the group-done interrupt */
+    NVIC_DisableIRQ(SAR_UNIT.irqn);
+    Cy_SAR2_DeInit(SAR_UNIT.base);
+    g_outputFormat = g_nextOutputFormat;
+    g_averageCount = g_nextAverageCount;
+
+    /* Every SAR2 result is used on its own, without the software averaging stage */
+    if (g_averageCount > (int32_t)SAR2_MODEL_AVERAGE_MAX)
+    {
+        g_averageCount = (int32_t)SAR2_MODEL_AVERAGE_MAX;
+    }
+    configure_AN0_channel(&SAR_UNIT, g_outputFormat, g_averageCount);
+    init_SAR_unit(&SAR_UNIT, NULL, false);
+
+    lowpower_acq_reset(&g_lowpowerAcq);
+    g_lowpowerBlocks = 0u;
+    g_outputMode = OUTPUT_BLOCKS;
+
+    /* The first SysTick interrupt reads the result of this conversion */
+    Cy_SAR2_Channel_SoftwareTrigger(SAR_UNIT.base, SAR_UNIT.vbgChannel);
+    (void)SysTick_Config(SystemCoreClock / rateHz);
+}
+
+/*******************************************************************************
+* Function Name: stop_lowpower
+********************************************************************************
+* Summary:
+*  This function stops the SysTick timer, restores the full CPU clock, and
+*  returns to the result display with software triggered conversions.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void stop_lowpower(void)
+{
+    SysTick->CTRL = 0u;
+    set_cpu_clock_divider(1u);
+
+    uart_tx_flush();
+    printf("\r\n");
+    fflush(stdout);
+
+    g_outputMode = OUTPUT_DISPLAY;
+    resume_conversions();
+}
+
+/*******************************************************************************
+* Function Name: set_cpu_clock_divider
+********************************************************************************
+* Summary:
+*  This function divides the clock of the CM7 cores and updates
+*  SystemCoreClock. The peripheral clocks, and with them the SAR ADC and the
+*  UART, are not affected. The time base is rescaled, so its frequency stays
+*  the undivided clock.
+*
+* Parameters:
+*  uint32_t divider - 1, 2, 4, or 8
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void set_cpu_clock_divider(uint32_t divider)
+{
+    uint32_t i = 0u;
+
+    while ((divider >> (i + 1u)) != 0u)
+    {
+        i++;
+    }
+
+    /* The time base keeps counting undivided cycles */
+    timebase_set_divider(divider);
+    (void)Cy_SysClk_ClkHfSetDivider(LOWPOWER_CLK_HF, LOWPOWER_CLK_DIVIDERS[i]);
+    SystemCoreClockUpdate();
+}
+
+#if !(CYCLE_PROBE_SYSTICK)
+/*******************************************************************************
+* Function Name: SysTick_Handler
+********************************************************************************
+* Summary:
+*  SysTick interrupt handler of the low-power mode, called once per sample.
+*  It stores the AN0 result of the conversion started by the previous call
+*  and starts the next one, so the CPU wakes up once per sample. A result
+*  that is not valid yet, because the conversion took longer than the sample
+*  period, is counted as invalid. A sample period that ends before the
+*  handler returns is counted as late; its interrupt is taken right after,
+*  and if the handler keeps running late, sample periods are lost.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+TCM_CODE void SysTick_Handler(void)
+{
+    uint32_t status;
+    uint16_t resultAN0_raw = Cy_SAR2_Channel_GetResult(SAR_UNIT.base, SAR_UNIT.an0Channel, &status);
+
+    if ((status & CY_SAR2_STATUS_VALID) != 0u)
+    {
+        (void)lowpower_acq_add(&g_lowpowerAcq, adc_result_decode(resultAN0_raw, g_outputFormat));
+    }
+    else
+    {
+        g_loss.invalidResults++;
+    }
+
+    Cy_SAR2_Channel_SoftwareTrigger(SAR_UNIT.base, SAR_UNIT.vbgChannel);
+
+    /* The next sample period has already ended */
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0u)
+    {
+        g_lowpowerAcq.late++;
+    }
+}
+#endif
+
+/*******************************************************************************
+* Function Name: lowpower_output
+********************************************************************************
+* Summary:
+*  This function processes the oldest complete block of the low-power mode:
+*  it queues a CSV line with the block number, the minimum, mean, and maximum
+*  result, and the counts so far of the results dropped because both blocks
+*  were full, of the late sample periods, and of the invalid results (since
+*  the last loss report).
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void lowpower_output(void)
+{
+    const uint16_t *block = lowpower_acq_block(&g_lowpowerAcq);
+    adc_stats_t stats;
+    char buf[RESULT_LINES_BUF_SIZE];
+    uint32_t len = 0u;
+    uint32_t i;
+
+    if (block == NULL)
+    {
+        return;
+    }
+
+    adc_stats_reset(&stats);
+    for (i = 0u; i < LOWPOWER_BLOCK_SAMPLES; i++)
+    {
+        adc_stats_add(&stats, block[i]);
+    }
+    lowpower_acq_release(&g_lowpowerAcq);
+
+    len += uart_format_u32(&buf[len], g_lowpowerBlocks++);
+    len += uart_format_str(&buf[len], ",");
+    len += uart_format_u32(&buf[len], stats.min);
+    len += uart_format_str(&buf[len], ",");
+    len += uart_format_u32(&buf[len], (uint32_t)stats.mean);
+    len += uart_format_str(&buf[len], ",");
+    len += uart_format_u32(&buf[len], stats.max);
+    len += uart_format_str(&buf[len], ",");
+    len += uart_format_u32(&buf[len], g_lowpowerAcq.overruns);
+    len += uart_format_str(&buf[len], ",");
+    len += uart_format_u32(&buf[len], g_lowpowerAcq.late);
+    len += uart_format_str(&buf[len], ",");
+    len += uart_format_u32(&buf[len], g_loss.invalidResults);
+    len += uart_format_str(&buf[len], "\r\n");
+
+    if (!tx_queue_write(&g_txQueue, buf, len))
+    {
+        g_loss.txDrops++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: output_result
+********************************************************************************
+* Summary:
+*  This function builds the result lines of one conversion with the fixed-format
+*  integer formatter and writes them to the UART transmit FIFO. The output is
+*  identical to the previous printf based implementation:
+*    "Output format: %s\r\nAverage count: %" PRId32 "\r\n"
+*    "Conversion result raw value: 0x%" PRIu16 "\r\n"
+*    "Potentiometer voltage: %" PRIu32 "mV\r\n"
+*    "\x1b[4F"
+*
+* Parameters:
+*  uint16_t resultAN0_raw - Raw conversion result of AN0
+*  uint32_t voltageMv     - Potentiometer voltage in milli volt
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+TCM_CODE void output_result(uint16_t resultAN0_raw, uint32_t voltageMv)
+{
+    char buf[RESULT_LINES_BUF_SIZE];
+    uint32_t len = 0u;
+
+    /* The display only shows the latest result, skip it while the previous lines are being sent */
+    if (tx_queue_used(&g_txQueue) != 0u)
+    {
+        g_loss.displaySkips++;
+        return;
+    }
+
+    CYCLE_PROBE_START(formatStart);
+    len += uart_format_str(&buf[len], "Output format: ");
+    len += uart_format_str(&buf[len], OUTPUT_FORMAT_STR[g_outputFormat]);
+    len += uart_format_str(&buf[len], "\r\nAverage count: ");
+    len += uart_format_i32(&buf[len], g_averageCount);
+    len += uart_format_str(&buf[len], "\r\nConversion result raw value: 0x");
+    len += uart_format_u32(&buf[len], resultAN0_raw);
+    len += uart_format_str(&buf[len], "\r\nPotentiometer voltage: ");
+    len += uart_format_u32(&buf[len], voltageMv);
+    len += uart_format_str(&buf[len], "mV\r\n\x1b[4F");
+    CYCLE_PROBE_STOP(PROBE_FORMAT, formatStart);
+
+    CYCLE_PROBE_START(uartStart);
+    if (!tx_queue_write(&g_txQueue, buf, len))
+    {
+        g_loss.txDrops++;
+    }
+    CYCLE_PROBE_STOP(PROBE_UART, uartStart);
+}
+/*******************************************************************************
+* Function Name: stream_output
+********************************************************************************
+* Summary:
+*  This function moves the results queued by the interrupt handler into the
+*  current stream block and sends every full block as a sample frame. A
+*  configuration frame is sent first whenever the output format or the average
+*  count differs from the one last announced. At most SAMPLE_RING_SIZE results
+*  are moved per call, so that a stream faster than the UART does not keep the
+*  main loop from the commands.
+*
+* Parameters:
+*  bool flush - Also send the last block if it is only partially filled
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void stream_output(bool flush)
+{
+    adc_sample_t sample;
+    uint32_t count;
+
+    /* At most one ring of samples per call: while the frames wait for the UART, the interrupt
+     * handler refills the ring, and the main loop has to get back to the keys */
+    for (count = 0u; (count < SAMPLE_RING_SIZE) && sample_ring_pop(&g_sampleRing, &sample); count++)
+    {
+        /* Compare with the settings of the sample, the current ones may already have changed again */
+        bool newSettings = (g_streamOutputFormat != (int32_t)sample.outputFormat) ||
+                           (g_streamAverageCount != (int32_t)sample.averageCount);
+
+        if (newSettings)
+        {
+            /* Close the block taken with the old settings before announcing the new ones */
+            stream_send_block();
+        }
+
+        if (g_streamBlockCount == 0u)
+        {
+            g_streamBlockTime = timebase_extend(sample.timestamp);
+        }
+
+        if (newSettings)
+        {
+            stream_send_config(&sample);
+        }
+
+        g_streamBlock[g_streamBlockCount++] = sample.resultAN0;
+
+        if (g_streamBlockCount == STREAM_BLOCK_SAMPLES)
+        {
+            stream_send_block();
+        }
+    }
+
+    if (flush)
+    {
+        stream_send_block();
+    }
+}
+
+/*******************************************************************************
+* Function Name: stream_send_block
+********************************************************************************
+* Summary:
+*  This function delta + Rice encodes the current stream block with
+*  stream_encode_block() and writes it to the UART as a sample frame, preceded
+*  by the time of its first sample relative to the previous block. Nothing is
+*  sent if the block is empty.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void stream_send_block(void)
+{
+    uint8_t frame[STREAM_FRAME_OVERHEAD + STREAM_FRAME_VARINT_MAX_SIZE + STREAM_BLOCK_MAX_SIZE];
+    uint32_t length;
+
+    if (g_streamBlockCount != 0u)
+    {
+        /* Time of the first sample as the difference to the previous block */
+        length = stream_frame_pack_varint(&frame[STREAM_FRAME_HEADER_SIZE], g_streamBlockTime - g_streamFrameTime);
+        g_streamFrameTime = g_streamBlockTime;
+
+        length += stream_encode_block(g_streamBlock, g_streamBlockCount, &frame[STREAM_FRAME_HEADER_SIZE + length]);
+        length = stream_frame_finish(frame, STREAM_FRAME_TYPE_SAMPLES, g_streamSequence++, length);
+        uart_tx_write(frame, length);
+        g_streamBlockCount = 0u;
+    }
+}
+
+/*******************************************************************************
+* Function Name: stream_send_config
+********************************************************************************
+* Summary:
+*  This function writes the acquisition settings of a sample to the UART as a
+*  configuration frame, with the time base frequency and the 64-bit time of
+*  the first sample of the current block as the time reference.
+*
+* Parameters:
+*  const adc_sample_t *sample - Sample taken with the settings to be announced
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void stream_send_config(const adc_sample_t *sample)
+{
+    uint8_t frame[STREAM_FRAME_OVERHEAD + STREAM_FRAME_CONFIG_SIZE];
+    stream_frame_config_t config;
+    uint32_t length;
+
+    g_streamOutputFormat = (int32_t)sample->outputFormat;
+    g_streamAverageCount = (int32_t)sample->averageCount;
+
+    config.outputFormat = (uint8_t)g_streamOutputFormat;
+    config.blockSamples = (uint8_t)STREAM_BLOCK_SAMPLES;
+    config.averageCount = (uint16_t)g_streamAverageCount;
+    config.bandGapMv = (uint16_t)BAND_GAP_MV;
+    config.tickHz = timebase_hz();
+    config.time = g_streamBlockTime;
+    g_streamFrameTime = g_streamBlockTime;
+
+    length = stream_frame_pack_config(&frame[STREAM_FRAME_HEADER_SIZE], &config);
+    length = stream_frame_finish(frame, STREAM_FRAME_TYPE_CONFIG, g_streamSequence++, length);
+    uart_tx_write(frame, length);
+}
+
+/*******************************************************************************
+* Function Name: uart_tx_service
+********************************************************************************
+* Summary:
+*  This function moves as many queued bytes as fit into the UART TX FIFO
+*  without waiting. It is called by the main loop and by the loops that feed
+*  the processing from another source.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void uart_tx_service(void)
+{
+    const uint8_t *data;
+    uint32_t size = tx_queue_peek(&g_txQueue, &data);
+
+    if (size != 0u)
+    {
+        size = Cy_SCB_UART_PutArray(UART_HW, (void *)data, size);
+        tx_queue_consume(&g_txQueue, size);
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_tx_write
+********************************************************************************
+* Summary:
+*  This function queues a stream frame for the UART. The stream must not lose
+*  frames, so the queue is drained until the whole frame fits. To be called
+*  from the main loop only.
+*
+* Parameters:
+*  const void *data - Frame to be sent
+*  uint32_t size    - Size of the frame in bytes
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void uart_tx_write(const void *data, uint32_t size)
+{
+    while (!tx_queue_write(&g_txQueue, data, size))
+    {
+        uart_tx_service();
+    }
+}
+
+/*******************************************************************************
+* Function Name: uart_tx_flush
+********************************************************************************
+* Summary:
+*  This function drains the queue to the UART, so that text printed with
+*  printf() afterwards does not interleave with the queued output.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void uart_tx_flush(void)
+{
+    while (tx_queue_used(&g_txQueue) != 0u)
+    {
+        uart_tx_service();
+    }
+}
+/*******************************************************************************
+* Function Name: print_probe_report
+********************************************************************************
+* Summary:
+*  This function prints the execution time statistics of every probe zone,
+*  in CPU cycles, and the interrupt latency and jitter below the result
+*  display, then restarts the measurements. The number of group overflow
+*  events is printed as well.
+*  For each zone, the log2 histogram lists the number of measurements per
+*  power of two range of cycles.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void print_probe_report(void)
+{
+#if (CYCLE_PROBE_ENABLE)
+    cycle_probe_zone_t stats;
+    uint32_t zone;
+    uint32_t bin;
+
+    uart_tx_flush();
+
+    /* \x1b[4E - move the cursor below the 4 result lines */
+    printf("\x1b[4E\r\nZone      count      min     mean      max  [cycles]\r\n");
+
+    for (zone = 0u; zone < PROBE_ZONE_NUM; zone++)
+    {
+        cycle_probe_read(zone, &stats);
+        if (stats.count == 0u)
+        {
+            printf("%s  %8" PRIu32 "\r\n", PROBE_ZONE_STR[zone], stats.count);
+            continue;
+        }
+
+        printf("%s  %8" PRIu32 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 "\r\n", PROBE_ZONE_STR[zone], stats.count,
+               stats.min, (uint32_t)(stats.sum / stats.count), stats.max);
+
+        /* Histogram: <2^n: count for every non-empty bin */
+        printf("         ");
+        for (bin = 0u; bin < CYCLE_PROBE_HIST_BINS; bin++)
+        {
+            if (stats.hist[bin] != 0u)
+            {
+                printf(" <2^%" PRIu32 ":%" PRIu32, bin, stats.hist[bin]);
+            }
+        }
+        printf("\r\n");
+    }
+    printf("Group overflow events: %" PRIu32 "\r\n\r\n", g_loss.groupOverruns);
+    fflush(stdout);
+
+    cycle_probe_reset();
+#else
+    uart_tx_flush();
+    printf("\x1b[4E\r\nCycle probes are disabled (CYCLE_PROBE=0)\r\n");
+    printf("Group overflow events: %" PRIu32 "\r\n\r\n", g_loss.groupOverruns);
+    fflush(stdout);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: print_loss_report
+********************************************************************************
+* Summary:
+*  This function prints the loss counters of the acquisition chain below the
+*  result display, then restarts them:
+*  - SAR ADC: results serviced, invalid results, channel result overflows,
+*    and group overflow events
+*  - Stream: results dropped because the sample ring was full, and the number
+*    of places where the stream skips results
+*  - UART: result displays skipped while the previous lines were being sent,
+*    and lines dropped because the transmit queue was full
+*  Stream frames are never dropped: they wait for room in the transmit queue.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void print_loss_report(void)
+{
+    loss_counters_t loss;
+    uint32_t interruptState;
+
+    /* Take and restart the counters in one go, the interrupt handlers update them */
+    interruptState = Cy_SysLib_EnterCriticalSection();
+    loss = g_loss;
+    g_loss = (loss_counters_t){ 0u };
+    Cy_SysLib_ExitCriticalSection(interruptState);
+
+    uart_tx_flush();
+
+    /* \x1b[4E - move the cursor below the 4 result lines */
+    printf("\x1b[4E\r\nResults serviced:        %10" PRIu32 "\r\n", loss.results);
+    printf("Invalid results:         %10" PRIu32 "\r\n", loss.invalidResults);
+    printf("Result overflows:        %10" PRIu32 "\r\n", loss.resultOverflows);
+    printf("Group overflow events:   %10" PRIu32 "\r\n", loss.groupOverruns);
+    printf("Stream ring drops:       %10" PRIu32 " in %" PRIu32 " gaps\r\n", loss.ringDrops, loss.streamGaps);
+    printf("Display updates skipped: %10" PRIu32 "\r\n", loss.displaySkips);
+    printf("UART lines dropped:      %10" PRIu32 "\r\n\r\n", loss.txDrops);
+    fflush(stdout);
+}
+
+/*******************************************************************************
+* Function Name: arm_trigger
+********************************************************************************
+* Summary:
+*  This function arms the pre/post-trigger capture with the given trigger and
+*  prints the trigger settings below the result display. The capture runs on
+*  the decoded AN0 results of every source and is sent by export_capture()
+*  once complete.
+*
+* Parameters:
+*  const trigger_config_t *config - Trigger settings
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void arm_trigger(const trigger_config_t *config)
+{
+    trigger_capture_arm(&g_triggerCapture, config);
+
+    uart_tx_flush();
+
+    /* \x1b[4E - move the cursor below the 4 result lines */
+    printf("\x1b[4E\r\nTrigger armed: %s level 0x%03" PRIX16, TRIGGER_TYPE_STR[config->type], config->level);
+    if (config->type == TRIGGER_WINDOW)
+    {
+        printf(" high 0x%03" PRIX16, config->high);
+    }
+    printf(", %" PRIu16 " pre-trigger and %" PRIu16 " post-trigger samples\r\n\r\n",
+           config->preSamples, config->postSamples);
+    fflush(stdout);
+}
+
+/*******************************************************************************
+* Function Name: export_capture
+********************************************************************************
+* Summary:
+*  This function prints a completed trigger capture below the result display
+*  in CSV format, one line per sample: the sample index relative to the
+*  trigger sample and the decoded AN0 result. The trigger is disarmed
+*  afterwards. Nothing is done while the capture is not complete, and in
+*  stream mode, where the lines would corrupt the frames; the capture is kept
+*  until the stream is stopped.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void export_capture(void)
+{
+    uint16_t window[TRIGGER_CAPTURE_SIZE];
+    uint32_t triggerPos;
+    uint32_t length;
+    uint32_t i;
+
+    if (g_outputMode == OUTPUT_STREAM)
+    {
+        return;
+    }
+
+    length = trigger_capture_read(&g_triggerCapture, window, &triggerPos);
+    if (length == 0u)
+    {
+        return;
+    }
+
+    trigger_capture_disarm(&g_triggerCapture);
+
+    uart_tx_flush();
+
+    printf("\x1b[4E\r\nsample,result\r\n");
+    for (i = 0u; i < length; i++)
+    {
+        printf("%" PRId32 ",%" PRIu16 "\r\n", (int32_t)i - (int32_t)triggerPos, window[i]);
+    }
+    printf("\r\n");
+    fflush(stdout);
 }
 /* [] END OF FILE */
@@ -0,0 +1,184 @@
+/******************************************************************************
+* File Name:   range_monitor.c
+*
+* Description: This file contains the range monitor. It tracks whether the results
+*              of a channel are inside a window, with hysteresis on re-entry, and
+*              gives the SAR2 range detection setting that raises an interrupt on
+*              the next event only. Without range detection, the same monitor is
+*              updated with every result in software.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "range_monitor.h"
+#include "sar2_model.h"
+#include "tcm_placement.h"
+
+/*******************************************************************************
+* Function Name: range_monitor_init
+********************************************************************************
+* Summary:
+*  Starts the monitor inside the window. A first result outside the window
+*  is therefore reported as an event, which gives the initial state.
+*
+* Parameters:
+*  range_monitor_t *mon          - Monitor
+*  const range_window_t *window  - Window of decoded results
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void range_monitor_init(range_monitor_t *mon, const range_window_t *window)
+{
+    mon->window = *window;
+    mon->inside = true;
+    mon->events = 0u;
+}
+
+/*******************************************************************************
+* Function Name: range_monitor_update
+********************************************************************************
+* Summary:
+*  Applies one decoded result. Inside the window, any result outside
+*  [lo, hi] leaves it. Outside, a result must be within
+*  [lo + hysteresis, hi - hysteresis] to enter it again, so that noise at an
+*  edge does not cause a burst of events.
+*
+* Parameters:
+*  range_monitor_t *mon - Monitor
+*  uint16_t result      - Decoded 12-bit result
+*
+* Return:
+*  bool - true if the result left or entered the window, see mon->inside
+*
+*******************************************************************************/
+TCM_CODE bool range_monitor_update(range_monitor_t *mon, uint16_t result)
+{
+    const range_window_t *w = &mon->window;
+    bool inside;
+
+    if (mon->inside)
+    {
+        inside = (result >= w->lo) && (result <= w->hi);
+    }
+    else
+    {
+        inside = (result >= (w->lo + w->hysteresis)) && (result <= (w->hi - w->hysteresis));
+    }
+
+    if (inside == mon->inside)
+    {
+        return false;
+    }
+
+    mon->inside = inside;
+    mon->events++;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: range_monitor_detect
+********************************************************************************
+* Summary:
+*  Gives the range detection setting whose condition is met by the next
+*  result that changes the state of the monitor: outside [lo, hi] while
+*  inside, inside the window narrowed by the hysteresis while outside. The
+*  SAR2 then interrupts on events only. A window edge at the end of the
+*  12-bit range needs no threshold, as its high threshold would not fit the
+*  result register in the left aligned format.
+*
+* Parameters:
+*  const range_monitor_t *mon - Monitor
+*  int32_t outputFormat       - Output format of the channel (enum OutputFmt)
+*  range_detect_t *detect     - Range detection setting
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+TCM_CODE void range_monitor_detect(const range_monitor_t *mon, int32_t outputFormat, range_detect_t *detect)
+{
+    const range_window_t *w = &mon->window;
+    uint32_t lo = w->lo;
+    uint32_t hi = w->hi;
+    bool hasLo;
+    bool hasHi;
+
+    if (!mon->inside)
+    {
+        lo += w->hysteresis;
+        hi -= w->hysteresis;
+    }
+
+    hasLo = (lo != 0u);
+    hasHi = (hi < SAR2_MODEL_CODE_MAX);
+
+    /* The register thresholds are exclusive at the top: hi + 1 is the first result above the window */
+    detect->lo = sar2_model_format(lo, outputFormat);
+    detect->hi = hasHi ? sar2_model_format(hi + 1u, outputFormat) : 0u;
+
+    if (mon->inside)
+    {
+        if (hasLo && hasHi)
+        {
+            detect->mode = SAR2_RANGE_OUTSIDE_RANGE;
+        }
+        else if (hasHi)
+        {
+            detect->mode = SAR2_RANGE_ABOVE_HI;
+        }
+        else
+        {
+            /* Below 0 never occurs if the window covers the whole range */
+            detect->mode = SAR2_RANGE_BELOW_LO;
+        }
+    }
+    else
+    {
+        if (hasHi)
+        {
+            /* With lo = 0, lo <= result always holds */
+            detect->mode = SAR2_RANGE_INSIDE_RANGE;
+        }
+        else
+        {
+            detect->mode = SAR2_RANGE_ABOVE_HI;
+            detect->hi = detect->lo;
+        }
+    }
+}
+/* [] END OF FILE */
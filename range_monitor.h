@@ -0,0 +1,90 @@
+/******************************************************************************
+* File Name:   range_monitor.h
+*
+* Description: This file contains the public interface of the range monitor.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef RANGE_MONITOR_H
+#define RANGE_MONITOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Window of decoded 12-bit results, lo + 2 * hysteresis must not exceed hi */
+typedef struct
+{
+    uint16_t lo;            /* Lowest result inside the window */
+    uint16_t hi;            /* Highest result inside the window */
+    uint16_t hysteresis;    /* Distance from the edges a result needs to re-enter the window */
+} range_window_t;
+
+/* Range detection setting of a SAR2 channel, in result register values */
+typedef struct
+{
+    int32_t mode;   /* enum Sar2RangeMode */
+    uint16_t lo;    /* Low threshold */
+    uint16_t hi;    /* High threshold */
+} range_detect_t;
+
+/* Monitor state */
+typedef struct
+{
+    range_window_t window;
+    bool inside;        /* The last event entered the window */
+    uint32_t events;    /* Number of events */
+} range_monitor_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void range_monitor_init(range_monitor_t *mon, const range_window_t *window);
+bool range_monitor_update(range_monitor_t *mon, uint16_t result);
+void range_monitor_detect(const range_monitor_t *mon, int32_t outputFormat, range_detect_t *detect);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* RANGE_MONITOR_H */
+/* [] END OF FILE */
@@ -0,0 +1,270 @@
+/******************************************************************************
+* File Name:   replay_corpus.c
+*
+* Description: This file contains the built-in corpus of synthetic captures used
+*              by the replay source: a ramp, a sine and a noisy DC level, taken
+*              as unsigned right aligned results with an average count of 1.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "replay.h"
+#include "adc_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Interval between the group-done interrupts of the recorded captures */
+#define REPLAY_CORPUS_PERIOD_US (1000u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Ramp over the full 12-bit range */
+static const replay_record_t RAMP_RECORDS[REPLAY_CAPTURE_SAMPLES] =
+{
+    {  1117u,     0u }, {  1118u,    16u }, {  1120u,    32u }, {  1117u,    48u },
+    {  1117u,    64u }, {  1117u,    80u }, {  1116u,    96u }, {  1118u,   112u },
+    {  1117u,   128u }, {  1119u,   144u }, {  1117u,   160u }, {  1117u,   176u },
+    {  1117u,   192u }, {  1117u,   208u }, {  1118u,   224u }, {  1117u,   240u },
+    {  1117u,   256u }, {  1115u,   273u }, {  1117u,   289u }, {  1117u,   305u },
+    {  1117u,   321u }, {  1120u,   337u }, {  1117u,   353u }, {  1118u,   369u },
+    {  1118u,   385u }, {  1117u,   401u }, {  1116u,   417u }, {  1117u,   433u },
+    {  1118u,   449u }, {  1118u,   465u }, {  1120u,   481u }, {  1118u,   497u },
+    {  1116u,   513u }, {  1116u,   529u }, {  1119u,   546u }, {  1119u,   562u },
+    {  1118u,   578u }, {  1118u,   594u }, {  1117u,   610u }, {  1118u,   626u },
+    {  1118u,   642u }, {  1115u,   658u }, {  1118u,   674u }, {  1118u,   690u },
+    {  1115u,   706u }, {  1119u,   722u }, {  1119u,   738u }, {  1113u,   754u },
+    {  1117u,   770u }, {  1115u,   786u }, {  1117u,   802u }, {  1118u,   819u },
+    {  1118u,   835u }, {  1116u,   851u }, {  1115u,   867u }, {  1115u,   883u },
+    {  1117u,   899u }, {  1116u,   915u }, {  1117u,   931u }, {  1116u,   947u },
+    {  1116u,   963u }, {  1117u,   979u }, {  1116u,   995u }, {  1115u,  1011u },
+    {  1118u,  1027u }, {  1118u,  1043u }, {  1117u,  1059u }, {  1118u,  1075u },
+    {  1117u,  1092u }, {  1116u,  1108u }, {  1117u,  1124u }, {  1117u,  1140u },
+    {  1118u,  1156u }, {  1117u,  1172u }, {  1118u,  1188u }, {  1115u,  1204u },
+    {  1115u,  1220u }, {  1116u,  1236u }, {  1118u,  1252u }, {  1116u,  1268u },
+    {  1117u,  1284u }, {  1116u,  1300u }, {  1116u,  1316u }, {  1116u,  1332u },
+    {  1118u,  1348u }, {  1117u,  1365u }, {  1117u,  1381u }, {  1116u,  1397u },
+    {  1117u,  1413u }, {  1117u,  1429u }, {  1117u,  1445u }, {  1117u,  1461u },
+    {  1116u,  1477u }, {  1116u,  1493u }, {  1115u,  1509u }, {  1117u,  1525u },
+    {  1117u,  1541u }, {  1118u,  1557u }, {  1117u,  1573u }, {  1117u,  1589u },
+    {  1116u,  1605u }, {  1116u,  1621u }, {  1117u,  1638u }, {  1117u,  1654u },
+    {  1116u,  1670u }, {  1120u,  1686u }, {  1117u,  1702u }, {  1117u,  1718u },
+    {  1117u,  1734u }, {  1116u,  1750u }, {  1116u,  1766u }, {  1118u,  1782u },
+    {  1117u,  1798u }, {  1117u,  1814u }, {  1116u,  1830u }, {  1118u,  1846u },
+    {  1117u,  1862u }, {  1115u,  1878u }, {  1118u,  1894u }, {  1115u,  1911u },
+    {  1117u,  1927u }, {  1118u,  1943u }, {  1117u,  1959u }, {  1117u,  1975u },
+    {  1117u,  1991u }, {  1116u,  2007u }, {  1117u,  2023u }, {  1117u,  2039u },
+    {  1117u,  2055u }, {  1119u,  2071u }, {  1116u,  2087u }, {  1118u,  2103u },
+    {  1117u,  2119u }, {  1118u,  2135u }, {  1119u,  2151u }, {  1116u,  2167u },
+    {  1118u,  2184u }, {  1118u,  2200u }, {  1118u,  2216u }, {  1116u,  2232u },
+    {  1116u,  2248u }, {  1116u,  2264u }, {  1116u,  2280u }, {  1117u,  2296u },
+    {  1118u,  2312u }, {  1118u,  2328u }, {  1118u,  2344u }, {  1118u,  2360u },
+    {  1116u,  2376u }, {  1116u,  2392u }, {  1117u,  2408u }, {  1119u,  2424u },
+    {  1116u,  2440u }, {  1116u,  2457u }, {  1117u,  2473u }, {  1116u,  2489u },
+    {  1116u,  2505u }, {  1117u,  2521u }, {  1117u,  2537u }, {  1117u,  2553u },
+    {  1119u,  2569u }, {  1116u,  2585u }, {  1119u,  2601u }, {  1115u,  2617u },
+    {  1119u,  2633u }, {  1117u,  2649u }, {  1118u,  2665u }, {  1116u,  2681u },
+    {  1117u,  2697u }, {  1118u,  2713u }, {  1116u,  2730u }, {  1117u,  2746u },
+    {  1117u,  2762u }, {  1116u,  2778u }, {  1117u,  2794u }, {  1118u,  2810u },
+    {  1116u,  2826u }, {  1119u,  2842u }, {  1116u,  2858u }, {  1117u,  2874u },
+    {  1115u,  2890u }, {  1117u,  2906u }, {  1118u,  2922u }, {  1116u,  2938u },
+    {  1117u,  2954u }, {  1117u,  2970u }, {  1117u,  2986u }, {  1118u,  3003u },
+    {  1115u,  3019u }, {  1117u,  3035u }, {  1117u,  3051u }, {  1117u,  3067u },
+    {  1117u,  3083u }, {  1117u,  3099u }, {  1117u,  3115u }, {  1116u,  3131u },
+    {  1118u,  3147u }, {  1117u,  3163u }, {  1119u,  3179u }, {  1118u,  3195u },
+    {  1118u,  3211u }, {  1118u,  3227u }, {  1116u,  3243u }, {  1117u,  3259u },
+    {  1118u,  3276u }, {  1116u,  3292u }, {  1118u,  3308u }, {  1117u,  3324u },
+    {  1116u,  3340u }, {  1116u,  3356u }, {  1117u,  3372u }, {  1117u,  3388u },
+    {  1115u,  3404u }, {  1117u,  3420u }, {  1118u,  3436u }, {  1117u,  3452u },
+    {  1116u,  3468u }, {  1118u,  3484u }, {  1117u,  3500u }, {  1117u,  3516u },
+    {  1117u,  3532u }, {  1117u,  3549u }, {  1116u,  3565u }, {  1118u,  3581u },
+    {  1118u,  3597u }, {  1118u,  3613u }, {  1117u,  3629u }, {  1117u,  3645u },
+    {  1117u,  3661u }, {  1117u,  3677u }, {  1118u,  3693u }, {  1118u,  3709u },
+    {  1117u,  3725u }, {  1119u,  3741u }, {  1116u,  3757u }, {  1116u,  3773u },
+    {  1119u,  3789u }, {  1118u,  3805u }, {  1116u,  3822u }, {  1117u,  3838u },
+    {  1117u,  3854u }, {  1117u,  3870u }, {  1116u,  3886u }, {  1117u,  3902u },
+    {  1117u,  3918u }, {  1116u,  3934u }, {  1116u,  3950u }, {  1117u,  3966u },
+    {  1116u,  3982u }, {  1116u,  3998u }, {  1117u,  4014u }, {  1117u,  4030u },
+    {  1115u,  4046u }, {  1117u,  4062u }, {  1116u,  4078u }, {  1117u,  4095u }
+};
+
+/* Four periods of a sine around mid scale */
+static const replay_record_t SINE_RECORDS[REPLAY_CAPTURE_SAMPLES] =
+{
+    {  1117u,  2048u }, {  1116u,  2224u }, {  1118u,  2399u }, {  1116u,  2571u },
+    {  1118u,  2737u }, {  1118u,  2897u }, {  1118u,  3048u }, {  1119u,  3190u },
+    {  1117u,  3321u }, {  1119u,  3439u }, {  1118u,  3545u }, {  1117u,  3635u },
+    {  1117u,  3711u }, {  1116u,  3770u }, {  1115u,  3813u }, {  1119u,  3839u },
+    {  1118u,  3848u }, {  1116u,  3839u }, {  1118u,  3813u }, {  1117u,  3770u },
+    {  1116u,  3711u }, {  1119u,  3635u }, {  1117u,  3545u }, {  1117u,  3439u },
+    {  1118u,  3321u }, {  1116u,  3190u }, {  1116u,  3048u }, {  1117u,  2897u },
+    {  1117u,  2737u }, {  1117u,  2571u }, {  1117u,  2399u }, {  1117u,  2224u },
+    {  1116u,  2048u }, {  1117u,  1872u }, {  1118u,  1697u }, {  1116u,  1525u },
+    {  1117u,  1359u }, {  1117u,  1199u }, {  1117u,  1048u }, {  1119u,   906u },
+    {  1119u,   775u }, {  1118u,   657u }, {  1119u,   551u }, {  1116u,   461u },
+    {  1115u,   385u }, {  1115u,   326u }, {  1117u,   283u }, {  1116u,   257u },
+    {  1119u,   248u }, {  1117u,   257u }, {  1117u,   283u }, {  1117u,   326u },
+    {  1116u,   385u }, {  1116u,   461u }, {  1117u,   551u }, {  1115u,   657u },
+    {  1117u,   775u }, {  1117u,   906u }, {  1116u,  1048u }, {  1118u,  1199u },
+    {  1119u,  1359u }, {  1117u,  1525u }, {  1117u,  1697u }, {  1117u,  1872u },
+    {  1117u,  2048u }, {  1117u,  2224u }, {  1116u,  2399u }, {  1117u,  2571u },
+    {  1117u,  2737u }, {  1117u,  2897u }, {  1117u,  3048u }, {  1117u,  3190u },
+    {  1117u,  3321u }, {  1117u,  3439u }, {  1116u,  3545u }, {  1117u,  3635u },
+    {  1118u,  3711u }, {  1116u,  3770u }, {  1117u,  3813u }, {  1118u,  3839u },
+    {  1116u,  3848u }, {  1117u,  3839u }, {  1116u,  3813u }, {  1116u,  3770u },
+    {  1117u,  3711u }, {  1117u,  3635u }, {  1118u,  3545u }, {  1117u,  3439u },
+    {  1117u,  3321u }, {  1116u,  3190u }, {  1116u,  3048u }, {  1118u,  2897u },
+    {  1117u,  2737u }, {  1116u,  2571u }, {  1118u,  2399u }, {  1118u,  2224u },
+    {  1118u,  2048u }, {  1118u,  1872u }, {  1117u,  1697u }, {  1116u,  1525u },
+    {  1117u,  1359u }, {  1116u,  1199u }, {  1115u,  1048u }, {  1117u,   906u },
+    {  1116u,   775u }, {  1117u,   657u }, {  1117u,   551u }, {  1118u,   461u },
+    {  1117u,   385u }, {  1118u,   326u }, {  1117u,   283u }, {  1117u,   257u },
+    {  1116u,   248u }, {  1117u,   257u }, {  1118u,   283u }, {  1117u,   326u },
+    {  1114u,   385u }, {  1118u,   461u }, {  1118u,   551u }, {  1116u,   657u },
+    {  1117u,   775u }, {  1118u,   906u }, {  1117u,  1048u }, {  1119u,  1199u },
+    {  1117u,  1359u }, {  1116u,  1525u }, {  1116u,  1697u }, {  1117u,  1872u },
+    {  1117u,  2048u }, {  1118u,  2224u }, {  1118u,  2399u }, {  1117u,  2571u },
+    {  1117u,  2737u }, {  1117u,  2897u }, {  1117u,  3048u }, {  1118u,  3190u },
+    {  1117u,  3321u }, {  1117u,  3439u }, {  1117u,  3545u }, {  1116u,  3635u },
+    {  1115u,  3711u }, {  1118u,  3770u }, {  1117u,  3813u }, {  1117u,  3839u },
+    {  1118u,  3848u }, {  1118u,  3839u }, {  1119u,  3813u }, {  1116u,  3770u },
+    {  1118u,  3711u }, {  1117u,  3635u }, {  1117u,  3545u }, {  1115u,  3439u },
+    {  1118u,  3321u }, {  1117u,  3190u }, {  1118u,  3048u }, {  1117u,  2897u },
+    {  1118u,  2737u }, {  1116u,  2571u }, {  1116u,  2399u }, {  1116u,  2224u },
+    {  1115u,  2048u }, {  1116u,  1872u }, {  1116u,  1697u }, {  1117u,  1525u },
+    {  1117u,  1359u }, {  1117u,  1199u }, {  1115u,  1048u }, {  1117u,   906u },
+    {  1118u,   775u }, {  1118u,   657u }, {  1117u,   551u }, {  1117u,   461u },
+    {  1117u,   385u }, {  1117u,   326u }, {  1117u,   283u }, {  1117u,   257u },
+    {  1116u,   248u }, {  1116u,   257u }, {  1119u,   283u }, {  1118u,   326u },
+    {  1116u,   385u }, {  1118u,   461u }, {  1117u,   551u }, {  1115u,   657u },
+    {  1117u,   775u }, {  1117u,   906u }, {  1117u,  1048u }, {  1116u,  1199u },
+    {  1117u,  1359u }, {  1116u,  1525u }, {  1119u,  1697u }, {  1117u,  1872u },
+    {  1116u,  2048u }, {  1117u,  2224u }, {  1118u,  2399u }, {  1116u,  2571u },
+    {  1119u,  2737u }, {  1116u,  2897u }, {  1118u,  3048u }, {  1117u,  3190u },
+    {  1115u,  3321u }, {  1116u,  3439u }, {  1117u,  3545u }, {  1116u,  3635u },
+    {  1116u,  3711u }, {  1116u,  3770u }, {  1118u,  3813u }, {  1116u,  3839u },
+    {  1116u,  3848u }, {  1117u,  3839u }, {  1117u,  3813u }, {  1116u,  3770u },
+    {  1120u,  3711u }, {  1119u,  3635u }, {  1117u,  3545u }, {  1118u,  3439u },
+    {  1117u,  3321u }, {  1118u,  3190u }, {  1116u,  3048u }, {  1115u,  2897u },
+    {  1116u,  2737u }, {  1118u,  2571u }, {  1117u,  2399u }, {  1116u,  2224u },
+    {  1116u,  2048u }, {  1116u,  1872u }, {  1117u,  1697u }, {  1117u,  1525u },
+    {  1117u,  1359u }, {  1116u,  1199u }, {  1117u,  1048u }, {  1118u,   906u },
+    {  1117u,   775u }, {  1117u,   657u }, {  1119u,   551u }, {  1117u,   461u },
+    {  1116u,   385u }, {  1117u,   326u }, {  1117u,   283u }, {  1118u,   257u },
+    {  1117u,   248u }, {  1117u,   257u }, {  1114u,   283u }, {  1116u,   326u },
+    {  1117u,   385u }, {  1118u,   461u }, {  1116u,   551u }, {  1118u,   657u },
+    {  1118u,   775u }, {  1118u,   906u }, {  1119u,  1048u }, {  1118u,  1199u },
+    {  1117u,  1359u }, {  1116u,  1525u }, {  1118u,  1697u }, {  1118u,  1872u }
+};
+
+/* Mid scale DC with Gaussian noise (sigma 12 counts) */
+static const replay_record_t NOISE_RECORDS[REPLAY_CAPTURE_SAMPLES] =
+{
+    {  1118u,  2023u }, {  1117u,  2045u }, {  1118u,  2034u }, {  1117u,  2048u },
+    {  1117u,  2046u }, {  1118u,  2039u }, {  1117u,  2048u }, {  1120u,  2072u },
+    {  1118u,  2062u }, {  1116u,  2066u }, {  1116u,  2041u }, {  1117u,  2048u },
+    {  1119u,  2032u }, {  1119u,  2056u }, {  1116u,  2045u }, {  1117u,  2060u },
+    {  1115u,  2062u }, {  1117u,  2046u }, {  1118u,  2033u }, {  1117u,  2054u },
+    {  1117u,  2076u }, {  1118u,  2046u }, {  1116u,  2052u }, {  1117u,  2042u },
+    {  1116u,  2053u }, {  1118u,  2054u }, {  1117u,  2063u }, {  1118u,  2051u },
+    {  1118u,  2049u }, {  1117u,  2045u }, {  1116u,  2060u }, {  1119u,  2039u },
+    {  1116u,  2060u }, {  1115u,  2062u }, {  1116u,  2057u }, {  1118u,  2039u },
+    {  1117u,  2034u }, {  1115u,  2037u }, {  1117u,  2043u }, {  1117u,  2039u },
+    {  1117u,  2040u }, {  1118u,  2036u }, {  1117u,  2053u }, {  1115u,  2040u },
+    {  1115u,  2048u }, {  1116u,  2071u }, {  1115u,  2072u }, {  1117u,  2055u },
+    {  1116u,  2054u }, {  1117u,  2054u }, {  1117u,  2052u }, {  1118u,  2059u },
+    {  1118u,  2053u }, {  1116u,  2029u }, {  1117u,  2044u }, {  1118u,  2040u },
+    {  1115u,  2070u }, {  1116u,  2027u }, {  1117u,  2051u }, {  1117u,  2041u },
+    {  1116u,  2057u }, {  1118u,  2061u }, {  1119u,  2048u }, {  1117u,  2045u },
+    {  1116u,  2046u }, {  1118u,  2036u }, {  1117u,  2059u }, {  1117u,  2054u },
+    {  1118u,  2063u }, {  1117u,  2039u }, {  1117u,  2048u }, {  1115u,  2044u },
+    {  1117u,  2053u }, {  1116u,  2059u }, {  1116u,  2048u }, {  1118u,  2044u },
+    {  1117u,  2051u }, {  1117u,  2058u }, {  1118u,  2072u }, {  1117u,  2046u },
+    {  1116u,  2052u }, {  1118u,  2042u }, {  1117u,  2061u }, {  1116u,  2058u },
+    {  1117u,  2038u }, {  1115u,  2047u }, {  1117u,  2044u }, {  1117u,  2044u },
+    {  1117u,  2026u }, {  1116u,  2041u }, {  1117u,  2074u }, {  1118u,  2054u },
+    {  1117u,  2023u }, {  1117u,  2024u }, {  1119u,  2052u }, {  1118u,  2062u },
+    {  1117u,  2044u }, {  1116u,  2064u }, {  1119u,  2044u }, {  1117u,  2050u },
+    {  1118u,  2044u }, {  1116u,  2051u }, {  1118u,  2035u }, {  1117u,  2047u },
+    {  1115u,  2036u }, {  1118u,  2045u }, {  1117u,  2061u }, {  1119u,  2046u },
+    {  1116u,  2061u }, {  1117u,  2062u }, {  1118u,  2052u }, {  1116u,  2042u },
+    {  1118u,  2023u }, {  1117u,  2057u }, {  1116u,  2038u }, {  1117u,  2063u },
+    {  1117u,  2031u }, {  1118u,  2023u }, {  1117u,  2053u }, {  1117u,  2061u },
+    {  1119u,  2053u }, {  1117u,  2055u }, {  1118u,  2049u }, {  1117u,  2061u },
+    {  1118u,  2038u }, {  1116u,  2044u }, {  1116u,  2055u }, {  1118u,  2062u },
+    {  1117u,  2051u }, {  1118u,  2062u }, {  1118u,  2041u }, {  1118u,  2080u },
+    {  1117u,  2057u }, {  1118u,  2068u }, {  1116u,  2044u }, {  1115u,  2016u },
+    {  1117u,  2053u }, {  1118u,  2070u }, {  1118u,  2060u }, {  1117u,  2051u },
+    {  1118u,  2035u }, {  1117u,  2052u }, {  1115u,  2034u }, {  1118u,  2066u },
+    {  1117u,  2042u }, {  1116u,  2034u }, {  1118u,  2032u }, {  1114u,  2052u },
+    {  1116u,  2054u }, {  1116u,  2044u }, {  1116u,  2051u }, {  1118u,  2055u },
+    {  1117u,  2064u }, {  1116u,  2066u }, {  1116u,  2058u }, {  1117u,  2040u },
+    {  1119u,  2050u }, {  1117u,  2041u }, {  1117u,  2040u }, {  1116u,  2033u },
+    {  1119u,  2041u }, {  1118u,  2051u }, {  1118u,  2034u }, {  1118u,  2052u },
+    {  1117u,  2022u }, {  1118u,  2042u }, {  1117u,  2040u }, {  1117u,  2058u },
+    {  1117u,  2040u }, {  1116u,  2039u }, {  1115u,  2048u }, {  1119u,  2059u },
+    {  1116u,  2041u }, {  1117u,  2036u }, {  1117u,  2054u }, {  1118u,  2042u },
+    {  1117u,  2046u }, {  1116u,  2046u }, {  1116u,  2060u }, {  1117u,  2040u },
+    {  1118u,  2040u }, {  1117u,  2048u }, {  1115u,  2053u }, {  1117u,  2066u },
+    {  1116u,  2025u }, {  1116u,  2060u }, {  1118u,  2053u }, {  1118u,  2060u },
+    {  1117u,  2049u }, {  1117u,  2045u }, {  1118u,  2040u }, {  1115u,  2033u },
+    {  1118u,  2056u }, {  1118u,  2050u }, {  1118u,  2033u }, {  1117u,  2052u },
+    {  1117u,  2059u }, {  1118u,  2052u }, {  1118u,  2038u }, {  1116u,  2042u },
+    {  1117u,  2061u }, {  1116u,  2040u }, {  1116u,  2047u }, {  1116u,  2041u },
+    {  1117u,  2070u }, {  1119u,  2039u }, {  1118u,  2058u }, {  1117u,  2037u },
+    {  1117u,  2041u }, {  1116u,  2062u }, {  1116u,  2029u }, {  1118u,  2052u },
+    {  1120u,  2041u }, {  1118u,  2052u }, {  1114u,  2035u }, {  1116u,  2029u },
+    {  1119u,  2062u }, {  1116u,  2055u }, {  1116u,  2043u }, {  1119u,  2037u },
+    {  1118u,  2032u }, {  1117u,  2060u }, {  1116u,  2038u }, {  1116u,  2042u },
+    {  1115u,  2028u }, {  1116u,  2049u }, {  1117u,  2054u }, {  1117u,  2043u },
+    {  1118u,  2051u }, {  1117u,  2037u }, {  1117u,  2045u }, {  1118u,  2033u },
+    {  1115u,  2044u }, {  1119u,  2035u }, {  1115u,  2052u }, {  1116u,  2057u },
+    {  1118u,  2055u }, {  1118u,  2058u }, {  1117u,  2046u }, {  1118u,  2038u },
+    {  1117u,  2046u }, {  1118u,  2032u }, {  1115u,  2049u }, {  1118u,  2057u },
+    {  1115u,  2041u }, {  1116u,  2050u }, {  1117u,  2045u }, {  1118u,  2032u },
+    {  1118u,  2030u }, {  1117u,  2074u }, {  1117u,  2057u }, {  1117u,  2041u },
+    {  1116u,  2060u }, {  1118u,  2050u }, {  1119u,  2041u }, {  1116u,  2040u }
+};
+
+const replay_capture_t REPLAY_CORPUS[] =
+{
+    { "ramp",  UNSIGNED_RIGHT_ALIGNED, 1, REPLAY_CORPUS_PERIOD_US, REPLAY_CAPTURE_SAMPLES, RAMP_RECORDS },
+    { "sine",  UNSIGNED_RIGHT_ALIGNED, 1, REPLAY_CORPUS_PERIOD_US, REPLAY_CAPTURE_SAMPLES, SINE_RECORDS },
+    { "noise", UNSIGNED_RIGHT_ALIGNED, 1, REPLAY_CORPUS_PERIOD_US, REPLAY_CAPTURE_SAMPLES, NOISE_RECORDS }
+};
+
+const uint32_t REPLAY_CORPUS_NUM = sizeof(REPLAY_CORPUS) / sizeof(REPLAY_CORPUS[0]);
+/* [] END OF FILE */
@@ -0,0 +1,136 @@
+/******************************************************************************
+* File Name:   sample_ring.c
+*
+* Description: This file contains the single-producer single-consumer ring buffer
+*              that passes conversion results from the SAR ADC interrupt handler
+*              to the main loop. The ring is lock free and uses data memory
+*              barriers, so producer and consumer may also run on different
+*              cores sharing the ring memory.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "sample_ring.h"
+#include "tcm_placement.h"
+
+/*******************************************************************************
+* Function Name: sample_ring_reset
+********************************************************************************
+* Summary:
+*  Empties the ring. Must not be called while the producer or the consumer is
+*  active.
+*
+* Parameters:
+*  sample_ring_t *ring - Ring to be reset
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sample_ring_reset(sample_ring_t *ring)
+{
+    ring->head = 0u;
+    ring->tail = 0u;
+}
+
+/*******************************************************************************
+* Function Name: sample_ring_push
+********************************************************************************
+* Summary:
+*  Appends a sample to the ring. Called by the producer only.
+*
+* Parameters:
+*  sample_ring_t *ring        - Ring to be written
+*  const adc_sample_t *sample - Sample to be appended
+*
+* Return:
+*  bool - false if the ring is full and the sample was dropped
+*
+*******************************************************************************/
+TCM_CODE bool sample_ring_push(sample_ring_t *ring, const adc_sample_t *sample)
+{
+    uint32_t head = ring->head;
+
+    if ((head - ring->tail) >= SAMPLE_RING_SIZE)
+    {
+        return false;
+    }
+
+    /* The consumer must have finished reading the entry before it is overwritten */
+    SAMPLE_RING_BARRIER();
+
+    ring->buf[head & (SAMPLE_RING_SIZE - 1u)] = *sample;
+
+    /* The entry must be visible before the consumer can see the new head */
+    SAMPLE_RING_BARRIER();
+    ring->head = head + 1u;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sample_ring_pop
+********************************************************************************
+* Summary:
+*  Removes the oldest sample from the ring. Called by the consumer only.
+*
+* Parameters:
+*  sample_ring_t *ring  - Ring to be read
+*  adc_sample_t *sample - Receives the sample
+*
+* Return:
+*  bool - false if the ring is empty
+*
+*******************************************************************************/
+bool sample_ring_pop(sample_ring_t *ring, adc_sample_t *sample)
+{
+    uint32_t tail = ring->tail;
+
+    if (ring->head == tail)
+    {
+        return false;
+    }
+
+    /* The entry must not be read before the head that published it */
+    SAMPLE_RING_BARRIER();
+    *sample = ring->buf[tail & (SAMPLE_RING_SIZE - 1u)];
+
+    /* The entry must have been read before the producer can reuse it */
+    SAMPLE_RING_BARRIER();
+    ring->tail = tail + 1u;
+
+    return true;
+}
+/* [] END OF FILE */
@@ -0,0 +1,118 @@
+/******************************************************************************
+* File Name:   sample_ring.h
+*
+* Description: This file contains the single-producer single-consumer ring buffer
+*              that passes conversion results from the SAR ADC interrupt handler
+*              to the main loop.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__ARM_ARCH)
+#include "cy_pdl.h"
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of entries in the ring, must be a power of two */
+#define SAMPLE_RING_SIZE (256u)
+
+/* Data cache line size of the Cortex-M7. The producer and consumer indexes
+ * are kept on separate lines so that the two sides never write to the same
+ * line when they run on different cores.
+ */
+#define SAMPLE_RING_CACHE_LINE (32u)
+
+/* Orders the accesses to the entries against the index updates. A data
+ * memory barrier is needed once producer and consumer run on different
+ * cores; on a single core it only costs a few cycles.
+ */
+#if defined(__ARM_ARCH)
+#define SAMPLE_RING_BARRIER()   __DMB()
+#else
+#define SAMPLE_RING_BARRIER()   __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* One processed conversion result, with the settings it was converted with */
+typedef struct
+{
+    uint16_t resultAN0;
+    uint16_t resultVBG;
+    uint32_t timestamp;     /* cycle_probe_now() when the result was processed */
+    uint16_t averageCount;
+    uint8_t outputFormat;
+} adc_sample_t;
+
+/* Ring state. head is only written by the producer, tail only by the consumer.
+ * When the producer and the consumer run on different cores, the ring must be
+ * placed in memory shared by both and not cached by either of them, and aligned
+ * to SAMPLE_RING_CACHE_LINE.
+ */
+typedef struct
+{
+    volatile uint32_t head;
+    uint8_t headPad[SAMPLE_RING_CACHE_LINE - sizeof(uint32_t)];
+    volatile uint32_t tail;
+    uint8_t tailPad[SAMPLE_RING_CACHE_LINE - sizeof(uint32_t)];
+    adc_sample_t buf[SAMPLE_RING_SIZE];
+} sample_ring_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void sample_ring_reset(sample_ring_t *ring);
+bool sample_ring_push(sample_ring_t *ring, const adc_sample_t *sample);
+bool sample_ring_pop(sample_ring_t *ring, adc_sample_t *sample);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SAMPLE_RING_H */
+/* [] END OF FILE */
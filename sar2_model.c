@@ -0,0 +1,198 @@
+/******************************************************************************
+* File Name:   sar2_model.c
+*
+* Description: This file contains a model of the SAR2 channel post-processing that
+*              configure_SAR_ADC() programs: accumulation of averageCount
+*              conversions, right shift, result alignment and sign extension. It
+*              turns 12-bit conversion codes into the values read by
+*              Cy_SAR2_Channel_GetResult(), so recorded or synthetic codes can be
+*              processed as if they came from the hardware. The range
+*              detection of the channel, which raises the range interrupt, is
+*              modelled as well.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "sar2_model.h"
+#include "adc_result.h"
+
+/*******************************************************************************
+* Function Name: sar2_model_right_shift
+********************************************************************************
+* Summary:
+*  Returns the right shift that scales the sum of averageCount conversions
+*  back to 12 bits, i.e. log2(averageCount) for the power of two average
+*  counts supported by the SAR2.
+*
+* Parameters:
+*  uint32_t averageCount - Average count (1 to 256, power of two)
+*
+* Return:
+*  uint8_t - Right shift
+*
+*******************************************************************************/
+uint8_t sar2_model_right_shift(uint32_t averageCount)
+{
+    uint8_t shift = 0u;
+
+    while ((averageCount >> (shift + 1u)) != 0u)
+    {
+        shift++;
+    }
+
+    return shift;
+}
+
+/*******************************************************************************
+* Function Name: sar2_model_format
+********************************************************************************
+* Summary:
+*  Applies the result alignment and sign extension of an output format to a
+*  12-bit result.
+*   - Unsigned/Right aligned: the result as is
+*   - Signed/Right aligned: the result relative to mid scale (0x800) as a
+*     two's complement value, sign extended to 16 bits
+*   - Left aligned: the result in bits [15:4]
+*
+* Parameters:
+*  uint32_t result      - 12-bit result
+*  int32_t outputFormat - Output format (enum OutputFmt)
+*
+* Return:
+*  uint16_t - Value as read from the result register
+*
+*******************************************************************************/
+uint16_t sar2_model_format(uint32_t result, int32_t outputFormat)
+{
+    result &= SAR2_MODEL_CODE_MAX;
+
+    if (outputFormat == SIGNED_RIGHT_ALIGNED)
+    {
+        return (uint16_t)((int32_t)result - 0x800);
+    }
+    else if (outputFormat == LEFT_ALIGNED)
+    {
+        return (uint16_t)(result << (16u - SAR2_MODEL_CODE_BITS));
+    }
+    else
+    {
+        return (uint16_t)result;
+    }
+}
+
+/*******************************************************************************
+* Function Name: sar2_model_result
+********************************************************************************
+* Summary:
+*  Computes the result register value of one averaged conversion.
+*
+* Parameters:
+*  const uint16_t *codes - averageCount consecutive 12-bit conversion codes
+*  uint32_t averageCount - Average count
+*  uint8_t rightShift    - Right shift applied to the accumulated codes
+*  int32_t outputFormat  - Output format (enum OutputFmt)
+*
+* Return:
+*  uint16_t - Value as read from the result register
+*
+*******************************************************************************/
+uint16_t sar2_model_result(const uint16_t *codes, uint32_t averageCount, uint8_t rightShift,
+                           int32_t outputFormat)
+{
+    uint32_t sum = 0u;
+    uint32_t i;
+
+    for (i = 0u; i < averageCount; i++)
+    {
+        sum += codes[i];
+    }
+
+    return sar2_model_format(sum >> rightShift, outputFormat);
+}
+
+/*******************************************************************************
+* Function Name: sar2_model_range_hit
+********************************************************************************
+* Summary:
+*  Tells whether a result meets the range detection condition of its channel,
+*  in which case the SAR2 sets the range flag of the result and raises the
+*  range interrupt (CY_SAR2_INT_CH_RANGE). The thresholds are compared with
+*  the result register value, as signed numbers in the signed output format.
+*
+* Parameters:
+*  uint16_t result      - Value as read from the result register
+*  int32_t rangeMode    - Range detection mode (enum Sar2RangeMode)
+*  uint16_t lo          - Low threshold
+*  uint16_t hi          - High threshold
+*  int32_t outputFormat - Output format (enum OutputFmt)
+*
+* Return:
+*  bool - true if the condition is met
+*
+*******************************************************************************/
+bool sar2_model_range_hit(uint16_t result, int32_t rangeMode, uint16_t lo, uint16_t hi, int32_t outputFormat)
+{
+    int32_t value = result;
+    int32_t low = lo;
+    int32_t high = hi;
+    bool below;
+    bool above;
+
+    if (outputFormat == SIGNED_RIGHT_ALIGNED)
+    {
+        value = (int16_t)result;
+        low = (int16_t)lo;
+        high = (int16_t)hi;
+    }
+
+    below = (value < low);
+    above = (value >= high);
+
+    switch (rangeMode)
+    {
+        case SAR2_RANGE_BELOW_LO:
+            return below;
+
+        case SAR2_RANGE_INSIDE_RANGE:
+            return !below && !above;
+
+        case SAR2_RANGE_ABOVE_HI:
+            return above;
+
+        default:
+            return below || above;
+    }
+}
+/* [] END OF FILE */
@@ -0,0 +1,85 @@
+/******************************************************************************
+* File Name:   sar2_model.h
+*
+* Description: This file contains the interface of the model of the SAR2 result
+*              post-processing and range detection.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef SAR2_MODEL_H
+#define SAR2_MODEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Resolution of one SAR2 conversion */
+#define SAR2_MODEL_CODE_BITS (12u)
+#define SAR2_MODEL_CODE_MAX  ((1u << SAR2_MODEL_CODE_BITS) - 1u)
+
+/* Largest average count of a channel */
+#define SAR2_MODEL_AVERAGE_MAX (256u)
+
+/* Range detection modes, in the order of cy_en_sar2_range_detection_mode_t */
+enum Sar2RangeMode
+{
+    SAR2_RANGE_BELOW_LO,        /* result < lo */
+    SAR2_RANGE_INSIDE_RANGE,    /* lo <= result < hi */
+    SAR2_RANGE_ABOVE_HI,        /* hi <= result */
+    SAR2_RANGE_OUTSIDE_RANGE    /* result < lo or hi <= result */
+};
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t sar2_model_right_shift(uint32_t averageCount);
+uint16_t sar2_model_format(uint32_t result, int32_t outputFormat);
+uint16_t sar2_model_result(const uint16_t *codes, uint32_t averageCount, uint8_t rightShift,
+                           int32_t outputFormat);
+bool sar2_model_range_hit(uint16_t result, int32_t rangeMode, uint16_t lo, uint16_t hi, int32_t outputFormat);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SAR2_MODEL_H */
+/* [] END OF FILE */
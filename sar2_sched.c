@@ -0,0 +1,445 @@
+/******************************************************************************
+* File Name:   sar2_sched.c
+*
+* Description: This file contains the SAR2 channel group scheduling model. It
+*              runs the triggers of a set of channel groups cycle by cycle
+*              through the arbitration and preemption rules of a SAR2 unit and
+*              reports the latency, preemptions, cancellations and lost
+*              triggers of every group, so that priority assignments can be
+*              checked for priority inversion and starvation on a PC. It
+*              also assigns the priorities and preemption types of critical
+*              and background groups from their latency budgets.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "sar2_sched.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* No group is converting */
+#define GROUP_NONE (-1)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Run time state of a group */
+typedef struct
+{
+    bool pending;               /* Triggered and not done yet */
+    uint32_t channel;           /* Channel being converted or converted next */
+    uint32_t remaining;         /* Cycles left of the current channel, 0 if not started */
+    uint32_t triggerTime;
+} group_state_t;
+
+/*******************************************************************************
+* Function Name: select_group
+********************************************************************************
+* Summary:
+*  Returns the pending group that wins the arbitration: the highest priority,
+*  and the lowest group index among groups of equal priority.
+*
+*******************************************************************************/
+static int32_t select_group(const sar2_sched_group_t *groups, const group_state_t *state, uint32_t groupNum)
+{
+    int32_t best = GROUP_NONE;
+    uint32_t i;
+
+    for (i = 0u; i < groupNum; i++)
+    {
+        if (state[i].pending && ((best == GROUP_NONE) || (groups[i].priority < groups[best].priority)))
+        {
+            best = (int32_t)i;
+        }
+    }
+
+    return best;
+}
+
+/*******************************************************************************
+* Function Name: sar2_sched_run
+********************************************************************************
+* Summary:
+*  Simulates the given channel groups for a number of SAR clock cycles. Each
+*  cycle:
+*  - A trigger of a group that is still pending is lost (group overflow),
+*    otherwise the group becomes pending.
+*  - When a pending group has a strictly higher priority than the converting
+*    one, the converting group is preempted according to its preemption type.
+*    A FINISH_RESUME group is preempted at the end of its current channel.
+*    Groups of equal priority never preempt each other.
+*  - When no group is converting, the arbitration winner starts or resumes.
+*
+* Parameters:
+*  const sar2_sched_group_t *groups - Channel groups, in channel order
+*  uint32_t groupNum                - Number of groups, up to SAR2_SCHED_GROUPS_MAX
+*  uint32_t cycles                  - Simulated time in SAR clock cycles
+*  sar2_sched_stats_t *stats        - Receives the outcome of every group
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sar2_sched_run(const sar2_sched_group_t *groups, uint32_t groupNum, uint32_t cycles,
+                    sar2_sched_stats_t *stats)
+{
+    group_state_t state[SAR2_SCHED_GROUPS_MAX];
+    int32_t active = GROUP_NONE;
+    int32_t winner;
+    uint32_t t;
+    uint32_t i;
+
+    if (groupNum > SAR2_SCHED_GROUPS_MAX)
+    {
+        groupNum = SAR2_SCHED_GROUPS_MAX;
+    }
+
+    for (i = 0u; i < groupNum; i++)
+    {
+        state[i].pending = false;
+        state[i].channel = 0u;
+        state[i].remaining = 0u;
+        state[i].triggerTime = 0u;
+
+        stats[i].triggers = 0u;
+        stats[i].completed = 0u;
+        stats[i].cancelled = 0u;
+        stats[i].overflows = 0u;
+        stats[i].preempted = 0u;
+        stats[i].latencyMin = UINT32_MAX;
+        stats[i].latencyMax = 0u;
+        stats[i].latencySum = 0u;
+    }
+
+    for (t = 0u; t < cycles; t++)
+    {
+        /* Triggers */
+        for (i = 0u; i < groupNum; i++)
+        {
+            const sar2_sched_group_t *group = &groups[i];
+
+            if ((group->triggerPeriod == 0u) || (t < group->triggerOffset) ||
+                (((t - group->triggerOffset) % group->triggerPeriod) != 0u))
+            {
+                continue;
+            }
+
+            if (state[i].pending)
+            {
+                stats[i].overflows++;
+            }
+            else
+            {
+                state[i].pending = true;
+                state[i].channel = 0u;
+                state[i].remaining = 0u;
+                state[i].triggerTime = t;
+                stats[i].triggers++;
+            }
+        }
+
+        /* Preemption of the converting group */
+        winner = select_group(groups, state, groupNum);
+        if ((active != GROUP_NONE) && (winner != active) &&
+            (groups[winner].priority < groups[active].priority))
+        {
+            group_state_t *preempted = &state[active];
+
+            if (groups[active].preemptionType != SAR2_PREEMPTION_FINISH_RESUME)
+            {
+                stats[active].preempted++;
+            }
+
+            switch (groups[active].preemptionType)
+            {
+                case SAR2_PREEMPTION_ABORT_CANCEL:
+                    preempted->pending = false;
+                    stats[active].cancelled++;
+                    active = GROUP_NONE;
+                    break;
+
+                case SAR2_PREEMPTION_ABORT_RESTART:
+                    preempted->channel = 0u;
+                    preempted->remaining = 0u;
+                    active = GROUP_NONE;
+                    break;
+
+                case SAR2_PREEMPTION_ABORT_RESUME:
+                    preempted->remaining = 0u;
+                    active = GROUP_NONE;
+                    break;
+
+                case SAR2_PREEMPTION_FINISH_RESUME:
+                default:
+                    /* Switched at the end of the current channel, below */
+                    break;
+            }
+
+        }
+
+        if (active == GROUP_NONE)
+        {
+            active = winner;
+        }
+
+        if (active == GROUP_NONE)
+        {
+            continue;
+        }
+
+        /* Conversion of the current channel */
+        if (state[active].remaining == 0u)
+        {
+            state[active].remaining = groups[active].channelCycles;
+        }
+
+        if (--state[active].remaining == 0u)
+        {
+            group_state_t *current = &state[active];
+
+            if (++current->channel == groups[active].channels)
+            {
+                uint32_t latency = (t + 1u) - current->triggerTime;
+
+                current->pending = false;
+                stats[active].completed++;
+                stats[active].latencySum += latency;
+                if (latency < stats[active].latencyMin)
+                {
+                    stats[active].latencyMin = latency;
+                }
+                if (latency > stats[active].latencyMax)
+                {
+                    stats[active].latencyMax = latency;
+                }
+                active = GROUP_NONE;
+            }
+            else
+            {
+                /* Channel boundary: a FINISH_RESUME group yields to a higher priority group here */
+                winner = select_group(groups, state, groupNum);
+                if (groups[winner].priority < groups[active].priority)
+                {
+                    stats[active].preempted++;
+                    active = GROUP_NONE;
+                }
+            }
+        }
+    }
+}
+/*******************************************************************************
+* Function Name: ranks_before
+********************************************************************************
+* Summary:
+*  Tells whether group a gets a higher priority than group b: critical groups
+*  before background groups, critical groups by their latency budget,
+*  background groups by their trigger period (never triggered last), and
+*  the group index for equal values.
+*
+*******************************************************************************/
+static bool ranks_before(const sar2_sched_request_t *requests, uint32_t a, uint32_t b)
+{
+    const sar2_sched_request_t *ra = &requests[a];
+    const sar2_sched_request_t *rb = &requests[b];
+    uint32_t keyA;
+    uint32_t keyB;
+
+    if (ra->groupClass != rb->groupClass)
+    {
+        return (ra->groupClass == SAR2_SCHED_CLASS_CRITICAL);
+    }
+
+    if (ra->groupClass == SAR2_SCHED_CLASS_CRITICAL)
+    {
+        keyA = ra->latencyBudget;
+        keyB = rb->latencyBudget;
+    }
+    else
+    {
+        keyA = (ra->triggerPeriod == 0u) ? UINT32_MAX : ra->triggerPeriod;
+        keyB = (rb->triggerPeriod == 0u) ? UINT32_MAX : rb->triggerPeriod;
+    }
+
+    return (keyA < keyB) || ((keyA == keyB) && (a < b));
+}
+
+/*******************************************************************************
+* Function Name: critical_response
+********************************************************************************
+* Summary:
+*  Returns the longest trigger to done time of a critical group without
+*  blocking by lower priority groups: its own conversion plus one conversion
+*  of every critical group of higher priority.
+*
+*******************************************************************************/
+static uint32_t critical_response(const sar2_sched_request_t *requests, const sar2_sched_group_t *groups,
+                                  uint32_t groupNum, uint32_t group)
+{
+    uint32_t response = requests[group].channels * requests[group].channelCycles;
+    uint32_t i;
+
+    for (i = 0u; i < groupNum; i++)
+    {
+        if ((requests[i].groupClass == SAR2_SCHED_CLASS_CRITICAL) && (groups[i].priority < groups[group].priority))
+        {
+            response += requests[i].channels * requests[i].channelCycles;
+        }
+    }
+
+    return response;
+}
+
+/*******************************************************************************
+* Function Name: critical_limit
+********************************************************************************
+* Summary:
+*  Returns the longest allowed trigger to done time of a critical group: its
+*  budget, and at most its trigger period, since a group still converting at
+*  its next trigger loses that trigger.
+*
+*******************************************************************************/
+static uint32_t critical_limit(const sar2_sched_request_t *request)
+{
+    return ((request->triggerPeriod != 0u) && (request->triggerPeriod < request->latencyBudget)) ?
+           request->triggerPeriod : request->latencyBudget;
+}
+
+/*******************************************************************************
+* Function Name: sar2_sched_assign
+********************************************************************************
+* Summary:
+*  Assigns the channel priorities and preemption types of a set of groups.
+*  - Critical groups get the highest priorities, the shortest latency budget
+*    first; background groups follow, the shortest trigger period first.
+*  - A group that is preempted by a critical group keeps FINISH_RESUME, so no
+*    conversion is repeated, as long as finishing one of its channels keeps
+*    every critical group of higher priority within its budget and its
+*    trigger period. Otherwise it gets ABORT_RESUME, which repeats only the
+*    aborted channel. ABORT_CANCEL and ABORT_RESTART are never assigned: the
+*    first loses groups, and the second throws away the converted channels
+*    on every preemption.
+*
+* Parameters:
+*  const sar2_sched_request_t *requests - Requested groups, in channel order
+*  uint32_t groupNum                    - Number of groups, up to SAR2_SCHED_GROUPS_MAX
+*  sar2_sched_group_t *groups           - Receives the groups for sar2_sched_run()
+*
+* Return:
+*  bool - false if the groups cannot all be served: they need more than the
+*         whole conversion time, a critical group misses its budget or its
+*         trigger period even without blocking, or an ABORT_RESUME group does not fit one channel
+*         between two conversions of a group of higher priority and starves
+*
+*******************************************************************************/
+bool sar2_sched_assign(const sar2_sched_request_t *requests, uint32_t groupNum, sar2_sched_group_t *groups)
+{
+    uint64_t load = 0u;
+    bool feasible = true;
+    uint32_t rank;
+    uint32_t i;
+    uint32_t j;
+
+    if (groupNum > SAR2_SCHED_GROUPS_MAX)
+    {
+        groupNum = SAR2_SCHED_GROUPS_MAX;
+    }
+
+    for (i = 0u; i < groupNum; i++)
+    {
+        rank = 0u;
+        for (j = 0u; j < groupNum; j++)
+        {
+            rank += ((j != i) && ranks_before(requests, j, i)) ? 1u : 0u;
+        }
+
+        groups[i].priority = (uint8_t)((rank > SAR2_SCHED_PRIORITY_MIN) ? SAR2_SCHED_PRIORITY_MIN : rank);
+        groups[i].preemptionType = SAR2_PREEMPTION_FINISH_RESUME;
+        groups[i].channels = requests[i].channels;
+        groups[i].channelCycles = requests[i].channelCycles;
+        groups[i].triggerPeriod = requests[i].triggerPeriod;
+        groups[i].triggerOffset = requests[i].triggerOffset;
+    }
+
+    for (i = 0u; i < groupNum; i++)
+    {
+        const uint32_t conversion = requests[i].channels * requests[i].channelCycles;
+
+        /* Load in units of 2^-16 of the conversion time */
+        if (requests[i].triggerPeriod != 0u)
+        {
+            load += ((uint64_t)conversion << 16) / requests[i].triggerPeriod;
+        }
+
+        if ((requests[i].groupClass == SAR2_SCHED_CLASS_CRITICAL) &&
+            (critical_response(requests, groups, groupNum, i) > critical_limit(&requests[i])))
+        {
+            feasible = false;
+        }
+
+        /* Blocking of the critical groups of higher priority by one channel of this group */
+        for (j = 0u; j < groupNum; j++)
+        {
+            if ((requests[j].groupClass == SAR2_SCHED_CLASS_CRITICAL) && (groups[j].priority < groups[i].priority) &&
+                ((critical_response(requests, groups, groupNum, j) + requests[i].channelCycles) >
+                 critical_limit(&requests[j])))
+            {
+                groups[i].preemptionType = SAR2_PREEMPTION_ABORT_RESUME;
+            }
+        }
+    }
+
+    for (i = 0u; i < groupNum; i++)
+    {
+        if (groups[i].preemptionType != SAR2_PREEMPTION_ABORT_RESUME)
+        {
+            continue;
+        }
+
+        /* An aborted channel only completes within the idle time between two triggers of a higher priority group */
+        for (j = 0u; j < groupNum; j++)
+        {
+            if ((groups[j].priority < groups[i].priority) && (requests[j].triggerPeriod != 0u) &&
+                ((requests[j].triggerPeriod - (requests[j].channels * requests[j].channelCycles)) <
+                 requests[i].channelCycles))
+            {
+                feasible = false;
+            }
+        }
+    }
+
+    return feasible && (load <= ((uint64_t)1u << 16));
+}
+/* [] END OF FILE */
@@ -0,0 +1,128 @@
+/******************************************************************************
+* File Name:   sar2_sched.h
+*
+* Description: This file contains the declarations of the SAR2 channel group
+*              scheduling model, which reproduces the trigger arbitration and
+*              preemption rules of a SAR2 unit.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef SAR2_SCHED_H
+#define SAR2_SCHED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Maximum number of channel groups of one unit */
+#define SAR2_SCHED_GROUPS_MAX (8u)
+
+/* Lowest channel priority, 0 is the highest */
+#define SAR2_SCHED_PRIORITY_MIN (7u)
+
+/* Preemption type of a group, in the order of cy_en_sar2_preemption_type_t */
+enum Sar2Preemption
+{
+    SAR2_PREEMPTION_ABORT_CANCEL,   /* Aborted and dropped, signals group cancelled */
+    SAR2_PREEMPTION_ABORT_RESTART,  /* Aborted, restarts from its first channel */
+    SAR2_PREEMPTION_ABORT_RESUME,   /* Aborted, repeats the aborted channel */
+    SAR2_PREEMPTION_FINISH_RESUME   /* Finishes the current channel, continues with the next one */
+};
+
+/* Class of a group for sar2_sched_assign() */
+enum Sar2SchedClass
+{
+    SAR2_SCHED_CLASS_CRITICAL,      /* Low latency, for example a safety-critical input */
+    SAR2_SCHED_CLASS_BACKGROUND     /* Served when no critical group is pending */
+};
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Channel group, as defined by the configuration of its first channel */
+typedef struct
+{
+    uint8_t priority;           /* 0 (highest) to SAR2_SCHED_PRIORITY_MIN */
+    uint8_t preemptionType;     /* enum Sar2Preemption, applies when this group is preempted */
+    uint8_t channels;           /* Number of channels in the group */
+    uint32_t channelCycles;     /* Conversion time of one channel in SAR clock cycles */
+    uint32_t triggerPeriod;     /* Trigger period in SAR clock cycles, 0 if never triggered */
+    uint32_t triggerOffset;     /* Time of the first trigger */
+} sar2_sched_group_t;
+
+/* Group as requested from sar2_sched_assign(), without priority and preemption type */
+typedef struct
+{
+    uint8_t groupClass;         /* enum Sar2SchedClass */
+    uint8_t channels;
+    uint32_t channelCycles;
+    uint32_t triggerPeriod;
+    uint32_t triggerOffset;
+    uint32_t latencyBudget;     /* Longest trigger to group done of a critical group, SAR clock cycles */
+} sar2_sched_request_t;
+
+/* Outcome of the triggers of one group */
+typedef struct
+{
+    uint32_t triggers;          /* Triggers accepted */
+    uint32_t completed;         /* Groups converted completely */
+    uint32_t cancelled;         /* Groups dropped by ABORT_CANCEL preemption */
+    uint32_t overflows;         /* Triggers lost because the group was still busy */
+    uint32_t preempted;         /* Times the group was preempted */
+    uint32_t latencyMin;        /* Trigger to group done, in SAR clock cycles */
+    uint32_t latencyMax;
+    uint64_t latencySum;
+} sar2_sched_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void sar2_sched_run(const sar2_sched_group_t *groups, uint32_t groupNum, uint32_t cycles,
+                    sar2_sched_stats_t *stats);
+bool sar2_sched_assign(const sar2_sched_request_t *requests, uint32_t groupNum, sar2_sched_group_t *groups);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SAR2_SCHED_H */
+/* [] END OF FILE */
@@ -0,0 +1,139 @@
+/******************************************************************************
+* File Name:   sar_merge.c
+*
+* Description: This file contains the merge of the sample rings of several
+*              SAR2 units into one stream in sample order. Each unit has
+*              its own interrupt handler and single-producer single-consumer
+*              ring; the merge runs in the consumer and orders the results by
+*              their timestamps, so units that are triggered together deliver
+*              time-aligned results next to each other.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include <stddef.h>
+#include "sar_merge.h"
+
+/*******************************************************************************
+* Function Name: sar_merge_init
+********************************************************************************
+* Summary:
+*  Sets up the merge of the rings of unitCount units. The rings are not reset,
+*  so that results already in them are merged as well.
+*
+* Parameters:
+*  sar_merge_t *merge           - Merge state
+*  sample_ring_t *const rings[] - Ring of each unit, in unit order
+*  uint32_t unitCount           - Number of units, 1 to SAR_MERGE_MAX_UNITS
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sar_merge_init(sar_merge_t *merge, sample_ring_t *const rings[], uint32_t unitCount)
+{
+    uint32_t unit;
+
+    merge->unitCount = (unitCount > SAR_MERGE_MAX_UNITS) ? SAR_MERGE_MAX_UNITS : unitCount;
+
+    for (unit = 0u; unit < SAR_MERGE_MAX_UNITS; unit++)
+    {
+        merge->rings[unit] = (unit < merge->unitCount) ? rings[unit] : NULL;
+        merge->nextValid[unit] = false;
+        merge->merged[unit] = 0u;
+    }
+}
+
+/*******************************************************************************
+* Function Name: sar_merge_pop
+********************************************************************************
+* Summary:
+*  Returns the oldest result of all units. A result is only passed on once
+*  every unit has a result waiting, since a unit with an empty ring may still
+*  deliver an older one. Timestamps are compared modulo 2^32, so the order
+*  holds across their wrap around as long as the waiting results are less
+*  than 2^31 cycles apart. Results with the same timestamp are returned in
+*  unit order.
+*
+* Parameters:
+*  sar_merge_t *merge      - Merge state
+*  bool drain              - true once the units have stopped converting: the
+*                            remaining results are returned without waiting
+*                            for the empty rings
+*  sar_merge_sample_t *out - Receives the result and its unit
+*
+* Return:
+*  bool - false if no result can be returned yet
+*
+*******************************************************************************/
+bool sar_merge_pop(sar_merge_t *merge, bool drain, sar_merge_sample_t *out)
+{
+    uint32_t oldest = SAR_MERGE_MAX_UNITS;
+    uint32_t unit;
+
+    for (unit = 0u; unit < merge->unitCount; unit++)
+    {
+        if (!merge->nextValid[unit])
+        {
+            merge->nextValid[unit] = sample_ring_pop(merge->rings[unit], &merge->next[unit]);
+        }
+
+        if (!merge->nextValid[unit])
+        {
+            if (!drain)
+            {
+                return false;
+            }
+        }
+        else if ((oldest == SAR_MERGE_MAX_UNITS) ||
+                 ((int32_t)(merge->next[unit].timestamp - merge->next[oldest].timestamp) < 0))
+        {
+            oldest = unit;
+        }
+    }
+
+    if (oldest == SAR_MERGE_MAX_UNITS)
+    {
+        return false;
+    }
+
+    out->sample = merge->next[oldest];
+    out->unit = (uint8_t)oldest;
+    merge->nextValid[oldest] = false;
+    merge->merged[oldest]++;
+
+    return true;
+}
+/* [] END OF FILE */
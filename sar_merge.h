@@ -0,0 +1,92 @@
+/******************************************************************************
+* File Name:   sar_merge.h
+*
+* Description: This file contains the interface of the merge of the sample
+*              rings of several SAR2 units into one stream in sample order.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef SAR_MERGE_H
+#define SAR_MERGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sample_ring.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Maximum number of SAR2 units merged into one stream */
+#define SAR_MERGE_MAX_UNITS (4u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* One result of the merged stream and the unit that converted it */
+typedef struct
+{
+    adc_sample_t sample;
+    uint8_t unit;
+} sar_merge_sample_t;
+
+/* Merge state. It is only used by the consumer; each ring keeps its own
+ * producer, the interrupt handler of its unit.
+ */
+typedef struct
+{
+    sample_ring_t *rings[SAR_MERGE_MAX_UNITS];
+    uint32_t unitCount;
+    adc_sample_t next[SAR_MERGE_MAX_UNITS];     /* Oldest result of each unit, taken out of its ring */
+    bool nextValid[SAR_MERGE_MAX_UNITS];
+    uint32_t merged[SAR_MERGE_MAX_UNITS];       /* Results passed on per unit */
+} sar_merge_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void sar_merge_init(sar_merge_t *merge, sample_ring_t *const rings[], uint32_t unitCount);
+bool sar_merge_pop(sar_merge_t *merge, bool drain, sar_merge_sample_t *out);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SAR_MERGE_H */
+/* [] END OF FILE */
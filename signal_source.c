@@ -0,0 +1,352 @@
+/******************************************************************************
+* File Name:   signal_source.c
+*
+* Description: This file contains synthetic analog signal sources for AN0 and VBG.
+*              Each source produces 12-bit conversion codes, which are averaged,
+*              right shifted and formatted by the SAR2 result model in the same
+*              way as configure_SAR_ADC() programs the hardware. The sources only
+*              use integer arithmetic and a deterministic pseudo random generator,
+*              so a given seed always produces the same sequence.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "signal_source.h"
+#include "sar2_model.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Conversion of a 12-bit code to Q16 */
+#define CODE_Q16(code) ((int32_t)(code) << 16)
+
+/* Conversion of a noise sigma in codes to Q8 */
+#define SIGMA_Q8(sigma) ((int32_t)(sigma) << 8)
+
+/* Phase increment for a period of n conversions */
+#define PERIOD_INC(n) ((uint32_t)(0x100000000ULL / (n)))
+
+/* Mid scale of the 12-bit range */
+#define MID_SCALE (2048)
+
+/* Nominal band gap conversion result and its drift amplitude */
+#define BANDGAP_CODE        (1117)
+#define BANDGAP_DRIFT_CODES (3)
+
+/* Half period of the step signal in conversions */
+#define STEP_HALF_PERIOD (512u)
+
+/* Glitch probability of the step signal, 1 in 2^GLITCH_RATE_BITS conversions */
+#define GLITCH_RATE_BITS (8u)
+
+/* Scales the Irwin-Hall sum of four bytes (sigma 147.8) to a sigma of 1.0 in Q16 */
+#define NOISE_NORM (443)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+const char *SIGNAL_TYPE_STR[SIGNAL_TYPE_NUM] =
+{
+    "DC + noise   ",
+    "Ramp         ",
+    "Sine         ",
+    "Chirp        ",
+    "Step + glitch",
+    "Band gap     "
+};
+
+/* One cycle of a sine in Q15, with the first entry repeated for interpolation */
+static const int16_t SINE_Q15[257] =
+{
+         0,    804,   1608,   2410,   3212,   4011,   4808,   5602,
+      6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+     12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+     18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+     23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,
+     27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+     30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,
+     32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+     32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,
+     32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,
+     30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,
+     27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+     23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,
+     18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279,
+     12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,
+      6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,
+         0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,
+     -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+    -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+    -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+    -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+    -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+    -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+    -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+    -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+    -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+    -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+    -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+    -12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,
+     -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804,
+         0
+};
+
+/*******************************************************************************
+* Function Name: next_random
+********************************************************************************
+* Summary:
+*  Advances the xorshift32 generator.
+*
+*******************************************************************************/
+static inline uint32_t next_random(signal_source_t *src)
+{
+    uint32_t x = src->rng;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    src->rng = x;
+
+    return x;
+}
+
+/*******************************************************************************
+* Function Name: gaussian_noise
+********************************************************************************
+* Summary:
+*  Returns approximately Gaussian noise with the sigma of the source in Q16,
+*  from the sum of four uniformly distributed bytes.
+*
+*******************************************************************************/
+static inline int32_t gaussian_noise(signal_source_t *src)
+{
+    uint32_t r = next_random(src);
+    int32_t sum = (int32_t)((r & 0xFFu) + ((r >> 8) & 0xFFu) + ((r >> 16) & 0xFFu) + (r >> 24)) - 510;
+
+    return (int32_t)(((int64_t)sum * NOISE_NORM * src->noiseSigma) >> 8);
+}
+
+/*******************************************************************************
+* Function Name: sine_q15
+********************************************************************************
+* Summary:
+*  Returns sin(2 * pi * phase / 2^32) in Q15 by linear interpolation of the
+*  sine table.
+*
+*******************************************************************************/
+static inline int32_t sine_q15(uint32_t phase)
+{
+    uint32_t idx = phase >> 24;
+    int32_t frac = (int32_t)((phase >> 8) & 0xFFFFu);
+    int32_t a = SINE_Q15[idx];
+    int32_t b = SINE_Q15[idx + 1u];
+
+    return a + (((b - a) * frac) >> 16);
+}
+
+/*******************************************************************************
+* Function Name: signal_source_init
+********************************************************************************
+* Summary:
+*  Initializes a signal source with the default parameters of its type.
+*
+* Parameters:
+*  signal_source_t *src - Source to be initialized
+*  int32_t type         - Signal shape (enum SignalType)
+*  uint32_t seed        - Seed of the noise generator
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void signal_source_init(signal_source_t *src, int32_t type, uint32_t seed)
+{
+    src->type = type;
+    src->rng = (seed != 0u) ? seed : 0x2545F491u;
+    src->phase = 0u;
+    src->phaseInc = 0u;
+    src->phaseIncMin = 0u;
+    src->phaseIncMax = 0u;
+    src->phaseIncStep = 0u;
+    src->count = 0u;
+    src->offset = CODE_Q16(MID_SCALE);
+    src->amplitude = 0;
+    src->noiseSigma = SIGMA_Q8(1);
+
+    switch (type)
+    {
+        case SIGNAL_DC_NOISE:
+            src->noiseSigma = SIGMA_Q8(4);
+            break;
+
+        case SIGNAL_RAMP:
+            src->offset = 0;
+            src->amplitude = CODE_Q16(SAR2_MODEL_CODE_MAX);
+            src->phaseInc = PERIOD_INC(4096u);
+            break;
+
+        case SIGNAL_SINE:
+            src->amplitude = CODE_Q16(1800);
+            src->phaseInc = PERIOD_INC(1024u);
+            break;
+
+        case SIGNAL_CHIRP:
+            src->amplitude = CODE_Q16(1800);
+            src->phaseIncMin = PERIOD_INC(4096u);
+            src->phaseIncMax = PERIOD_INC(8u);
+            src->phaseIncStep = PERIOD_INC(8u) / 65536u;
+            src->phaseInc = src->phaseIncMin;
+            break;
+
+        case SIGNAL_STEP_GLITCH:
+            src->amplitude = CODE_Q16(1024);
+            break;
+
+        case SIGNAL_BANDGAP_DRIFT:
+            src->offset = CODE_Q16(BANDGAP_CODE);
+            src->amplitude = CODE_Q16(BANDGAP_DRIFT_CODES);
+            src->phaseInc = PERIOD_INC(1u << 20);
+            break;
+
+        default:
+            src->type = SIGNAL_DC_NOISE;
+            break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: signal_source_next_code
+********************************************************************************
+* Summary:
+*  Produces the 12-bit code of the next single conversion.
+*
+* Parameters:
+*  signal_source_t *src - Signal source
+*
+* Return:
+*  uint16_t - Conversion code (0 to 4095)
+*
+*******************************************************************************/
+uint16_t signal_source_next_code(signal_source_t *src)
+{
+    int32_t level = src->offset;
+
+    switch (src->type)
+    {
+        case SIGNAL_RAMP:
+            level += (int32_t)(((int64_t)src->amplitude * (src->phase >> 16)) >> 16);
+            break;
+
+        case SIGNAL_SINE:
+        case SIGNAL_BANDGAP_DRIFT:
+            level += (int32_t)(((int64_t)src->amplitude * sine_q15(src->phase)) >> 15);
+            break;
+
+        case SIGNAL_CHIRP:
+            level += (int32_t)(((int64_t)src->amplitude * sine_q15(src->phase)) >> 15);
+
+            /* Sweep the frequency up, then start over */
+            src->phaseInc += src->phaseIncStep;
+            if (src->phaseInc > src->phaseIncMax)
+            {
+                src->phaseInc = src->phaseIncMin;
+            }
+            break;
+
+        case SIGNAL_STEP_GLITCH:
+            level += (((src->count / STEP_HALF_PERIOD) & 1u) != 0u) ? src->amplitude : -src->amplitude;
+
+            /* Replace a random conversion by a full scale glitch */
+            if ((next_random(src) >> (32u - GLITCH_RATE_BITS)) == 0u)
+            {
+                level = ((src->rng & 1u) != 0u) ? CODE_Q16(SAR2_MODEL_CODE_MAX) : 0;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    src->phase += src->phaseInc;
+    src->count++;
+
+    /* Add the noise and quantize to 12 bits */
+    level += gaussian_noise(src) + (1 << 15);
+    if (level < 0)
+    {
+        level = 0;
+    }
+    else if (level > CODE_Q16(SAR2_MODEL_CODE_MAX))
+    {
+        level = CODE_Q16(SAR2_MODEL_CODE_MAX);
+    }
+
+    return (uint16_t)(level >> 16);
+}
+
+/*******************************************************************************
+* Function Name: signal_source_next_result
+********************************************************************************
+* Summary:
+*  Produces the next result register value: averageCount conversions are
+*  accumulated, right shifted and formatted by the SAR2 result model,
+*  sar2_model_result().
+*
+* Parameters:
+*  signal_source_t *src  - Signal source
+*  uint32_t averageCount - Average count (1 to SAR2_MODEL_AVERAGE_MAX)
+*  uint8_t rightShift    - Right shift applied to the accumulated codes
+*  int32_t outputFormat  - Output format (enum OutputFmt)
+*
+* Return:
+*  uint16_t - Value as read from the result register
+*
+*******************************************************************************/
+uint16_t signal_source_next_result(signal_source_t *src, uint32_t averageCount, uint8_t rightShift,
+                                   int32_t outputFormat)
+{
+    uint16_t codes[SAR2_MODEL_AVERAGE_MAX];
+    uint32_t i;
+
+    for (i = 0u; i < averageCount; i++)
+    {
+        codes[i] = signal_source_next_code(src);
+    }
+
+    return sar2_model_result(codes, averageCount, rightShift, outputFormat);
+}
+/* [] END OF FILE */
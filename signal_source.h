@@ -0,0 +1,102 @@
+/******************************************************************************
+* File Name:   signal_source.h
+*
+* Description: This file contains the interface of the synthetic analog signal
+*              sources for AN0 and VBG.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef SIGNAL_SOURCE_H
+#define SIGNAL_SOURCE_H
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Signal shapes */
+enum SignalType
+{
+    SIGNAL_DC_NOISE,        /* DC level with Gaussian noise */
+    SIGNAL_RAMP,            /* Sawtooth over the full 12-bit range */
+    SIGNAL_SINE,            /* Sine around mid scale */
+    SIGNAL_CHIRP,           /* Sine with a linearly rising frequency */
+    SIGNAL_STEP_GLITCH,     /* Square wave with random single-sample glitches */
+    SIGNAL_BANDGAP_DRIFT,   /* Band gap level with a slow temperature drift */
+    SIGNAL_TYPE_NUM
+};
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* State of one signal source. Levels are in 12-bit codes with 16 fraction
+ * bits (Q16), the noise sigma in codes with 8 fraction bits (Q8).
+ */
+typedef struct
+{
+    int32_t type;
+    uint32_t rng;           /* xorshift32 state, never 0 */
+    uint32_t phase;         /* Phase, one cycle = 2^32 */
+    uint32_t phaseInc;      /* Phase increment per conversion */
+    uint32_t phaseIncMin;   /* Chirp start increment */
+    uint32_t phaseIncMax;   /* Chirp end increment */
+    uint32_t phaseIncStep;  /* Chirp increment change per conversion */
+    uint32_t count;         /* Conversions generated so far */
+    int32_t offset;         /* Q16 */
+    int32_t amplitude;      /* Q16 */
+    int32_t noiseSigma;     /* Q8 */
+} signal_source_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void signal_source_init(signal_source_t *src, int32_t type, uint32_t seed);
+uint16_t signal_source_next_code(signal_source_t *src);
+uint16_t signal_source_next_result(signal_source_t *src, uint32_t averageCount, uint8_t rightShift,
+                                   int32_t outputFormat);
+
+extern const char *SIGNAL_TYPE_STR[SIGNAL_TYPE_NUM];
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SIGNAL_SOURCE_H */
+/* [] END OF FILE */
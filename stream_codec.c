@@ -0,0 +1,304 @@
+/******************************************************************************
+* File Name:   stream_codec.c
+*
+* Description: This file contains the streaming encoder for the sample output and
+*              the matching decoder. Samples are delta encoded, the deltas are
+*              zig-zag mapped to unsigned residuals and the residuals are Rice
+*              coded with a parameter chosen per block.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "stream_codec.h"
+
+/*******************************************************************************
+* Encoded block layout
+********************************************************************************
+*  byte 0      : number of samples in the block (1 to STREAM_BLOCK_SAMPLES)
+*  byte 1      : Rice parameter k
+*  byte 2..3   : first sample, little endian
+*  byte 4..    : Rice codes of the remaining count-1 residuals, MSB first,
+*                padded with zero bits to the next byte boundary
+*
+*  A residual r is written as (r >> k) one bits, a zero bit and the low k bits
+*  of r. A residual whose quotient is STREAM_RICE_ESCAPE or larger is written
+*  as STREAM_RICE_ESCAPE one bits followed by the residual in
+*  STREAM_ESCAPE_BITS bits, which bounds the size of a block with glitches.
+*******************************************************************************/
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    uint8_t *out;
+    uint32_t pos;
+    uint32_t acc;
+    uint32_t bits;
+} bit_writer_t;
+
+typedef struct
+{
+    const uint8_t *in;
+    uint32_t size;
+    uint32_t pos;
+    uint32_t acc;
+    uint32_t bits;
+} bit_reader_t;
+
+/*******************************************************************************
+* Function Name: zigzag
+********************************************************************************
+* Summary:
+*  Maps a signed delta to an unsigned residual: 0, -1, 1, -2, 2 ... become
+*  0, 1, 2, 3, 4 ...
+*
+*******************************************************************************/
+static inline uint32_t zigzag(int32_t delta)
+{
+    return ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+}
+
+/*******************************************************************************
+* Function Name: unzigzag
+********************************************************************************
+* Summary:
+*  Inverse of zigzag().
+*
+*******************************************************************************/
+static inline int32_t unzigzag(uint32_t residual)
+{
+    return (int32_t)(residual >> 1) ^ -(int32_t)(residual & 1u);
+}
+
+/*******************************************************************************
+* Function Name: put_bits
+********************************************************************************
+* Summary:
+*  Appends the low n bits of value (n <= 24) to the bit stream.
+*
+*******************************************************************************/
+static inline void put_bits(bit_writer_t *bw, uint32_t value, uint32_t n)
+{
+    bw->acc = (bw->acc << n) | (value & ((1UL << n) - 1u));
+    bw->bits += n;
+
+    while (bw->bits >= 8u)
+    {
+        bw->bits -= 8u;
+        bw->out[bw->pos++] = (uint8_t)(bw->acc >> bw->bits);
+    }
+}
+
+/*******************************************************************************
+* Function Name: get_bits
+********************************************************************************
+* Summary:
+*  Reads n bits (n <= 24) from the bit stream. Reading past the end returns
+*  zero bits.
+*
+*******************************************************************************/
+static inline uint32_t get_bits(bit_reader_t *br, uint32_t n)
+{
+    while (br->bits < n)
+    {
+        br->acc = (br->acc << 8) | ((br->pos < br->size) ? br->in[br->pos] : 0u);
+        br->pos++;
+        br->bits += 8u;
+    }
+
+    br->bits -= n;
+
+    return (br->acc >> br->bits) & ((1UL << n) - 1u);
+}
+
+/*******************************************************************************
+* Function Name: select_rice_k
+********************************************************************************
+* Summary:
+*  Chooses the Rice parameter of a block from the mean residual: the largest
+*  k for which 2^k does not exceed the mean.
+*
+*******************************************************************************/
+static uint32_t select_rice_k(uint32_t sum, uint32_t count)
+{
+    uint32_t k = 0u;
+
+    while ((k < STREAM_RICE_K_MAX) && (((uint32_t)count << (k + 1u)) <= sum))
+    {
+        k++;
+    }
+
+    return k;
+}
+
+/*******************************************************************************
+* Function Name: stream_encode_block
+********************************************************************************
+* Summary:
+*  Encodes up to STREAM_BLOCK_SAMPLES samples into one block.
+*
+* Parameters:
+*  const uint16_t *samples - Samples to be encoded
+*  uint32_t count          - Number of samples (1 to STREAM_BLOCK_SAMPLES)
+*  uint8_t *out            - Output buffer, at least STREAM_BLOCK_MAX_SIZE bytes
+*
+* Return:
+*  uint32_t - Size of the encoded block in bytes
+*
+*******************************************************************************/
+uint32_t stream_encode_block(const uint16_t *samples, uint32_t count, uint8_t *out)
+{
+    uint32_t residuals[STREAM_BLOCK_SAMPLES];
+    uint32_t sum = 0u;
+    uint32_t k;
+    uint32_t i;
+    bit_writer_t bw;
+
+    /* Delta and zig-zag pass, accumulating the statistic used to pick k */
+    for (i = 1u; i < count; i++)
+    {
+        residuals[i] = zigzag((int32_t)samples[i] - (int32_t)samples[i - 1u]);
+        sum += residuals[i];
+    }
+
+    k = (count > 1u) ? select_rice_k(sum, count - 1u) : 0u;
+
+    out[0] = (uint8_t)count;
+    out[1] = (uint8_t)k;
+    out[2] = (uint8_t)(samples[0] & 0xFFu);
+    out[3] = (uint8_t)(samples[0] >> 8);
+
+    bw.out = out;
+    bw.pos = STREAM_BLOCK_HEADER_SIZE;
+    bw.acc = 0u;
+    bw.bits = 0u;
+
+    for (i = 1u; i < count; i++)
+    {
+        uint32_t q = residuals[i] >> k;
+
+        if (q < STREAM_RICE_ESCAPE)
+        {
+            /* Unary quotient terminated by a zero bit, then the remainder */
+            put_bits(&bw, (1UL << (q + 1u)) - 2u, q + 1u);
+            put_bits(&bw, residuals[i], k);
+        }
+        else
+        {
+            put_bits(&bw, (1UL << STREAM_RICE_ESCAPE) - 1u, STREAM_RICE_ESCAPE);
+            put_bits(&bw, residuals[i], STREAM_ESCAPE_BITS);
+        }
+    }
+
+    /* Pad the last partial byte with zero bits */
+    if (bw.bits != 0u)
+    {
+        put_bits(&bw, 0u, 8u - bw.bits);
+    }
+
+    return bw.pos;
+}
+
+/*******************************************************************************
+* Function Name: stream_decode_block
+********************************************************************************
+* Summary:
+*  Decodes one block produced by stream_encode_block().
+*
+* Parameters:
+*  const uint8_t *in  - Encoded block
+*  uint32_t size      - Number of bytes available at in
+*  uint16_t *samples  - Output buffer, at least STREAM_BLOCK_SAMPLES samples
+*
+* Return:
+*  uint32_t - Number of bytes consumed, or 0 if the block is malformed or
+*             truncated
+*
+*******************************************************************************/
+uint32_t stream_decode_block(const uint8_t *in, uint32_t size, uint16_t *samples)
+{
+    uint32_t count;
+    uint32_t k;
+    uint32_t i;
+    bit_reader_t br;
+
+    if (size < STREAM_BLOCK_HEADER_SIZE)
+    {
+        return 0u;
+    }
+
+    count = in[0];
+    k = in[1];
+
+    if ((count == 0u) || (count > STREAM_BLOCK_SAMPLES) || (k > STREAM_RICE_K_MAX))
+    {
+        return 0u;
+    }
+
+    samples[0] = (uint16_t)(in[2] | ((uint16_t)in[3] << 8));
+
+    br.in = in;
+    br.size = size;
+    br.pos = STREAM_BLOCK_HEADER_SIZE;
+    br.acc = 0u;
+    br.bits = 0u;
+
+    for (i = 1u; i < count; i++)
+    {
+        uint32_t q = 0u;
+        uint32_t residual;
+
+        while ((q < STREAM_RICE_ESCAPE) && (get_bits(&br, 1u) != 0u))
+        {
+            q++;
+        }
+
+        if (q < STREAM_RICE_ESCAPE)
+        {
+            residual = (q << k) | get_bits(&br, k);
+        }
+        else
+        {
+            residual = get_bits(&br, STREAM_ESCAPE_BITS);
+        }
+
+        samples[i] = (uint16_t)((int32_t)samples[i - 1u] + unzigzag(residual));
+    }
+
+    /* Any bits left in the accumulator are the padding of the last byte */
+    return (br.pos > size) ? 0u : br.pos;
+}
+/* [] END OF FILE */
@@ -0,0 +1,84 @@
+/******************************************************************************
+* File Name:   stream_codec.h
+*
+* Description: This file contains the interface of the delta + Rice encoder and
+*              decoder for the streamed sample output.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef STREAM_CODEC_H
+#define STREAM_CODEC_H
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of samples encoded into one block */
+#define STREAM_BLOCK_SAMPLES (32u)
+
+/* Block header: sample count, Rice parameter and the first sample verbatim */
+#define STREAM_BLOCK_HEADER_SIZE (4u)
+
+/* Largest Rice parameter that is selected for a block */
+#define STREAM_RICE_K_MAX (15u)
+
+/* Quotient at which a residual is escaped and written verbatim */
+#define STREAM_RICE_ESCAPE (16u)
+
+/* Width of an escaped residual; zig-zag of a 16-bit delta needs 17 bits */
+#define STREAM_ESCAPE_BITS (17u)
+
+/* Worst case size of one encoded block in bytes */
+#define STREAM_BLOCK_MAX_SIZE (STREAM_BLOCK_HEADER_SIZE + \
+    ((((STREAM_BLOCK_SAMPLES - 1u) * (STREAM_RICE_ESCAPE + STREAM_ESCAPE_BITS)) + 7u) / 8u))
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint32_t stream_encode_block(const uint16_t *samples, uint32_t count, uint8_t *out);
+uint32_t stream_decode_block(const uint8_t *in, uint32_t size, uint16_t *samples);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* STREAM_CODEC_H */
+/* [] END OF FILE */
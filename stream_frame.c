@@ -0,0 +1,303 @@
+/******************************************************************************
+* File Name:   stream_frame.c
+*
+* Description: This file contains the framing layer of the binary sample stream.
+*              Every frame carries synchronization bytes, a type, a sequence
+*              number and a CRC, so that a capture tool can find frame boundaries
+*              in the raw serial data, detect lost frames and reject corrupted
+*              ones.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "stream_frame.h"
+
+/*******************************************************************************
+* Frame layout (all multi-byte fields little endian)
+********************************************************************************
+*  byte 0      : STREAM_FRAME_SYNC0
+*  byte 1      : STREAM_FRAME_SYNC1
+*  byte 2      : frame type (STREAM_FRAME_TYPE_xxx)
+*  byte 3      : reserved, 0
+*  byte 4..5   : sequence number, incremented for every frame
+*  byte 6..7   : payload length in bytes
+*  byte 8..    : payload
+*  last 2 bytes: CRC-16/CCITT-FALSE of bytes 2 .. end of payload
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: stream_frame_crc16
+********************************************************************************
+* Summary:
+*  Calculates the CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF)
+*  of a buffer.
+*
+* Parameters:
+*  const uint8_t *data - Data to be checked
+*  uint32_t size       - Number of bytes
+*
+* Return:
+*  uint16_t - CRC value
+*
+*******************************************************************************/
+uint16_t stream_frame_crc16(const uint8_t *data, uint32_t size)
+{
+    uint16_t crc = 0xFFFFu;
+    uint32_t i;
+    uint32_t bit;
+
+    for (i = 0u; i < size; i++)
+    {
+        crc ^= (uint16_t)((uint16_t)data[i] << 8);
+
+        for (bit = 0u; bit < 8u; bit++)
+        {
+            crc = ((crc & 0x8000u) != 0u) ? (uint16_t)((crc << 1) ^ 0x1021u) : (uint16_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/*******************************************************************************
+* Function Name: stream_frame_finish
+********************************************************************************
+* Summary:
+*  Completes a frame whose payload has already been written at
+*  frame[STREAM_FRAME_HEADER_SIZE]: fills in the header and appends the CRC.
+*
+* Parameters:
+*  uint8_t *frame    - Frame buffer, at least length + STREAM_FRAME_OVERHEAD bytes
+*  uint8_t type      - Frame type
+*  uint16_t sequence - Sequence number of the frame
+*  uint32_t length   - Payload length in bytes
+*
+* Return:
+*  uint32_t - Total size of the frame in bytes
+*
+*******************************************************************************/
+uint32_t stream_frame_finish(uint8_t *frame, uint8_t type, uint16_t sequence, uint32_t length)
+{
+    uint32_t end = STREAM_FRAME_HEADER_SIZE + length;
+    uint16_t crc;
+
+    frame[0] = STREAM_FRAME_SYNC0;
+    frame[1] = STREAM_FRAME_SYNC1;
+    frame[2] = type;
+    frame[3] = 0u;
+    frame[4] = (uint8_t)(sequence & 0xFFu);
+    frame[5] = (uint8_t)(sequence >> 8);
+    frame[6] = (uint8_t)(length & 0xFFu);
+    frame[7] = (uint8_t)(length >> 8);
+
+    crc = stream_frame_crc16(&frame[2], end - 2u);
+    frame[end] = (uint8_t)(crc & 0xFFu);
+    frame[end + 1u] = (uint8_t)(crc >> 8);
+
+    return end + STREAM_FRAME_TRAILER_SIZE;
+}
+
+/*******************************************************************************
+* Function Name: stream_frame_pack_config
+********************************************************************************
+* Summary:
+*  Serializes the acquisition settings into a STREAM_FRAME_TYPE_CONFIG payload.
+*
+* Parameters:
+*  uint8_t *payload                     - Output buffer, at least
+*                                         STREAM_FRAME_CONFIG_SIZE bytes
+*  const stream_frame_config_t *config  - Settings to be serialized
+*
+* Return:
+*  uint32_t - Payload length in bytes
+*
+*******************************************************************************/
+uint32_t stream_frame_pack_config(uint8_t *payload, const stream_frame_config_t *config)
+{
+    uint32_t i;
+
+    payload[0] = config->outputFormat;
+    payload[1] = config->blockSamples;
+    payload[2] = (uint8_t)(config->averageCount & 0xFFu);
+    payload[3] = (uint8_t)(config->averageCount >> 8);
+    payload[4] = (uint8_t)(config->bandGapMv & 0xFFu);
+    payload[5] = (uint8_t)(config->bandGapMv >> 8);
+
+    for (i = 0u; i < 4u; i++)
+    {
+        payload[6u + i] = (uint8_t)(config->tickHz >> (8u * i));
+    }
+    for (i = 0u; i < 8u; i++)
+    {
+        payload[10u + i] = (uint8_t)(config->time >> (8u * i));
+    }
+
+    return STREAM_FRAME_CONFIG_SIZE;
+}
+
+/*******************************************************************************
+* Function Name: stream_frame_unpack_config
+********************************************************************************
+* Summary:
+*  Reads the acquisition settings from the payload of a configuration frame.
+*
+* Parameters:
+*  const uint8_t *payload         - Payload of a STREAM_FRAME_TYPE_CONFIG frame
+*  uint32_t size                  - Payload length in bytes
+*  stream_frame_config_t *config  - Receives the settings
+*
+* Return:
+*  uint32_t - Number of bytes read, 0 if the payload is too short
+*
+*******************************************************************************/
+uint32_t stream_frame_unpack_config(const uint8_t *payload, uint32_t size, stream_frame_config_t *config)
+{
+    uint32_t i;
+
+    if (size < STREAM_FRAME_CONFIG_SIZE)
+    {
+        return 0u;
+    }
+
+    config->outputFormat = payload[0];
+    config->blockSamples = payload[1];
+    config->averageCount = (uint16_t)(payload[2] | ((uint16_t)payload[3] << 8));
+    config->bandGapMv = (uint16_t)(payload[4] | ((uint16_t)payload[5] << 8));
+
+    config->tickHz = 0u;
+    for (i = 0u; i < 4u; i++)
+    {
+        config->tickHz |= (uint32_t)payload[6u + i] << (8u * i);
+    }
+    config->time = 0u;
+    for (i = 0u; i < 8u; i++)
+    {
+        config->time |= (uint64_t)payload[10u + i] << (8u * i);
+    }
+
+    return STREAM_FRAME_CONFIG_SIZE;
+}
+
+/*******************************************************************************
+* Function Name: stream_frame_pack_varint
+********************************************************************************
+* Summary:
+*  Writes an unsigned value in LEB128 format: 7 bits per byte, least
+*  significant group first, bit 7 set in every byte but the last. Small
+*  values, such as the time between two sample frames, take few bytes.
+*
+* Parameters:
+*  uint8_t *payload - Destination, at least STREAM_FRAME_VARINT_MAX_SIZE bytes
+*  uint64_t value   - Value to be written
+*
+* Return:
+*  uint32_t - Number of bytes written
+*
+*******************************************************************************/
+uint32_t stream_frame_pack_varint(uint8_t *payload, uint64_t value)
+{
+    uint32_t size = 0u;
+
+    while (value >= 0x80u)
+    {
+        payload[size++] = (uint8_t)((value & 0x7Fu) | 0x80u);
+        value >>= 7;
+    }
+    payload[size++] = (uint8_t)value;
+
+    return size;
+}
+
+/*******************************************************************************
+* Function Name: stream_frame_unpack_varint
+********************************************************************************
+* Summary:
+*  Reads a value written by stream_frame_pack_varint().
+*
+* Parameters:
+*  const uint8_t *payload - Source
+*  uint32_t size          - Number of bytes available at payload
+*  uint64_t *value        - Receives the value
+*
+* Return:
+*  uint32_t - Number of bytes read, 0 if the value is truncated or too long
+*
+*******************************************************************************/
+uint32_t stream_frame_unpack_varint(const uint8_t *payload, uint32_t size, uint64_t *value)
+{
+    uint32_t i;
+
+    *value = 0u;
+
+    for (i = 0u; (i < size) && (i < STREAM_FRAME_VARINT_MAX_SIZE); i++)
+    {
+        *value |= (uint64_t)(payload[i] & 0x7Fu) << (7u * i);
+
+        if ((payload[i] & 0x80u) == 0u)
+        {
+            return i + 1u;
+        }
+    }
+
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: stream_frame_sequence_gap
+********************************************************************************
+* Summary:
+*  Returns the number of frames missing between two frames received in a row,
+*  from their sequence numbers. The sequence number wraps at 16 bits, so a
+*  receiver that lost 65536 frames or more cannot tell. A frame received twice
+*  (the same sequence number again) is not a gap; the receiver should drop it.
+*
+* Parameters:
+*  uint16_t last     - Sequence number of the previous frame received
+*  uint16_t sequence - Sequence number of the frame received now
+*
+* Return:
+*  uint32_t - Number of missing frames, 0 if none or for a repeated frame
+*
+*******************************************************************************/
+uint32_t stream_frame_sequence_gap(uint16_t last, uint16_t sequence)
+{
+    if (sequence == last)
+    {
+        return 0u;
+    }
+
+    return (uint16_t)(sequence - last - 1u);
+}
+/* [] END OF FILE */
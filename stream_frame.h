@@ -0,0 +1,107 @@
+/******************************************************************************
+* File Name:   stream_frame.h
+*
+* Description: This file contains the interface of the framing layer of the binary
+*              sample stream.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef STREAM_FRAME_H
+#define STREAM_FRAME_H
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Synchronization bytes at the start of every frame */
+#define STREAM_FRAME_SYNC0 (0xA5u)
+#define STREAM_FRAME_SYNC1 (0x5Au)
+
+/* Frame header: sync (2), type (1), reserved (1), sequence (2), length (2) */
+#define STREAM_FRAME_HEADER_SIZE (8u)
+
+/* Frame trailer: CRC-16/CCITT-FALSE over type .. end of payload */
+#define STREAM_FRAME_TRAILER_SIZE (2u)
+
+/* Frame overhead added around a payload */
+#define STREAM_FRAME_OVERHEAD (STREAM_FRAME_HEADER_SIZE + STREAM_FRAME_TRAILER_SIZE)
+
+/* Frame types */
+#define STREAM_FRAME_TYPE_CONFIG  (0x01u)   /* stream_frame_config_t payload */
+#define STREAM_FRAME_TYPE_SAMPLES (0x02u)   /* Time delta (varint) and one stream_encode_block() block */
+
+/* Size of the STREAM_FRAME_TYPE_CONFIG payload */
+#define STREAM_FRAME_CONFIG_SIZE (18u)
+
+/* Largest size of a varint (LEB128) encoded 64-bit value */
+#define STREAM_FRAME_VARINT_MAX_SIZE (10u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Acquisition settings that apply to the sample frames that follow */
+typedef struct
+{
+    uint8_t outputFormat;
+    uint8_t blockSamples;
+    uint16_t averageCount;
+    uint16_t bandGapMv;
+    uint32_t tickHz;        /* Time base ticks per second */
+    uint64_t time;          /* Time of the first sample of the next sample frame */
+} stream_frame_config_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint16_t stream_frame_crc16(const uint8_t *data, uint32_t size);
+uint32_t stream_frame_finish(uint8_t *frame, uint8_t type, uint16_t sequence, uint32_t length);
+uint32_t stream_frame_pack_config(uint8_t *payload, const stream_frame_config_t *config);
+uint32_t stream_frame_unpack_config(const uint8_t *payload, uint32_t size, stream_frame_config_t *config);
+uint32_t stream_frame_pack_varint(uint8_t *payload, uint64_t value);
+uint32_t stream_frame_unpack_varint(const uint8_t *payload, uint32_t size, uint64_t *value);
+uint32_t stream_frame_sequence_gap(uint16_t last, uint16_t sequence);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* STREAM_FRAME_H */
+/* [] END OF FILE */
@@ -0,0 +1,78 @@
+/******************************************************************************
+* File Name:   tcm_placement.h
+*
+* Description: This file contains the macros that place the interrupt handler,
+*              the result processing kernels and the buffers they use in the
+*              tightly-coupled memories (ITCM/DTCM) of the Cortex-M7.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef TCM_PLACEMENT_H
+#define TCM_PLACEMENT_H
+
+#if defined(__ARM_ARCH)
+#include "cy_pdl.h"
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 to place the hot code and data in the TCMs, 0 to leave them in flash/SRAM (see Makefile) */
+#ifndef TCM_PLACEMENT_ENABLE
+#define TCM_PLACEMENT_ENABLE (0)
+#endif
+
+/* Prefix of a function definition executed from ITCM, and of a variable
+ * definition held in DTCM. The startup code copies .cy_itcm from flash and
+ * initializes .cy_dtcm like .data. Both expand to nothing in a build for a PC */
+#if (TCM_PLACEMENT_ENABLE) && defined(__ARM_ARCH)
+#define TCM_CODE CY_SECTION(".cy_itcm")
+#define TCM_DATA CY_SECTION(".cy_dtcm")
+#else
+#define TCM_CODE
+#define TCM_DATA
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* TCM_PLACEMENT_H */
+/* [] END OF FILE */
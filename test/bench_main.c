@@ -0,0 +1,66 @@
+/******************************************************************************
+* File Name:   bench_main.c
+*
+* Description: This file contains the driver of the processing pipeline
+*              benchmark. It runs benchmark_run() natively, with times in
+*              nanoseconds, or on the QEMU mps2-an500 machine, with times in
+*              SysTick ticks, and prints the stage timings and the averaging
+*              split sweep in CSV format.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "benchmark.h"
+#include "cycle_probe.h"
+
+#if !(BENCHMARK_ENABLE)
+#error "Build with -DBENCHMARK_ENABLE=1, see the bench target of test/Makefile"
+#endif
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Starts the time base of the probes and runs the benchmark once.
+*
+*******************************************************************************/
+int main(void)
+{
+    cycle_probe_init();
+    benchmark_run();
+
+    return 0;
+}
+/* [] END OF FILE */
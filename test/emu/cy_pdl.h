@@ -0,0 +1,385 @@
+/******************************************************************************
+* File Name:   cy_pdl.h
+*
+* Description: This file contains the subset of the PDL and CMSIS interface that
+*              the application uses, for the host emulation of the device
+*              (emu.c). The names and values follow the PDL; the peripherals are
+*              emulated state instead of registers, and the interrupts are
+*              delivered as signals.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CY_PDL_H
+#define CY_PDL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+typedef uint32_t cy_rslt_t;
+#define CY_RSLT_SUCCESS         (0u)
+
+#define CY_ASSERT(x)            do { if (!(x)) { emu_assert_failed(__FILE__, __LINE__); } } while (0)
+#define CY_SECTION(name)        __attribute__((section(name)))
+#define CY_ALIGN(align)         __attribute__((aligned(align)))
+#define CY_UNUSED_PARAMETER(x)  ((void)(x))
+#define CY_ARRAY_SIZE(x)        (sizeof(x) / sizeof((x)[0]))
+
+/* Number of channels of a SAR2 unit */
+#define CY_SAR2_NUM_CHANNELS    (32u)
+
+/* SAR2 interrupt flags of a channel */
+#define CY_SAR2_INT_GRP_DONE        (1UL << 0)
+#define CY_SAR2_INT_GRP_CANCELLED   (1UL << 1)
+#define CY_SAR2_INT_GRP_OVERFLOW    (1UL << 2)
+#define CY_SAR2_INT_CH_RANGE        (1UL << 8)
+#define CY_SAR2_INT_CH_PULSE        (1UL << 9)
+#define CY_SAR2_INT_CH_OVERFLOW     (1UL << 10)
+
+/* SAR2 result status flags */
+#define CY_SAR2_STATUS_VALID        (1UL << 31)
+#define CY_SAR2_STATUS_RANGE        (1UL << 30)
+#define CY_SAR2_STATUS_PULSE        (1UL << 29)
+
+/* Peripheral instances */
+#define PASS0_SAR0          (&EMU_PASS0_SAR0)
+#define PASS0_SAR1          (&EMU_PASS0_SAR1)
+#define PASS0_SAR2          (&EMU_PASS0_SAR2)
+#define PASS0_EPASS_MMIO    (&EMU_PASS0_EPASS_MMIO)
+#define SCB7                (&EMU_SCB7)
+
+/* Core registers: reading DWT, SysTick, or SCB brings the counters and the
+ * pending SysTick interrupt up to date */
+#define DWT                 (emu_dwt())
+#define SysTick             (emu_systick())
+#define SCB                 (emu_scb())
+#define CoreDebug           (&EMU_CORE_DEBUG)
+
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+#define SysTick_CTRL_ENABLE_Msk     (1UL << 0)
+#define SysTick_CTRL_TICKINT_Msk    (1UL << 1)
+#define SysTick_CTRL_CLKSOURCE_Msk  (1UL << 2)
+#define SysTick_LOAD_RELOAD_Msk     (0x00FFFFFFUL)
+#define SCB_ICSR_PENDSTSET_Msk      (1UL << 26)
+
+/* Return value of Cy_SCB_UART_Get() without a received byte */
+#define CY_SCB_UART_RX_NO_DATA      (0xFFFFFFFFUL)
+
+/* Position of the CPU interrupt in cy_stc_sysint_t.intrSrc */
+#define CY_SYSINT_INTRSRC_MUXIRQ_SHIFT  (16u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* CPU interrupts: the SysTick exception and the NVIC lines of the CM7 */
+typedef enum
+{
+    SysTick_IRQn = -1,
+    NvicMux0_IRQn = 0,
+    NvicMux1_IRQn = 1,
+    NvicMux2_IRQn = 2,
+    NvicMux3_IRQn = 3,
+    NvicMux4_IRQn = 4,
+    NvicMux5_IRQn = 5,
+    NvicMux6_IRQn = 6,
+    NvicMux7_IRQn = 7
+} IRQn_Type;
+
+/* System interrupt sources, one per channel of a SAR2 unit: unit * 32 + channel */
+typedef enum
+{
+    pass_0_interrupts_sar_0_IRQn = 0,
+    pass_0_interrupts_sar_1_IRQn = 1,
+    pass_0_interrupts_sar_2_IRQn = 2,
+    pass_0_interrupts_sar_3_IRQn = 3,
+    pass_0_interrupts_sar_32_IRQn = 32,
+    pass_0_interrupts_sar_33_IRQn = 33,
+    pass_0_interrupts_sar_64_IRQn = 64,
+    pass_0_interrupts_sar_65_IRQn = 65
+} cy_en_intr_t;
+
+typedef void (*cy_israddress)(void);
+
+typedef struct
+{
+    uint32_t intrSrc;
+    uint32_t intrPriority;
+} cy_stc_sysint_t;
+
+typedef enum
+{
+    CY_SYSINT_SUCCESS = 0,
+    CY_SYSINT_BAD_PARAM = 1
+} cy_en_sysint_status_t;
+
+typedef enum
+{
+    CY_SAR2_SUCCESS = 0,
+    CY_SAR2_BAD_PARAM = 1
+} cy_en_sar2_status_t;
+
+typedef enum
+{
+    CY_SAR2_TRIGGER_OFF = 0,
+    CY_SAR2_TRIGGER_GENERIC0 = 1,
+    CY_SAR2_TRIGGER_CONTINUOUS = 15
+} cy_en_sar2_trigger_selection_t;
+
+typedef enum
+{
+    CY_SAR2_PREEMPTION_ABORT_CANCEL = 0,
+    CY_SAR2_PREEMPTION_ABORT_RESTART = 1,
+    CY_SAR2_PREEMPTION_ABORT_RESUME = 2,
+    CY_SAR2_PREEMPTION_FINISH_RESUME = 3
+} cy_en_sar2_preemption_type_t;
+
+typedef enum
+{
+    CY_SAR2_RESULT_ALIGNMENT_RIGHT = 0,
+    CY_SAR2_RESULT_ALIGNMENT_LEFT = 1
+} cy_en_sar2_result_alignment_t;
+
+typedef enum
+{
+    CY_SAR2_SIGN_EXTENTION_UNSIGNED = 0,
+    CY_SAR2_SIGN_EXTENTION_SIGNED = 1
+} cy_en_sar2_sign_extention_t;
+
+typedef enum
+{
+    CY_SAR2_RANGE_DETECTION_MODE_BELOW_LO = 0,
+    CY_SAR2_RANGE_DETECTION_MODE_INSIDE_RANGE = 1,
+    CY_SAR2_RANGE_DETECTION_MODE_ABOVE_HI = 2,
+    CY_SAR2_RANGE_DETECTION_MODE_OUTSIDE_RANGE = 3
+} cy_en_sar2_range_detection_mode_t;
+
+typedef enum
+{
+    CY_SAR2_REF_BUF_MODE_OFF = 0,
+    CY_SAR2_REF_BUF_MODE_ON = 1
+} cy_en_sar2_ref_buf_mode_t;
+
+/* Channel configuration, the fields of the PDL structure that the emulation uses */
+typedef struct
+{
+    bool channelHwEnable;
+    cy_en_sar2_trigger_selection_t triggerSelection;
+    uint8_t channelPriority;
+    cy_en_sar2_preemption_type_t preenptionType;
+    bool isGroupEnd;
+    uint8_t pinAddress;
+    uint16_t sampleTime;
+    cy_en_sar2_result_alignment_t resultAlignment;
+    cy_en_sar2_sign_extention_t signExtention;
+    uint16_t averageCount;
+    uint8_t rightShift;
+    cy_en_sar2_range_detection_mode_t rangeDetectionMode;
+    uint16_t rangeDetectionLoThreshold;
+    uint16_t rangeDetectionHiThreshold;
+    uint32_t interruptMask;
+} cy_stc_sar2_channel_config_t;
+
+typedef struct
+{
+    uint8_t preconditionTime;
+    bool enableIdlePowerDown;
+    const cy_stc_sar2_channel_config_t *channelConfig[CY_SAR2_NUM_CHANNELS];
+} cy_stc_sar2_config_t;
+
+/* The peripheral state is private to the emulation */
+typedef struct emu_sar PASS_SAR_Type;
+typedef struct emu_epass PASS_EPASS_MMIO_Type;
+typedef struct emu_scb CySCB_Type;
+
+typedef struct
+{
+    uint32_t oversample;
+} cy_stc_scb_uart_config_t;
+
+typedef struct
+{
+    uint32_t txBytes;
+} cy_stc_scb_uart_context_t;
+
+typedef enum
+{
+    CY_SCB_UART_SUCCESS = 0,
+    CY_SCB_UART_BAD_PARAM = 1
+} cy_en_scb_uart_status_t;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t LOAD;
+    volatile uint32_t VAL;
+    volatile uint32_t CALIB;
+} SysTick_Type;
+
+typedef struct
+{
+    volatile uint32_t ICSR;
+} SCB_Type;
+
+typedef enum
+{
+    CY_SYSPM_WAIT_FOR_INTERRUPT = 0,
+    CY_SYSPM_WAIT_FOR_EVENT = 1
+} cy_en_syspm_waitfor_t;
+
+typedef enum
+{
+    CY_SYSPM_SUCCESS = 0
+} cy_en_syspm_status_t;
+
+typedef enum
+{
+    CY_SYSCLK_CLKHF_NO_DIVIDE = 0,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_2 = 1,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_4 = 2,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_8 = 3
+} cy_en_clkhf_dividers_t;
+
+typedef enum
+{
+    CY_SYSCLK_SUCCESS = 0,
+    CY_SYSCLK_BAD_PARAM = 1
+} cy_en_sysclk_status_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern PASS_SAR_Type EMU_PASS0_SAR0;
+extern PASS_SAR_Type EMU_PASS0_SAR1;
+extern PASS_SAR_Type EMU_PASS0_SAR2;
+extern PASS_EPASS_MMIO_Type EMU_PASS0_EPASS_MMIO;
+extern CySCB_Type EMU_SCB7;
+extern CoreDebug_Type EMU_CORE_DEBUG;
+extern uint32_t SystemCoreClock;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void emu_assert_failed(const char *file, int line);
+DWT_Type *emu_dwt(void);
+SysTick_Type *emu_systick(void);
+SCB_Type *emu_scb(void);
+
+void __enable_irq(void);
+void __disable_irq(void);
+
+uint32_t Cy_SysLib_EnterCriticalSection(void);
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus);
+void Cy_SysLib_DelayUs(uint16_t microseconds);
+
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress userIsr);
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority);
+void NVIC_EnableIRQ(IRQn_Type IRQn);
+void NVIC_DisableIRQ(IRQn_Type IRQn);
+uint32_t SysTick_Config(uint32_t ticks);
+void SysTick_Handler(void);
+
+cy_en_sysclk_status_t Cy_SysClk_ClkHfSetDivider(uint32_t clkHf, cy_en_clkhf_dividers_t divider);
+void SystemCoreClockUpdate(void);
+cy_en_syspm_status_t Cy_SysPm_CpuEnterSleep(cy_en_syspm_waitfor_t waitFor);
+
+cy_en_sar2_status_t Cy_SAR2_Init(PASS_SAR_Type *base, const cy_stc_sar2_config_t *config);
+void Cy_SAR2_DeInit(PASS_SAR_Type *base);
+void Cy_SAR2_SetReferenceBufferMode(PASS_EPASS_MMIO_Type *base, cy_en_sar2_ref_buf_mode_t mode);
+cy_en_sar2_status_t Cy_SAR2_Channel_Init(PASS_SAR_Type *base, uint32_t channel,
+                                         const cy_stc_sar2_channel_config_t *channelConfig);
+void Cy_SAR2_Channel_SoftwareTrigger(PASS_SAR_Type *base, uint32_t channel);
+uint16_t Cy_SAR2_Channel_GetResult(PASS_SAR_Type *base, uint32_t channel, uint32_t *status);
+uint32_t Cy_SAR2_Channel_GetInterruptStatus(const PASS_SAR_Type *base, uint32_t channel);
+uint32_t Cy_SAR2_Channel_GetInterruptStatusMasked(const PASS_SAR_Type *base, uint32_t channel);
+void Cy_SAR2_Channel_ClearInterrupt(PASS_SAR_Type *base, uint32_t channel, uint32_t intrMask);
+void Cy_SAR2_Channel_SetInterruptMask(PASS_SAR_Type *base, uint32_t channel, uint32_t intrMask);
+
+cy_en_scb_uart_status_t Cy_SCB_UART_Init(CySCB_Type *base, const cy_stc_scb_uart_config_t *config,
+                                         cy_stc_scb_uart_context_t *context);
+void Cy_SCB_UART_Enable(CySCB_Type *base);
+uint32_t Cy_SCB_UART_Get(CySCB_Type const *base);
+uint32_t Cy_SCB_UART_PutArray(CySCB_Type *base, void *buffer, uint32_t size);
+
+/*******************************************************************************
+* Function Name: __DMB
+********************************************************************************
+* Summary:
+*  Data memory barrier. The interrupts of the emulation run on the main
+*  thread, a full fence is more than enough.
+*
+*******************************************************************************/
+static inline void __DMB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+/*******************************************************************************
+* Function Name: __CLZ
+********************************************************************************
+* Summary:
+*  Count leading zeros, 32 for 0 like the CLZ instruction.
+*
+*******************************************************************************/
+static inline uint32_t __CLZ(uint32_t value)
+{
+    return (value != 0u) ? (uint32_t)__builtin_clz(value) : 32u;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CY_PDL_H */
+/* [] END OF FILE */
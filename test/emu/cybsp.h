@@ -0,0 +1,80 @@
+/******************************************************************************
+* File Name:   cybsp.h
+*
+* Description: This file contains the board configuration of the host emulation:
+*              the debug UART and the SAR2 unit with the band gap and AN0
+*              channels, with the settings of design.modus.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CYBSP_H
+#define CYBSP_H
+
+#include "cy_pdl.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define UART_HW             (SCB7)
+
+#define CE_SAR2_HW          (PASS0_SAR0)
+#define CE_SAR2_VBG_IDX     (0u)
+#define CE_SAR2_AN0_IDX     (1u)
+#define CE_SAR2_CH1_IRQ     (pass_0_interrupts_sar_1_IRQn)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern const cy_stc_scb_uart_config_t UART_config;
+extern cy_stc_sar2_channel_config_t CE_SAR2_VBG_config;
+extern cy_stc_sar2_channel_config_t CE_SAR2_AN0_config;
+extern const cy_stc_sar2_config_t CE_SAR2_config;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t cybsp_init(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CYBSP_H */
+/* [] END OF FILE */
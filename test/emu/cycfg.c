@@ -0,0 +1,104 @@
+/******************************************************************************
+* File Name:   cycfg.c
+*
+* Description: This file contains the board configuration of the host emulation,
+*              in place of the configuration generated from design.modus: the
+*              debug UART and the SAR2 unit converting the band gap (channel 0)
+*              and AN0 (channel 1).
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "cybsp.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+const cy_stc_scb_uart_config_t UART_config =
+{
+    .oversample = 8u
+};
+
+/* Band gap, first channel of the group, software triggered */
+cy_stc_sar2_channel_config_t CE_SAR2_VBG_config =
+{
+    .channelHwEnable = true,
+    .triggerSelection = CY_SAR2_TRIGGER_OFF,
+    .channelPriority = 0u,
+    .preenptionType = CY_SAR2_PREEMPTION_FINISH_RESUME,
+    .isGroupEnd = false,
+    .pinAddress = 0u,
+    .sampleTime = 120u,
+    .resultAlignment = CY_SAR2_RESULT_ALIGNMENT_RIGHT,
+    .signExtention = CY_SAR2_SIGN_EXTENTION_UNSIGNED,
+    .averageCount = 1u,
+    .rightShift = 0u,
+    .rangeDetectionMode = CY_SAR2_RANGE_DETECTION_MODE_BELOW_LO,
+    .rangeDetectionLoThreshold = 0u,
+    .rangeDetectionHiThreshold = 65535u,
+    .interruptMask = 0u
+};
+
+/* AN0, last channel of the group */
+cy_stc_sar2_channel_config_t CE_SAR2_AN0_config =
+{
+    .channelHwEnable = true,
+    .triggerSelection = CY_SAR2_TRIGGER_OFF,
+    .channelPriority = 0u,
+    .preenptionType = CY_SAR2_PREEMPTION_FINISH_RESUME,
+    .isGroupEnd = true,
+    .pinAddress = 1u,
+    .sampleTime = 120u,
+    .resultAlignment = CY_SAR2_RESULT_ALIGNMENT_RIGHT,
+    .signExtention = CY_SAR2_SIGN_EXTENTION_UNSIGNED,
+    .averageCount = 1u,
+    .rightShift = 0u,
+    .rangeDetectionMode = CY_SAR2_RANGE_DETECTION_MODE_BELOW_LO,
+    .rangeDetectionLoThreshold = 0u,
+    .rangeDetectionHiThreshold = 65535u,
+    .interruptMask = CY_SAR2_INT_GRP_DONE
+};
+
+const cy_stc_sar2_config_t CE_SAR2_config =
+{
+    .preconditionTime = 0u,
+    .enableIdlePowerDown = false,
+    .channelConfig =
+    {
+        [CE_SAR2_VBG_IDX] = &CE_SAR2_VBG_config,
+        [CE_SAR2_AN0_IDX] = &CE_SAR2_AN0_config
+    }
+};
+/* [] END OF FILE */
@@ -0,0 +1,1593 @@
+/******************************************************************************
+* File Name:   emu.c
+*
+* Description: This file contains the host emulation of the device for the
+*              application: the SAR2 units, the NVIC, the SysTick timer,
+*              the DWT cycle counter, the CPU clock divider, and the debug
+*              UART. The interrupts are delivered with a POSIX timer signal on
+*              the main thread, so the interrupt handlers of main.c interrupt
+*              its main loop like on the device, and the critical sections
+*              block the signal. The SAR2 units convert the signal sources of
+*              signal_source.c with the conversion time of their configuration;
+*              the UART sends to the standard output at the baud rate and
+*              reads the keys from the standard input.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "cy_retarget_io.h"
+#include "adc_result.h"
+#include "sar2_model.h"
+#include "signal_source.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Clock of the CM7 cores (CLK_HF1) before the divider, in Hz */
+#define EMU_CPU_CLOCK_HZ        (200000000u)
+
+/* SAR clock: the 100 MHz peripheral clock divided by 26 (peri divider 8.1 of design.modus) */
+#define EMU_SAR_CLOCK_HZ        (100000000u / 26u)
+
+/* SAR clock cycles of one conversion after the sample time */
+#define EMU_SAR_CONVERT_CYCLES  (16u)
+
+/* Number of SAR2 units of the ePASS */
+#define EMU_SAR_UNITS           (3u)
+
+/* Number of CPU interrupt lines (NvicMux0 to NvicMux7) */
+#define EMU_NVIC_LINES          (8u)
+
+/* Handler calls per interrupt before a line that stays active is left for the next event */
+#define EMU_DISPATCH_MAX        (16u)
+
+/* Depth of the UART transmit FIFO in bytes */
+#define EMU_UART_FIFO_SIZE      (128u)
+
+/* Defaults of the environment variables EMU_BAUD, EMU_KEY_MS, EMU_SIGNAL, and
+ * EMU_SAR_STOP_MS (0: never) */
+#define EMU_BAUD_DEFAULT        (115200u)
+#define EMU_KEY_MS_DEFAULT      (200u)
+#define EMU_SIGNAL_DEFAULT      (SIGNAL_SINE)
+#define EMU_SAR_STOP_MS_DEFAULT (0u)
+
+/* Seed of the signal sources of the SAR2 inputs */
+#define EMU_SIGNAL_SEED         (240997u)
+
+#define EMU_NS_PER_S            (1000000000ull)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* SAR2 unit: channel configurations, inputs, results, and the group in conversion */
+struct emu_sar
+{
+    bool enabled;
+    bool busy;                  /* A group is being converted */
+    bool triggerPending;        /* A software trigger arrived while the group was busy */
+    uint32_t groupFirst;        /* First channel of the group being converted */
+    uint64_t doneNs;            /* Time the group being converted is done */
+    bool configured[CY_SAR2_NUM_CHANNELS];
+    cy_stc_sar2_channel_config_t config[CY_SAR2_NUM_CHANNELS];
+    signal_source_t input[CY_SAR2_NUM_CHANNELS];
+    uint16_t result[CY_SAR2_NUM_CHANNELS];
+    uint32_t status[CY_SAR2_NUM_CHANNELS];
+    uint32_t intr[CY_SAR2_NUM_CHANNELS];
+    uint32_t intrMask[CY_SAR2_NUM_CHANNELS];
+};
+
+struct emu_epass
+{
+    cy_en_sar2_ref_buf_mode_t refBufMode;
+};
+
+/* UART: transmit FIFO level at txUpdateNs, and the pacing of the received keys */
+struct emu_scb
+{
+    bool enabled;
+    uint32_t baud;
+    uint32_t txLevel;
+    uint64_t txUpdateNs;
+    uint64_t keyGapNs;
+    uint64_t nextKeyNs;
+    bool rxEnd;
+};
+
+/* CPU interrupt line and the system interrupt source routed to it */
+typedef struct
+{
+    cy_israddress handler;
+    uint32_t source;
+    uint32_t priority;
+    bool enabled;
+} emu_nvic_line_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+PASS_SAR_Type EMU_PASS0_SAR0;
+PASS_SAR_Type EMU_PASS0_SAR1;
+PASS_SAR_Type EMU_PASS0_SAR2;
+PASS_EPASS_MMIO_Type EMU_PASS0_EPASS_MMIO;
+CySCB_Type EMU_SCB7;
+CoreDebug_Type EMU_CORE_DEBUG;
+uint32_t SystemCoreClock = EMU_CPU_CLOCK_HZ;
+
+static PASS_SAR_Type *const g_emuSar[EMU_SAR_UNITS] = { &EMU_PASS0_SAR0, &EMU_PASS0_SAR1, &EMU_PASS0_SAR2 };
+static emu_nvic_line_t g_emuNvic[EMU_NVIC_LINES];
+
+/* Timer raising the interrupt signal at the next event */
+static timer_t g_emuTimer;
+static sigset_t g_emuIrqSet;
+
+/* Set while the interrupt handlers run; the signal is blocked then */
+static volatile sig_atomic_t g_emuInIrq = 0;
+
+/* Time of the event whose interrupt handlers run, and the host time they started at */
+static uint64_t g_emuIrqNs = 0u;
+static uint64_t g_emuIrqStartNs = 0u;
+
+/* CPU cycles at g_emuCycleBaseNs, and the current CPU clock */
+static uint64_t g_emuCycleBase = 0u;
+static uint64_t g_emuCycleBaseNs = 0u;
+static uint32_t g_emuCpuHz = EMU_CPU_CLOCK_HZ;
+
+/* Time from which the SAR2 units no longer complete a group, 0 for never */
+static uint64_t g_emuSarStopNs = 0u;
+
+static DWT_Type g_emuDwt;
+
+/* SysTick registers, their values after the last update to detect writes, the CPU
+ * cycle the counter was last (re)started at, and the cycle of the next wrap */
+static SysTick_Type g_emuSysTick;
+static SysTick_Type g_emuSysTickSeen;
+static uint64_t g_emuTickStart = 0u;
+static uint64_t g_emuTickNext = 0u;
+static bool g_emuTickPending = false;
+
+/* System control block, only the SysTick pending bit of ICSR */
+static SCB_Type g_emuScb;
+
+/* Terminal settings of the standard input, restored at exit */
+static struct termios g_emuTermios;
+static bool g_emuTermiosSaved = false;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void SysTick_Handler(void) __attribute__((weak));
+
+/*******************************************************************************
+* Function Name: emu_now
+********************************************************************************
+* Summary:
+*  Returns the monotonic time in nanoseconds.
+*
+*******************************************************************************/
+static uint64_t emu_now(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * EMU_NS_PER_S) + (uint64_t)ts.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: emu_time
+********************************************************************************
+* Summary:
+*  Returns the time the peripherals and the counters see an access at: in an
+*  interrupt handler the time of its event plus the time the handler has run,
+*  so a signal delivered late by the host does not delay the conversions the
+*  handler starts or add to the latencies it measures.
+*
+*******************************************************************************/
+static uint64_t emu_time(void)
+{
+    uint64_t now = emu_now();
+
+    return (g_emuInIrq != 0) ? (g_emuIrqNs + (now - g_emuIrqStartNs)) : now;
+}
+
+/*******************************************************************************
+* Function Name: emu_scale
+********************************************************************************
+* Summary:
+*  Returns value * mul / div without overflowing for value up to 2^64 / mul
+*  per div.
+*
+*******************************************************************************/
+static uint64_t emu_scale(uint64_t value, uint64_t mul, uint64_t div)
+{
+    return ((value / div) * mul) + (((value % div) * mul) / div);
+}
+
+/*******************************************************************************
+* Function Name: emu_cycles
+********************************************************************************
+* Summary:
+*  Returns the number of CPU cycles from the start of the emulation to time
+*  now, at the CPU clock of each period.
+*
+*******************************************************************************/
+static uint64_t emu_cycles(uint64_t now)
+{
+    /* A handler can run at an event time before the last clock change */
+    if (now < g_emuCycleBaseNs)
+    {
+        now = g_emuCycleBaseNs;
+    }
+
+    return g_emuCycleBase + emu_scale(now - g_emuCycleBaseNs, g_emuCpuHz, EMU_NS_PER_S);
+}
+
+/*******************************************************************************
+* Function Name: emu_cycles_time
+********************************************************************************
+* Summary:
+*  Returns the time at which the CPU cycle counter reaches cycles at the
+*  current CPU clock, rounded up.
+*
+*******************************************************************************/
+static uint64_t emu_cycles_time(uint64_t cycles)
+{
+    uint64_t delta = (cycles > g_emuCycleBase) ? (cycles - g_emuCycleBase) : 0u;
+
+    return g_emuCycleBaseNs + emu_scale(delta, EMU_NS_PER_S, g_emuCpuHz) + 1u;
+}
+
+/*******************************************************************************
+* Function Name: emu_lock
+********************************************************************************
+* Summary:
+*  Blocks the interrupt signal and returns whether it was blocked already.
+*
+*******************************************************************************/
+static bool emu_lock(void)
+{
+    sigset_t old;
+
+    if (g_emuInIrq != 0)
+    {
+        return true;
+    }
+
+    (void)sigprocmask(SIG_BLOCK, &g_emuIrqSet, &old);
+
+    return (sigismember(&old, SIGALRM) == 1);
+}
+
+/*******************************************************************************
+* Function Name: emu_unlock
+********************************************************************************
+* Summary:
+*  Unblocks the interrupt signal unless it was blocked before emu_lock().
+*
+*******************************************************************************/
+static void emu_unlock(bool wasLocked)
+{
+    if (!wasLocked)
+    {
+        (void)sigprocmask(SIG_UNBLOCK, &g_emuIrqSet, NULL);
+    }
+}
+
+/*******************************************************************************
+* Function Name: emu_sar_format
+********************************************************************************
+* Summary:
+*  Returns the output format (enum OutputFmt) of a channel configuration.
+*
+*******************************************************************************/
+static int32_t emu_sar_format(const cy_stc_sar2_channel_config_t *config)
+{
+    if (config->resultAlignment == CY_SAR2_RESULT_ALIGNMENT_LEFT)
+    {
+        return LEFT_ALIGNED;
+    }
+
+    return (config->signExtention == CY_SAR2_SIGN_EXTENTION_SIGNED) ? SIGNED_RIGHT_ALIGNED : UNSIGNED_RIGHT_ALIGNED;
+}
+
+/*******************************************************************************
+* Function Name: emu_sar_average
+********************************************************************************
+* Summary:
+*  Returns the number of conversions averaged into one result of a channel.
+*
+*******************************************************************************/
+static uint32_t emu_sar_average(const cy_stc_sar2_channel_config_t *config)
+{
+    return (config->averageCount != 0u) ? config->averageCount : 1u;
+}
+
+/*******************************************************************************
+* Function Name: emu_sar_start
+********************************************************************************
+* Summary:
+*  Starts the conversion of the group beginning with channel first at time
+*  start. The group takes the sample and conversion time of each of its
+*  channels, times their average count.
+*
+*******************************************************************************/
+static void emu_sar_start(PASS_SAR_Type *sar, uint32_t first, uint64_t start)
+{
+    uint64_t cycles = 0u;
+    uint32_t ch;
+
+    for (ch = first; (ch < CY_SAR2_NUM_CHANNELS) && sar->configured[ch]; ch++)
+    {
+        const cy_stc_sar2_channel_config_t *config = &sar->config[ch];
+
+        if (config->channelHwEnable)
+        {
+            cycles += (uint64_t)emu_sar_average(config) * (config->sampleTime + EMU_SAR_CONVERT_CYCLES);
+        }
+        if (config->isGroupEnd)
+        {
+            break;
+        }
+    }
+
+    sar->busy = true;
+    sar->groupFirst = first;
+    sar->doneNs = start + emu_scale(cycles, EMU_NS_PER_S, EMU_SAR_CLOCK_HZ);
+
+    /* A stopped unit stays busy, as if its clock had failed */
+    if ((g_emuSarStopNs != 0u) && (sar->doneNs >= g_emuSarStopNs))
+    {
+        sar->doneNs = UINT64_MAX;
+    }
+}
+
+/*******************************************************************************
+* Function Name: emu_sar_done
+********************************************************************************
+* Summary:
+*  Completes the group in conversion: writes the result of each channel,
+*  sets the channel overflow flag if the previous result was not read, the
+*  range flag if the result meets the range detection condition, and the
+*  group-done flag, or the group overflow flag if group-done was still set.
+*  A continuous group restarts right away, otherwise a pending software
+*  trigger starts the next group.
+*
+*******************************************************************************/
+static void emu_sar_done(PASS_SAR_Type *sar)
+{
+    uint32_t ch;
+
+    for (ch = sar->groupFirst; (ch < CY_SAR2_NUM_CHANNELS) && sar->configured[ch]; ch++)
+    {
+        const cy_stc_sar2_channel_config_t *config = &sar->config[ch];
+        int32_t outputFormat = emu_sar_format(config);
+
+        if (config->channelHwEnable)
+        {
+            uint16_t result = signal_source_next_result(&sar->input[ch], emu_sar_average(config), config->rightShift,
+                                                        outputFormat);
+            bool hit = sar2_model_range_hit(result, (int32_t)config->rangeDetectionMode,
+                                            config->rangeDetectionLoThreshold, config->rangeDetectionHiThreshold,
+                                            outputFormat);
+
+            if ((sar->status[ch] & CY_SAR2_STATUS_VALID) != 0u)
+            {
+                sar->intr[ch] |= CY_SAR2_INT_CH_OVERFLOW;
+            }
+            sar->result[ch] = result;
+            sar->status[ch] = CY_SAR2_STATUS_VALID | (hit ? CY_SAR2_STATUS_RANGE : 0u);
+            if (hit)
+            {
+                sar->intr[ch] |= CY_SAR2_INT_CH_RANGE;
+            }
+        }
+
+        if (config->isGroupEnd)
+        {
+            if ((sar->intr[ch] & CY_SAR2_INT_GRP_DONE) != 0u)
+            {
+                sar->intr[ch] |= CY_SAR2_INT_GRP_OVERFLOW;
+            }
+            sar->intr[ch] |= CY_SAR2_INT_GRP_DONE;
+            break;
+        }
+    }
+
+    sar->busy = false;
+
+    if (sar->config[sar->groupFirst].triggerSelection == CY_SAR2_TRIGGER_CONTINUOUS)
+    {
+        sar->triggerPending = false;
+        emu_sar_start(sar, sar->groupFirst, sar->doneNs);
+    }
+    else if (sar->triggerPending)
+    {
+        sar->triggerPending = false;
+        emu_sar_start(sar, sar->groupFirst, sar->doneNs);
+    }
+}
+
+/*******************************************************************************
+* Function Name: emu_systick_sync
+********************************************************************************
+* Summary:
+*  Brings the SysTick counter up to date. A register written by the
+*  application since the last update restarts the counter from LOAD.
+*
+*******************************************************************************/
+static void emu_systick_sync(uint64_t now)
+{
+    uint64_t cycles = emu_cycles(now);
+
+    if ((g_emuSysTick.CTRL != g_emuSysTickSeen.CTRL) || (g_emuSysTick.LOAD != g_emuSysTickSeen.LOAD) ||
+        (g_emuSysTick.VAL != g_emuSysTickSeen.VAL))
+    {
+        g_emuSysTick.LOAD &= SysTick_LOAD_RELOAD_Msk;
+        g_emuTickStart = cycles;
+        g_emuTickNext = cycles + g_emuSysTick.LOAD + 1u;
+    }
+
+    /* A handler can run at an event time before the last restart */
+    if (cycles < g_emuTickStart)
+    {
+        cycles = g_emuTickStart;
+    }
+
+    if ((g_emuSysTick.CTRL & SysTick_CTRL_ENABLE_Msk) != 0u)
+    {
+        g_emuSysTick.VAL = g_emuSysTick.LOAD - (uint32_t)((cycles - g_emuTickStart) % (g_emuSysTick.LOAD + 1u));
+    }
+
+    g_emuSysTickSeen = g_emuSysTick;
+}
+
+/*******************************************************************************
+* Function Name: emu_systick_active
+********************************************************************************
+* Summary:
+*  Tells whether the SysTick timer is running with its interrupt enabled.
+*
+*******************************************************************************/
+static bool emu_systick_active(void)
+{
+    const uint32_t mask = SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk;
+
+    return ((g_emuSysTick.CTRL & mask) == mask);
+}
+
+/*******************************************************************************
+* Function Name: emu_line_active
+********************************************************************************
+* Summary:
+*  Tells whether a CPU interrupt line is enabled and its source, a SAR2
+*  channel, has an unmasked interrupt flag set.
+*
+*******************************************************************************/
+static bool emu_line_active(const emu_nvic_line_t *line)
+{
+    uint32_t unit = line->source / CY_SAR2_NUM_CHANNELS;
+    uint32_t ch = line->source % CY_SAR2_NUM_CHANNELS;
+
+    return line->enabled && (line->handler != NULL) && (unit < EMU_SAR_UNITS) &&
+           ((g_emuSar[unit]->intr[ch] & g_emuSar[unit]->intrMask[ch]) != 0u);
+}
+
+/*******************************************************************************
+* Function Name: emu_dispatch
+********************************************************************************
+* Summary:
+*  Calls the handlers of the pending interrupts, SysTick first, then the
+*  CPU interrupt lines, until none is pending.
+*
+*******************************************************************************/
+static void emu_dispatch(void)
+{
+    bool again = true;
+    uint32_t calls;
+    uint32_t i;
+
+    for (calls = 0u; again && (calls < EMU_DISPATCH_MAX); calls++)
+    {
+        again = false;
+
+        if (g_emuTickPending && emu_systick_active())
+        {
+            g_emuTickPending = false;
+            SysTick_Handler();
+            again = true;
+        }
+
+        for (i = 0u; i < EMU_NVIC_LINES; i++)
+        {
+            if (emu_line_active(&g_emuNvic[i]))
+            {
+                g_emuNvic[i].handler();
+                again = true;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: emu_process
+********************************************************************************
+* Summary:
+*  Processes the events up to time now in their order: the completion of
+*  the SAR2 groups and the SysTick wraps. With dispatch set, the interrupt
+*  handlers are called after each event, like the CPU would have done at its
+*  time, so a delayed signal catches up one event at a time.
+*
+*******************************************************************************/
+static void emu_process(uint64_t now, bool dispatch)
+{
+    for (;;)
+    {
+        PASS_SAR_Type *next = NULL;
+        uint64_t nextNs = UINT64_MAX;
+        uint32_t unit;
+
+        for (unit = 0u; unit < EMU_SAR_UNITS; unit++)
+        {
+            if (g_emuSar[unit]->busy && (g_emuSar[unit]->doneNs < nextNs))
+            {
+                next = g_emuSar[unit];
+                nextNs = next->doneNs;
+            }
+        }
+
+        if (emu_systick_active() && (emu_cycles_time(g_emuTickNext) < nextNs))
+        {
+            next = NULL;
+            nextNs = emu_cycles_time(g_emuTickNext);
+        }
+
+        if (nextNs > now)
+        {
+            break;
+        }
+
+        if (next != NULL)
+        {
+            emu_sar_done(next);
+        }
+        else
+        {
+            g_emuTickNext += g_emuSysTick.LOAD + 1u;
+            g_emuTickPending = true;
+        }
+
+        if (dispatch)
+        {
+            g_emuIrqNs = nextNs;
+            g_emuIrqStartNs = emu_now();
+            emu_dispatch();
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: emu_schedule
+********************************************************************************
+* Summary:
+*  Arms the timer for the next event, or for right away if an interrupt is
+*  pending. The signal handler does this once on its way out.
+*
+*******************************************************************************/
+static void emu_schedule(void)
+{
+    struct itimerspec spec = { 0 };
+    uint64_t nextNs = UINT64_MAX;
+    uint32_t i;
+
+    if (g_emuInIrq != 0)
+    {
+        return;
+    }
+
+    for (i = 0u; i < EMU_SAR_UNITS; i++)
+    {
+        if (g_emuSar[i]->busy && (g_emuSar[i]->doneNs < nextNs))
+        {
+            nextNs = g_emuSar[i]->doneNs;
+        }
+    }
+
+    if (emu_systick_active())
+    {
+        if (g_emuTickPending)
+        {
+            nextNs = 1u;
+        }
+        else if (emu_cycles_time(g_emuTickNext) < nextNs)
+        {
+            nextNs = emu_cycles_time(g_emuTickNext);
+        }
+    }
+
+    for (i = 0u; i < EMU_NVIC_LINES; i++)
+    {
+        if (emu_line_active(&g_emuNvic[i]))
+        {
+            nextNs = 1u;
+        }
+    }
+
+    if (nextNs != UINT64_MAX)
+    {
+        spec.it_value.tv_sec = (time_t)(nextNs / EMU_NS_PER_S);
+        spec.it_value.tv_nsec = (long)(nextNs % EMU_NS_PER_S);
+    }
+
+    (void)timer_settime(g_emuTimer, TIMER_ABSTIME, &spec, NULL);
+}
+
+/*******************************************************************************
+* Function Name: emu_enter
+********************************************************************************
+* Summary:
+*  Blocks the interrupt signal and brings the peripherals up to date before
+*  the application accesses them. In an interrupt handler the signal handler
+*  is already processing the events in order.
+*
+*******************************************************************************/
+static bool emu_enter(void)
+{
+    bool wasLocked = emu_lock();
+
+    if (g_emuInIrq == 0)
+    {
+        uint64_t now = emu_now();
+
+        emu_systick_sync(now);
+        emu_process(now, false);
+    }
+
+    return wasLocked;
+}
+
+/*******************************************************************************
+* Function Name: emu_leave
+********************************************************************************
+* Summary:
+*  Re-arms the timer after an access changed the peripherals, and unblocks
+*  the interrupt signal unless it was blocked before emu_enter().
+*
+*******************************************************************************/
+static void emu_leave(bool wasLocked)
+{
+    emu_schedule();
+    emu_unlock(wasLocked);
+}
+
+/*******************************************************************************
+* Function Name: emu_irq
+********************************************************************************
+* Summary:
+*  Signal handler of the timer: the interrupt entry of the emulation.
+*
+*******************************************************************************/
+static void emu_irq(int signo)
+{
+    int savedErrno = errno;
+    uint64_t now = emu_now();
+
+    (void)signo;
+
+    g_emuInIrq = 1;
+    emu_systick_sync(now);
+    emu_process(now, true);
+    g_emuIrqNs = now;
+    g_emuIrqStartNs = now;
+    emu_dispatch();
+    g_emuInIrq = 0;
+
+    emu_schedule();
+    errno = savedErrno;
+}
+
+/*******************************************************************************
+* Function Name: emu_terminal_restore
+********************************************************************************
+* Summary:
+*  Restores the terminal settings of the standard input.
+*
+*******************************************************************************/
+static void emu_terminal_restore(void)
+{
+    if (g_emuTermiosSaved)
+    {
+        (void)tcsetattr(STDIN_FILENO, TCSANOW, &g_emuTermios);
+    }
+}
+
+/*******************************************************************************
+* Function Name: emu_terminate
+********************************************************************************
+* Summary:
+*  Signal handler of SIGINT and SIGTERM: restores the terminal and ends the
+*  emulation.
+*
+*******************************************************************************/
+static void emu_terminate(int signo)
+{
+    (void)signo;
+
+    emu_terminal_restore();
+    _exit(EXIT_SUCCESS);
+}
+
+/*******************************************************************************
+* Function Name: emu_env
+********************************************************************************
+* Summary:
+*  Returns the value of a numeric environment variable, or the default.
+*
+*******************************************************************************/
+static uint32_t emu_env(const char *name, uint32_t defaultValue)
+{
+    const char *value = getenv(name);
+
+    return ((value != NULL) && (*value != '\0')) ? (uint32_t)strtoul(value, NULL, 0) : defaultValue;
+}
+
+/*******************************************************************************
+* Function Name: emu_assert_failed
+********************************************************************************
+* Summary:
+*  Reports a failed CY_ASSERT() and aborts.
+*
+*******************************************************************************/
+void emu_assert_failed(const char *file, int line)
+{
+    fprintf(stderr, "CY_ASSERT failed at %s:%d\n", file, line);
+    abort();
+}
+
+/*******************************************************************************
+* Function Name: cybsp_init
+********************************************************************************
+* Summary:
+*  Starts the emulation: the CPU cycle counter, the interrupt signal and its
+*  timer, and the inputs of the SAR2 channels. Channel 0 of every unit
+*  converts the band gap, the other channels the signal selected with
+*  EMU_SIGNAL (enum SignalType). With EMU_SAR_STOP_MS set, the SAR2 units
+*  stop completing groups that many ms after the start, to test how the
+*  application handles a conversion that never ends.
+*
+*******************************************************************************/
+cy_rslt_t cybsp_init(void)
+{
+    struct sigaction action;
+    struct sigevent event;
+    uint32_t signalType = emu_env("EMU_SIGNAL", EMU_SIGNAL_DEFAULT);
+    uint32_t stopMs = emu_env("EMU_SAR_STOP_MS", EMU_SAR_STOP_MS_DEFAULT);
+    uint32_t unit;
+    uint32_t ch;
+
+    if (signalType >= SIGNAL_TYPE_NUM)
+    {
+        signalType = EMU_SIGNAL_DEFAULT;
+    }
+
+    g_emuCycleBaseNs = emu_now();
+    g_emuSarStopNs = (stopMs != 0u) ? (g_emuCycleBaseNs + ((uint64_t)stopMs * 1000000u)) : 0u;
+
+    (void)sigemptyset(&g_emuIrqSet);
+    (void)sigaddset(&g_emuIrqSet, SIGALRM);
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = &emu_irq;
+    action.sa_mask = g_emuIrqSet;
+    action.sa_flags = SA_RESTART;
+    if (sigaction(SIGALRM, &action, NULL) != 0)
+    {
+        return 1u;
+    }
+
+    memset(&event, 0, sizeof(event));
+    event.sigev_notify = SIGEV_SIGNAL;
+    event.sigev_signo = SIGALRM;
+    if (timer_create(CLOCK_MONOTONIC, &event, &g_emuTimer) != 0)
+    {
+        return 1u;
+    }
+
+    for (unit = 0u; unit < EMU_SAR_UNITS; unit++)
+    {
+        for (ch = 0u; ch < CY_SAR2_NUM_CHANNELS; ch++)
+        {
+            signal_source_init(&g_emuSar[unit]->input[ch], (ch == 0u) ? SIGNAL_BANDGAP_DRIFT : (int32_t)signalType,
+                               EMU_SIGNAL_SEED + (unit * CY_SAR2_NUM_CHANNELS) + ch);
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_retarget_io_init
+********************************************************************************
+* Summary:
+*  printf() writes to the standard output, nothing to set up.
+*
+*******************************************************************************/
+cy_rslt_t cy_retarget_io_init(CySCB_Type *base)
+{
+    (void)base;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: emu_dwt
+********************************************************************************
+* Summary:
+*  Returns the DWT registers with CYCCNT brought up to date: the CPU cycles
+*  since the start of the emulation, once enabled. Writes to CYCCNT are not
+*  emulated.
+*
+*******************************************************************************/
+DWT_Type *emu_dwt(void)
+{
+    if (((EMU_CORE_DEBUG.DEMCR & CoreDebug_DEMCR_TRCENA_Msk) != 0u) &&
+        ((g_emuDwt.CTRL & DWT_CTRL_CYCCNTENA_Msk) != 0u))
+    {
+        g_emuDwt.CYCCNT = (uint32_t)emu_cycles(emu_time());
+    }
+
+    return &g_emuDwt;
+}
+
+/*******************************************************************************
+* Function Name: emu_systick
+********************************************************************************
+* Summary:
+*  Returns the SysTick registers with VAL brought up to date. The counter
+*  counts down from LOAD at the CPU clock.
+*
+*******************************************************************************/
+SysTick_Type *emu_systick(void)
+{
+    bool wasLocked = emu_lock();
+
+    emu_systick_sync(emu_time());
+    emu_unlock(wasLocked);
+
+    return &g_emuSysTick;
+}
+
+/*******************************************************************************
+* Function Name: emu_scb
+********************************************************************************
+* Summary:
+*  Returns the system control block with the SysTick pending bit of ICSR
+*  brought up to date: set from the wrap around of the counter until its
+*  handler is called.
+*
+*******************************************************************************/
+SCB_Type *emu_scb(void)
+{
+    bool wasLocked = emu_enter();
+
+    g_emuScb.ICSR = (g_emuTickPending && emu_systick_active()) ? SCB_ICSR_PENDSTSET_Msk : 0u;
+    emu_leave(wasLocked);
+
+    return &g_emuScb;
+}
+
+/*******************************************************************************
+* Function Name: SysTick_Handler
+********************************************************************************
+* Summary:
+*  Default SysTick handler, for builds of the application without one.
+*
+*******************************************************************************/
+void SysTick_Handler(void)
+{
+}
+
+/*******************************************************************************
+* Function Name: SysTick_Config
+********************************************************************************
+* Summary:
+*  Starts the SysTick timer with an interrupt every ticks CPU cycles.
+*
+*******************************************************************************/
+uint32_t SysTick_Config(uint32_t ticks)
+{
+    bool wasLocked;
+
+    if ((ticks == 0u) || ((ticks - 1u) > SysTick_LOAD_RELOAD_Msk))
+    {
+        return 1u;
+    }
+
+    wasLocked = emu_enter();
+    g_emuSysTick.LOAD = ticks - 1u;
+    g_emuSysTick.VAL = 0u;
+    g_emuSysTick.CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+    g_emuTickPending = false;
+    emu_systick_sync(emu_time());
+    emu_leave(wasLocked);
+
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: __enable_irq
+********************************************************************************
+* Summary:
+*  Unblocks the interrupt signal.
+*
+*******************************************************************************/
+void __enable_irq(void)
+{
+    emu_unlock(g_emuInIrq != 0);
+}
+
+/*******************************************************************************
+* Function Name: __disable_irq
+********************************************************************************
+* Summary:
+*  Blocks the interrupt signal.
+*
+*******************************************************************************/
+void __disable_irq(void)
+{
+    (void)emu_lock();
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_EnterCriticalSection
+********************************************************************************
+* Summary:
+*  Blocks the interrupt signal and returns whether it was blocked before.
+*
+*******************************************************************************/
+uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    return emu_lock() ? 1u : 0u;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_ExitCriticalSection
+********************************************************************************
+* Summary:
+*  Restores the interrupt signal state saved by
+*  Cy_SysLib_EnterCriticalSection().
+*
+*******************************************************************************/
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus)
+{
+    emu_unlock(savedIntrStatus != 0u);
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_DelayUs
+********************************************************************************
+* Summary:
+*  Busy waits for the given time, like the device does.
+*
+*******************************************************************************/
+void Cy_SysLib_DelayUs(uint16_t microseconds)
+{
+    uint64_t end = emu_now() + ((uint64_t)microseconds * 1000u);
+
+    while (emu_now() < end)
+    {
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysInt_Init
+********************************************************************************
+* Summary:
+*  Routes a system interrupt source to a CPU interrupt line with a handler.
+*
+*******************************************************************************/
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress userIsr)
+{
+    uint32_t line = config->intrSrc >> CY_SYSINT_INTRSRC_MUXIRQ_SHIFT;
+    bool wasLocked;
+
+    if (line >= EMU_NVIC_LINES)
+    {
+        return CY_SYSINT_BAD_PARAM;
+    }
+
+    wasLocked = emu_enter();
+    g_emuNvic[line].source = config->intrSrc & ((1UL << CY_SYSINT_INTRSRC_MUXIRQ_SHIFT) - 1u);
+    g_emuNvic[line].priority = config->intrPriority;
+    g_emuNvic[line].handler = userIsr;
+    emu_leave(wasLocked);
+
+    return CY_SYSINT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: NVIC_SetPriority
+********************************************************************************
+* Summary:
+*  Stores the priority of a line. The emulated interrupts do not nest, so
+*  the priority has no effect.
+*
+*******************************************************************************/
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
+{
+    if ((IRQn >= 0) && ((uint32_t)IRQn < EMU_NVIC_LINES))
+    {
+        g_emuNvic[IRQn].priority = priority;
+    }
+}
+
+/*******************************************************************************
+* Function Name: NVIC_EnableIRQ
+********************************************************************************
+* Summary:
+*  Enables a CPU interrupt line; an active source interrupts right away.
+*
+*******************************************************************************/
+void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    bool wasLocked;
+
+    if ((IRQn >= 0) && ((uint32_t)IRQn < EMU_NVIC_LINES))
+    {
+        wasLocked = emu_enter();
+        g_emuNvic[IRQn].enabled = true;
+        emu_leave(wasLocked);
+    }
+}
+
+/*******************************************************************************
+* Function Name: NVIC_DisableIRQ
+********************************************************************************
+* Summary:
+*  Disables a CPU interrupt line.
+*
+*******************************************************************************/
+void NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    bool wasLocked;
+
+    if ((IRQn >= 0) && ((uint32_t)IRQn < EMU_NVIC_LINES))
+    {
+        wasLocked = emu_enter();
+        g_emuNvic[IRQn].enabled = false;
+        emu_leave(wasLocked);
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysClk_ClkHfSetDivider
+********************************************************************************
+* Summary:
+*  Sets the divider of CLK_HF1, the clock of the CM7 cores. The CPU cycle
+*  counters follow the new clock from now on.
+*
+*******************************************************************************/
+cy_en_sysclk_status_t Cy_SysClk_ClkHfSetDivider(uint32_t clkHf, cy_en_clkhf_dividers_t divider)
+{
+    bool wasLocked;
+    uint64_t now;
+
+    if ((clkHf != 1u) || ((uint32_t)divider > (uint32_t)CY_SYSCLK_CLKHF_DIVIDE_BY_8))
+    {
+        return CY_SYSCLK_BAD_PARAM;
+    }
+
+    wasLocked = emu_enter();
+    now = emu_now();
+    g_emuCycleBase = emu_cycles(now);
+    g_emuCycleBaseNs = now;
+    g_emuCpuHz = EMU_CPU_CLOCK_HZ >> (uint32_t)divider;
+    emu_leave(wasLocked);
+
+    return CY_SYSCLK_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: SystemCoreClockUpdate
+********************************************************************************
+* Summary:
+*  Updates SystemCoreClock to the CPU clock.
+*
+*******************************************************************************/
+void SystemCoreClockUpdate(void)
+{
+    SystemCoreClock = g_emuCpuHz;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysPm_CpuEnterSleep
+********************************************************************************
+* Summary:
+*  Waits for the next interrupt.
+*
+*******************************************************************************/
+cy_en_syspm_status_t Cy_SysPm_CpuEnterSleep(cy_en_syspm_waitfor_t waitFor)
+{
+    sigset_t old;
+    sigset_t wait;
+
+    (void)waitFor;
+
+    (void)sigprocmask(SIG_BLOCK, &g_emuIrqSet, &old);
+    wait = old;
+    (void)sigdelset(&wait, SIGALRM);
+    (void)sigsuspend(&wait);
+    (void)sigprocmask(SIG_SETMASK, &old, NULL);
+
+    return CY_SYSPM_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SAR2_Init
+********************************************************************************
+* Summary:
+*  Enables a SAR2 unit with the given channel configurations. A group with
+*  the continuous trigger starts converting right away.
+*
+*******************************************************************************/
+cy_en_sar2_status_t Cy_SAR2_Init(PASS_SAR_Type *base, const cy_stc_sar2_config_t *config)
+{
+    bool wasLocked = emu_enter();
+    uint32_t ch;
+
+    for (ch = 0u; ch < CY_SAR2_NUM_CHANNELS; ch++)
+    {
+        base->configured[ch] = (config->channelConfig[ch] != NULL);
+        if (base->configured[ch])
+        {
+            base->config[ch] = *config->channelConfig[ch];
+            base->intrMask[ch] = base->config[ch].interruptMask;
+        }
+        base->intr[ch] = 0u;
+        base->status[ch] = 0u;
+    }
+
+    base->enabled = true;
+    base->busy = false;
+    base->triggerPending = false;
+
+    for (ch = 0u; ch < CY_SAR2_NUM_CHANNELS; ch++)
+    {
+        if (base->configured[ch] && (base->config[ch].triggerSelection == CY_SAR2_TRIGGER_CONTINUOUS))
+        {
+            emu_sar_start(base, ch, emu_time());
+            break;
+        }
+    }
+
+    emu_leave(wasLocked);
+
+    return CY_SAR2_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SAR2_DeInit
+********************************************************************************
+* Summary:
+*  Disables a SAR2 unit; the group in conversion is dropped.
+*
+*******************************************************************************/
+void Cy_SAR2_DeInit(PASS_SAR_Type *base)
+{
+    bool wasLocked = emu_enter();
+    uint32_t ch;
+
+    for (ch = 0u; ch < CY_SAR2_NUM_CHANNELS; ch++)
+    {
+        base->configured[ch] = false;
+        base->intr[ch] = 0u;
+        base->intrMask[ch] = 0u;
+        base->status[ch] = 0u;
+    }
+
+    base->enabled = false;
+    base->busy = false;
+    base->triggerPending = false;
+
+    emu_leave(wasLocked);
+}
+
+/*******************************************************************************
+* Function Name: Cy_SAR2_SetReferenceBufferMode
+********************************************************************************
+* Summary:
+*  Stores the reference buffer mode, which has no effect on the emulation.
+*
+*******************************************************************************/
+void Cy_SAR2_SetReferenceBufferMode(PASS_EPASS_MMIO_Type *base, cy_en_sar2_ref_buf_mode_t mode)
+{
+    base->refBufMode = mode;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SAR2_Channel_Init
+********************************************************************************
+* Summary:
+*  Changes the configuration and the interrupt mask of one channel; the
+*  next conversion of the channel uses it.
+*
+*******************************************************************************/
+cy_en_sar2_status_t Cy_SAR2_Channel_Init(PASS_SAR_Type *base, uint32_t channel,
+                                         const cy_stc_sar2_channel_config_t *channelConfig)
+{
+    bool wasLocked;
+
+    if (channel >= CY_SAR2_NUM_CHANNELS)
+    {
+        return CY_SAR2_BAD_PARAM;
+    }
+
+    wasLocked = emu_enter();
+    base->config[channel] = *channelConfig;
+    base->configured[channel] = true;
+    base->intrMask[channel] = channelConfig->interruptMask;
+    emu_leave(wasLocked);
+
+    return CY_SAR2_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SAR2_Channel_SoftwareTrigger
+********************************************************************************
+* Summary:
+*  Starts the group beginning with the channel, or holds the trigger until
+*  the group in conversion is done.
+*
+*******************************************************************************/
+void Cy_SAR2_Channel_SoftwareTrigger(PASS_SAR_Type *base, uint32_t channel)
+{
+    bool wasLocked;
+
+    if (channel >= CY_SAR2_NUM_CHANNELS)
+    {
+        return;
+    }
+
+    wasLocked = emu_enter();
+    if (base->enabled && base->configured[channel])
+    {
+        if (base->busy)
+        {
+            base->triggerPending = true;
+        }
+        else
+        {
+            emu_sar_start(base, channel, emu_time());
+        }
+    }
+    emu_leave(wasLocked);
+}
+
+/*******************************************************************************
+* Function Name: Cy_SAR2_Channel_GetResult
+********************************************************************************
+* Summary:
+*  Returns the last result of a channel and its status. Reading the result
+*  clears its valid flag.
+*
+*******************************************************************************/
+uint16_t Cy_SAR2_Channel_GetResult(PASS_SAR_Type *base, uint32_t channel, uint32_t *status)
+{
+    bool wasLocked;
+    uint16_t result;
+
+    if (channel >= CY_SAR2_NUM_CHANNELS)
+    {
+        return 0u;
+    }
+
+    wasLocked = emu_enter();
+    result = base->result[channel];
+    if (status != NULL)
+    {
+        *status = base->status[channel];
+    }
+    base->status[channel] &= ~CY_SAR2_STATUS_VALID;
+    emu_leave(wasLocked);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SAR2_Channel_GetInterruptStatus
+********************************************************************************
+* Summary:
+*  Returns the interrupt flags of a channel.
+*
+*******************************************************************************/
+uint32_t Cy_SAR2_Channel_GetInterruptStatus(const PASS_SAR_Type *base, uint32_t channel)
+{
+    bool wasLocked;
+    uint32_t intr;
+
+    if (channel >= CY_SAR2_NUM_CHANNELS)
+    {
+        return 0u;
+    }
+
+    wasLocked = emu_enter();
+    intr = base->intr[channel];
+    emu_leave(wasLocked);
+
+    return intr;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SAR2_Channel_GetInterruptStatusMasked
+********************************************************************************
+* Summary:
+*  Returns the interrupt flags of a channel that are enabled by its mask.
+*
+*******************************************************************************/
+uint32_t Cy_SAR2_Channel_GetInterruptStatusMasked(const PASS_SAR_Type *base, uint32_t channel)
+{
+    bool wasLocked;
+    uint32_t intr;
+
+    if (channel >= CY_SAR2_NUM_CHANNELS)
+    {
+        return 0u;
+    }
+
+    wasLocked = emu_enter();
+    intr = base->intr[channel] & base->intrMask[channel];
+    emu_leave(wasLocked);
+
+    return intr;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SAR2_Channel_ClearInterrupt
+********************************************************************************
+* Summary:
+*  Clears interrupt flags of a channel.
+*
+*******************************************************************************/
+void Cy_SAR2_Channel_ClearInterrupt(PASS_SAR_Type *base, uint32_t channel, uint32_t intrMask)
+{
+    bool wasLocked;
+
+    if (channel >= CY_SAR2_NUM_CHANNELS)
+    {
+        return;
+    }
+
+    wasLocked = emu_enter();
+    base->intr[channel] &= ~intrMask;
+    emu_leave(wasLocked);
+}
+
+/*******************************************************************************
+* Function Name: Cy_SAR2_Channel_SetInterruptMask
+********************************************************************************
+* Summary:
+*  Sets the interrupt flags of a channel that raise its interrupt.
+*
+*******************************************************************************/
+void Cy_SAR2_Channel_SetInterruptMask(PASS_SAR_Type *base, uint32_t channel, uint32_t intrMask)
+{
+    bool wasLocked;
+
+    if (channel >= CY_SAR2_NUM_CHANNELS)
+    {
+        return;
+    }
+
+    wasLocked = emu_enter();
+    base->intrMask[channel] = intrMask;
+    emu_leave(wasLocked);
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_Init
+********************************************************************************
+* Summary:
+*  Sets up the standard input and output as the UART: the baud rate from
+*  EMU_BAUD, and the time between two received keys in ms from EMU_KEY_MS.
+*  A terminal on the standard input is switched to unbuffered input without
+*  echo.
+*
+*******************************************************************************/
+cy_en_scb_uart_status_t Cy_SCB_UART_Init(CySCB_Type *base, const cy_stc_scb_uart_config_t *config,
+                                         cy_stc_scb_uart_context_t *context)
+{
+    struct sigaction action;
+    struct termios raw;
+    int flags;
+
+    (void)config;
+    (void)context;
+
+    base->baud = emu_env("EMU_BAUD", EMU_BAUD_DEFAULT);
+    base->keyGapNs = (uint64_t)emu_env("EMU_KEY_MS", EMU_KEY_MS_DEFAULT) * 1000000u;
+    base->nextKeyNs = emu_now() + base->keyGapNs;
+    base->txLevel = 0u;
+    base->rxEnd = false;
+
+    if (base->baud == 0u)
+    {
+        return CY_SCB_UART_BAD_PARAM;
+    }
+
+    flags = fcntl(STDIN_FILENO, F_GETFL);
+    if (flags >= 0)
+    {
+        (void)fcntl(STDIN_FILENO, F_SETFL, flags | O_NONBLOCK);
+    }
+
+    if (isatty(STDIN_FILENO) && (tcgetattr(STDIN_FILENO, &g_emuTermios) == 0))
+    {
+        g_emuTermiosSaved = true;
+        raw = g_emuTermios;
+        raw.c_lflag &= ~(tcflag_t)(ICANON | ECHO);
+        raw.c_cc[VMIN] = 0;
+        raw.c_cc[VTIME] = 0;
+        (void)tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+        (void)atexit(&emu_terminal_restore);
+
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = &emu_terminate;
+        (void)sigaction(SIGINT, &action, NULL);
+        (void)sigaction(SIGTERM, &action, NULL);
+    }
+
+    return CY_SCB_UART_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_Enable
+********************************************************************************
+* Summary:
+*  Enables the UART.
+*
+*******************************************************************************/
+void Cy_SCB_UART_Enable(CySCB_Type *base)
+{
+    base->enabled = true;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_Get
+********************************************************************************
+* Summary:
+*  Returns the next key of the standard input, at most one per EMU_KEY_MS,
+*  or CY_SCB_UART_RX_NO_DATA. Once the input has ended, the emulation ends
+*  one more key time later, which leaves the application the time to send
+*  its output.
+*
+*******************************************************************************/
+uint32_t Cy_SCB_UART_Get(CySCB_Type const *base)
+{
+    CySCB_Type *scb = (CySCB_Type *)base;
+    uint64_t now = emu_now();
+    uint8_t key;
+    ssize_t n;
+
+    if (!scb->enabled || (now < scb->nextKeyNs))
+    {
+        return CY_SCB_UART_RX_NO_DATA;
+    }
+
+    if (scb->rxEnd)
+    {
+        (void)emu_lock();
+        (void)fflush(stdout);
+        exit(EXIT_SUCCESS);
+    }
+
+    n = read(STDIN_FILENO, &key, 1u);
+    if (n == 1)
+    {
+        scb->nextKeyNs = now + scb->keyGapNs;
+        return key;
+    }
+
+    if ((n == 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)))
+    {
+        scb->rxEnd = true;
+        scb->nextKeyNs = now + scb->keyGapNs;
+    }
+
+    return CY_SCB_UART_RX_NO_DATA;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_PutArray
+********************************************************************************
+* Summary:
+*  Places as many bytes as fit into the transmit FIFO and returns their
+*  number. The FIFO drains to the standard output at the baud rate, with
+*  10 bits per byte.
+*
+*******************************************************************************/
+uint32_t Cy_SCB_UART_PutArray(CySCB_Type *base, void *buffer, uint32_t size)
+{
+    uint64_t now = emu_now();
+    uint64_t sent;
+    uint32_t count;
+
+    if (base->txLevel != 0u)
+    {
+        sent = emu_scale(now - base->txUpdateNs, base->baud, 10u * EMU_NS_PER_S);
+        if (sent >= base->txLevel)
+        {
+            base->txLevel = 0u;
+        }
+        else
+        {
+            base->txLevel -= (uint32_t)sent;
+            base->txUpdateNs += emu_scale(sent, 10u * EMU_NS_PER_S, base->baud);
+        }
+    }
+
+    count = EMU_UART_FIFO_SIZE - base->txLevel;
+    if (count > size)
+    {
+        count = size;
+    }
+
+    if (count != 0u)
+    {
+        if (base->txLevel == 0u)
+        {
+            base->txUpdateNs = now;
+        }
+        base->txLevel += count;
+        (void)fwrite(buffer, 1u, count, stdout);
+        (void)fflush(stdout);
+    }
+
+    return count;
+}
+/* [] END OF FILE */
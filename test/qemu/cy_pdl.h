@@ -0,0 +1,158 @@
+/******************************************************************************
+* File Name:   cy_pdl.h
+*
+* Description: This file contains the subset of the PDL and CMSIS interface
+*              that the processing pipeline benchmark uses, for the QEMU
+*              mps2-an500 machine (Cortex-M7). The registers are those of the
+*              Cortex-M7 system control space at their architectural addresses;
+*              the machine has no SAR2 and no SCB, so nothing else is provided.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CY_PDL_H
+#define CY_PDL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define CY_SECTION(name)        __attribute__((section(name)))
+#define CY_ALIGN(align)         __attribute__((aligned(align)))
+#define CY_UNUSED_PARAMETER(x)  ((void)(x))
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DHCSR;
+    volatile uint32_t DCRSR;
+    volatile uint32_t DCRDR;
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t LOAD;
+    volatile uint32_t VAL;
+    volatile uint32_t CALIB;
+} SysTick_Type;
+
+typedef struct
+{
+    volatile uint32_t CPUID;
+    volatile uint32_t ICSR;
+} SCB_Type;
+
+/* QEMU does not emulate the DWT; build with CYCLE_PROBE_SYSTICK=1 */
+#define DWT                             ((DWT_Type *)0xE0001000u)
+#define CoreDebug                       ((CoreDebug_Type *)0xE000EDF0u)
+#define SysTick                         ((SysTick_Type *)0xE000E010u)
+#define SCB                             ((SCB_Type *)0xE000ED00u)
+
+/* Coprocessor access control register, enables the FPU */
+#define SCB_CPACR                       (*(volatile uint32_t *)0xE000ED88u)
+
+#define DWT_CTRL_CYCCNTENA_Msk          (1u)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1u << 24)
+#define SysTick_CTRL_ENABLE_Msk         (1u)
+#define SysTick_CTRL_TICKINT_Msk        (1u << 1)
+#define SysTick_CTRL_CLKSOURCE_Msk      (1u << 2)
+#define SysTick_LOAD_RELOAD_Msk         (0x00FFFFFFu)
+#define SCB_ICSR_PENDSTSET_Msk          (1u << 26)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern uint32_t SystemCoreClock;
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_EnterCriticalSection
+********************************************************************************
+* Summary:
+*  Disables the interrupts and returns the previous PRIMASK.
+*
+*******************************************************************************/
+static inline uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory");
+
+    return primask;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_ExitCriticalSection
+********************************************************************************
+* Summary:
+*  Restores the PRIMASK returned by Cy_SysLib_EnterCriticalSection().
+*
+*******************************************************************************/
+static inline void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus)
+{
+    __asm volatile ("msr primask, %0" : : "r" (savedIntrStatus) : "memory");
+}
+
+/*******************************************************************************
+* Function Name: __CLZ
+********************************************************************************
+* Summary:
+*  Count leading zeros, 32 for 0 like the CLZ instruction.
+*
+*******************************************************************************/
+static inline uint32_t __CLZ(uint32_t value)
+{
+    return (value != 0u) ? (uint32_t)__builtin_clz(value) : 32u;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CY_PDL_H */
+/* [] END OF FILE */
@@ -0,0 +1,149 @@
+/******************************************************************************
+* File Name:   startup_qemu.c
+*
+* Description: This file contains the startup code of the QEMU mps2-an500
+*              build of the processing pipeline benchmark: the vector table,
+*              the reset handler, which enables the FPU and enters the C
+*              library start-up of the semihosting library (rdimon), and a
+*              fault handler that ends QEMU with an error through semihosting.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Clock of the CPU and of the SysTick timer of the mps2 machines */
+#define QEMU_SYSCLK_HZ              (25000000u)
+
+/* Semihosting operation and reason of an exit with an error */
+#define SEMIHOSTING_SYS_EXIT        (0x18u)
+#define SEMIHOSTING_INTERNAL_ERROR  (0x20024u)
+
+/* Entries of the Cortex-M7 exception table up to SysTick */
+#define VECTOR_NUM                  (16u)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void Reset_Handler(void);
+void Default_Handler(void);
+
+/* Counts the wrap arounds of the SysTick counter for the time base, see timebase.c */
+void SysTick_Handler(void);
+
+/* C library start-up of rdimon: initializes .bss and the heap, calls main() and exit() */
+extern void _start(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Top of the stack, see mps2_an500.ld */
+extern uint32_t __StackTop;
+
+uint32_t SystemCoreClock = QEMU_SYSCLK_HZ;
+
+__attribute__((used, section(".isr_vector")))
+static void (*const vectorTable[VECTOR_NUM])(void) =
+{
+    (void (*)(void))&__StackTop,
+    &Reset_Handler,
+    &Default_Handler,   /* NMI */
+    &Default_Handler,   /* HardFault */
+    &Default_Handler,   /* MemManage */
+    &Default_Handler,   /* BusFault */
+    &Default_Handler,   /* UsageFault */
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    &Default_Handler,   /* SVCall */
+    &Default_Handler,   /* DebugMonitor */
+    NULL,
+    &Default_Handler,   /* PendSV */
+    &SysTick_Handler    /* SysTick */
+};
+
+/*******************************************************************************
+* Function Name: Reset_Handler
+********************************************************************************
+* Summary:
+*  Enables full access to the FPU, which the hard float code needs before its
+*  first floating point instruction, and enters the C library start-up.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void Reset_Handler(void)
+{
+    SCB_CPACR |= (0xFu << 20);
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+
+    _start();
+}
+
+/*******************************************************************************
+* Function Name: Default_Handler
+********************************************************************************
+* Summary:
+*  Handler of the faults and of the unexpected exceptions: ends QEMU through
+*  semihosting, so that a failed run does not hang.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void Default_Handler(void)
+{
+    register uint32_t op __asm("r0") = SEMIHOSTING_SYS_EXIT;
+    register uint32_t reason __asm("r1") = SEMIHOSTING_INTERNAL_ERROR;
+
+    __asm volatile ("bkpt 0xAB" : : "r" (op), "r" (reason) : "memory");
+
+    for (;;)
+    {
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,361 @@
+/******************************************************************************
+* File Name:   test_adc_stats.c
+*
+* Description: This file contains the host test of the mergeable statistics of
+*              adc_result.c and of the multithreaded analysis of the PC tools. The
+*              statistics of split partitions merged with adc_stats_merge() are
+*              compared with a single pass of adc_stats_add(), and the analysis
+*              with any number of threads with the analysis on one thread.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+#include "test_common.h"
+#include "adc_result.h"
+#include "signal_source.h"
+#include "sar2_model.h"
+#include "tools/analyze.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of results per signal */
+#define TEST_SAMPLES    (100000u)
+
+/* Random partitions per signal and the largest number of parts */
+#define PARTITIONS      (200u)
+#define MAX_PARTS       (64u)
+
+/* Relative tolerances of the merged mean and variance */
+#define MEAN_TOLERANCE      (1e-12)
+#define VARIANCE_TOLERANCE  (1e-9)
+
+/* Records of the analysis: three full chunks and a partial one */
+#define ANALYZE_RECORDS ((3u * ANALYZE_CHUNK_RECORDS) + 5000u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint16_t g_values[TEST_SAMPLES];
+static capture_record_t g_records[ANALYZE_RECORDS];
+
+/*******************************************************************************
+* Function Name: next_random
+********************************************************************************
+* Summary:
+*  Returns the next value of a xorshift32 generator.
+*
+*******************************************************************************/
+static uint32_t next_random(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+
+    return *state;
+}
+
+/*******************************************************************************
+* Function Name: close_to
+********************************************************************************
+* Summary:
+*  Returns true if two values agree within a relative tolerance.
+*
+*******************************************************************************/
+static bool close_to(double a, double b, double tolerance)
+{
+    return fabs(a - b) <= (tolerance * fmax(1.0, fmax(fabs(a), fabs(b))));
+}
+
+/*******************************************************************************
+* Function Name: same_stats
+********************************************************************************
+* Summary:
+*  Returns true if merged statistics match the statistics of a single pass.
+*
+*******************************************************************************/
+static bool same_stats(const adc_stats_t *merged, const adc_stats_t *single)
+{
+    return (merged->count == single->count) && (merged->min == single->min) && (merged->max == single->max) &&
+           close_to(merged->mean, single->mean, MEAN_TOLERANCE) &&
+           close_to(adc_stats_variance(merged), adc_stats_variance(single), VARIANCE_TOLERANCE);
+}
+
+/*******************************************************************************
+* Function Name: single_pass
+********************************************************************************
+* Summary:
+*  Returns the statistics of values added one by one.
+*
+*******************************************************************************/
+static adc_stats_t single_pass(const uint16_t *values, uint32_t count)
+{
+    adc_stats_t stats;
+    uint32_t i;
+
+    adc_stats_reset(&stats);
+    for (i = 0u; i < count; i++)
+    {
+        adc_stats_add(&stats, values[i]);
+    }
+
+    return stats;
+}
+
+/*******************************************************************************
+* Function Name: test_partitions
+********************************************************************************
+* Summary:
+*  Splits the results of every synthetic signal at random points, including
+*  empty and single-value parts, and merges the statistics of the parts in
+*  order, in reverse order, and as a pairwise tree.
+*
+*******************************************************************************/
+static void test_partitions(void)
+{
+    uint32_t cut[MAX_PARTS + 1u];
+    adc_stats_t part[MAX_PARTS];
+    adc_stats_t single;
+    adc_stats_t forward;
+    adc_stats_t reverse;
+    signal_source_t src;
+    uint32_t state = 12345u;
+    uint32_t parts;
+    uint32_t width;
+    uint32_t i;
+    uint32_t j;
+    uint32_t p;
+    int32_t type;
+    bool okForward = true;
+    bool okReverse = true;
+    bool okTree = true;
+
+    for (type = 0; type < SIGNAL_TYPE_NUM; type++)
+    {
+        signal_source_init(&src, type, 42u);
+        for (i = 0u; i < TEST_SAMPLES; i++)
+        {
+            g_values[i] = signal_source_next_result(&src, 1u, 0u, UNSIGNED_RIGHT_ALIGNED);
+        }
+        single = single_pass(g_values, TEST_SAMPLES);
+
+        for (p = 0u; p < PARTITIONS; p++)
+        {
+            parts = 1u + (next_random(&state) % MAX_PARTS);
+
+            /* Sorted cut points; equal neighbours give empty parts */
+            cut[0] = 0u;
+            cut[parts] = TEST_SAMPLES;
+            for (i = 1u; i < parts; i++)
+            {
+                cut[i] = ((p % 4u) == 3u) ? (cut[i - 1u] + ((next_random(&state) % 3u) == 0u ? 0u : 1u)) :
+                                            (next_random(&state) % (TEST_SAMPLES + 1u));
+                for (j = i; (j > 1u) && (cut[j] < cut[j - 1u]); j--)
+                {
+                    uint32_t t = cut[j];
+                    cut[j] = cut[j - 1u];
+                    cut[j - 1u] = t;
+                }
+            }
+
+            for (i = 0u; i < parts; i++)
+            {
+                part[i] = single_pass(&g_values[cut[i]], cut[i + 1u] - cut[i]);
+            }
+
+            adc_stats_reset(&forward);
+            adc_stats_reset(&reverse);
+            for (i = 0u; i < parts; i++)
+            {
+                adc_stats_merge(&forward, &part[i]);
+                adc_stats_merge(&reverse, &part[parts - 1u - i]);
+            }
+            okForward = okForward && same_stats(&forward, &single);
+            okReverse = okReverse && same_stats(&reverse, &single);
+
+            /* Pairwise tree, the order of a parallel reduction */
+            for (width = 1u; width < parts; width *= 2u)
+            {
+                for (i = 0u; (i + width) < parts; i += 2u * width)
+                {
+                    adc_stats_merge(&part[i], &part[i + width]);
+                }
+            }
+            okTree = okTree && same_stats(&part[0], &single);
+        }
+    }
+
+    TEST_CHECK(okForward);
+    TEST_CHECK(okReverse);
+    TEST_CHECK(okTree);
+}
+
+/*******************************************************************************
+* Function Name: test_edge_cases
+********************************************************************************
+* Summary:
+*  Checks merges with empty statistics, and the variance of values with a
+*  large offset against a two-pass computation.
+*
+*******************************************************************************/
+static void test_edge_cases(void)
+{
+    adc_stats_t empty;
+    adc_stats_t stats;
+    adc_stats_t merged;
+    double mean = 0.0;
+    double m2 = 0.0;
+    uint32_t state = 99u;
+    uint32_t i;
+
+    adc_stats_reset(&empty);
+    adc_stats_reset(&merged);
+    adc_stats_merge(&merged, &empty);
+    TEST_CHECK((merged.count == 0u) && (merged.mean == 0.0) && (merged.m2 == 0.0));
+    TEST_CHECK(adc_stats_variance(&merged) == 0.0);
+
+    /* Values near full scale with a small spread, merged one by one */
+    for (i = 0u; i < TEST_SAMPLES; i++)
+    {
+        g_values[i] = (uint16_t)(65000u + (next_random(&state) % 7u));
+        mean += (double)g_values[i];
+    }
+    mean /= (double)TEST_SAMPLES;
+    for (i = 0u; i < TEST_SAMPLES; i++)
+    {
+        m2 += ((double)g_values[i] - mean) * ((double)g_values[i] - mean);
+    }
+
+    stats = single_pass(g_values, TEST_SAMPLES);
+    adc_stats_merge(&merged, &stats);
+    adc_stats_merge(&merged, &empty);
+    TEST_CHECK(same_stats(&merged, &stats));
+    TEST_CHECK(memcmp(&merged, &stats, sizeof(stats)) == 0);
+
+    adc_stats_reset(&merged);
+    for (i = 0u; i < TEST_SAMPLES; i++)
+    {
+        stats = single_pass(&g_values[i], 1u);
+        adc_stats_merge(&merged, &stats);
+    }
+    TEST_CHECK(close_to(merged.mean, mean, MEAN_TOLERANCE));
+    TEST_CHECK(close_to(merged.m2, m2, VARIANCE_TOLERANCE));
+    TEST_CHECK((merged.min == 65000u) && (merged.max == 65006u));
+}
+
+/*******************************************************************************
+* Function Name: test_analyze
+********************************************************************************
+* Summary:
+*  Analyzes the records of a sine with 1, 2, 3, and 8 threads: the statistics
+*  must match a single pass exactly and not depend on the number of threads,
+*  the spectrum must agree within rounding and peak at the sine frequency.
+*
+*******************************************************************************/
+static void test_analyze(void)
+{
+    static const uint32_t THREADS[] = { 1u, 2u, 3u, 8u };
+    static analyze_result_t one;
+    static analyze_result_t res;
+    adc_stats_t single;
+    signal_source_t src;
+    uint64_t invalid = 0u;
+    uint32_t peak = 1u;
+    uint32_t i;
+    uint32_t t;
+    bool ok;
+
+    signal_source_init(&src, SIGNAL_SINE, 7u);
+    adc_stats_reset(&single);
+    for (i = 0u; i < ANALYZE_RECORDS; i++)
+    {
+        g_records[i].result = signal_source_next_result(&src, 1u, 0u, UNSIGNED_RIGHT_ALIGNED);
+        g_records[i].index = (uint8_t)(i % 32u);
+        g_records[i].flags = ((i % 1000u) < 3u) ? CAPTURE_FLAG_TIME_INVALID : 0u;
+        invalid += g_records[i].flags;
+        adc_stats_add(&single, g_records[i].result);
+    }
+
+    TEST_CHECK(analyze_run(g_records, ANALYZE_RECORDS, 1u, &one) == 0);
+    TEST_CHECK(same_stats(&one.stats, &single));
+    TEST_CHECK(one.invalidTime == invalid);
+    TEST_CHECK(one.segments == ((ANALYZE_RECORDS - 5000u) / ANALYZE_FFT_SIZE) + (5000u / ANALYZE_FFT_SIZE));
+
+    /* The sine has a period of 1024 conversions, one cycle per segment */
+    for (i = 2u; i < ANALYZE_BINS; i++)
+    {
+        peak = (one.power[i] > one.power[peak]) ? i : peak;
+    }
+    TEST_CHECK(peak == 1u);
+    TEST_CHECK(one.power[1] > (1e4 * one.power[10]));
+
+    for (t = 1u; t < (sizeof(THREADS) / sizeof(THREADS[0])); t++)
+    {
+        TEST_CHECK(analyze_run(g_records, ANALYZE_RECORDS, THREADS[t], &res) == 0);
+        TEST_CHECK(memcmp(&res.stats, &one.stats, sizeof(res.stats)) == 0);
+        TEST_CHECK((res.invalidTime == one.invalidTime) && (res.segments == one.segments));
+
+        ok = true;
+        for (i = 0u; i < ANALYZE_BINS; i++)
+        {
+            ok = ok && close_to(res.power[i], one.power[i], 1e-12);
+        }
+        TEST_CHECK(ok);
+    }
+
+    TEST_CHECK(analyze_run(g_records, ANALYZE_RECORDS, 0u, &res) != 0);
+    TEST_CHECK(analyze_run(g_records, 0u, 2u, &res) == 0);
+    TEST_CHECK((res.stats.count == 0u) && (res.segments == 0u));
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the checks of the statistics and the analysis.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_partitions();
+    test_edge_cases();
+    test_analyze();
+
+    return TEST_REPORT("test_adc_stats");
+}
+/* [] END OF FILE */
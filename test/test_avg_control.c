@@ -0,0 +1,252 @@
+/******************************************************************************
+* File Name:   test_avg_control.c
+*
+* Description: This file contains the host closed-loop test of the average count
+*              controller: the controller picks the average count of synthetic
+*              conversions through the SAR2 result model, across steps of the noise
+*              level and for moving inputs that averaging cannot help.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "test_common.h"
+#include "avg_control.h"
+#include "signal_source.h"
+#include "sar2_model.h"
+#include "adc_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Results per noise level; the second half is expected to be settled */
+#define PHASE_RESULTS   (100000u)
+
+/* Results per moving input; the second half is counted */
+#define MOVING_RESULTS  (1000000u)
+
+/* Variance of the truncation of the averaged result, in codes^2 */
+#define QUANT_VAR       (1.0 / 12.0)
+
+/* Number of noise levels stepped through */
+#define NOISE_STEPS     (5u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Noise levels in codes, stepped up and down */
+static const uint32_t NOISE_SIGMA[NOISE_STEPS] = { 4u, 12u, 2u, 30u, 1u };
+
+/*******************************************************************************
+* Function Name: run_controller
+********************************************************************************
+* Summary:
+*  Converts the source with the average count the controller picks, as the
+*  result ISR does, and counts the average count changes.
+*
+* Parameters:
+*  signal_source_t *src - The synthetic source
+*  avg_control_t *ctrl - The controller
+*  uint32_t results - Number of results to convert
+*  uint32_t *counted - Results of the second half taken with the count, by log2
+*
+* Return:
+*  uint32_t - Changes in the second half of the run
+*
+*******************************************************************************/
+static uint32_t run_controller(signal_source_t *src, avg_control_t *ctrl, uint32_t results,
+                               uint32_t *counted)
+{
+    uint32_t changes = 0u;
+    uint32_t i;
+
+    for (i = 0u; i < results; i++)
+    {
+        uint16_t result = signal_source_next_result(src, ctrl->averageCount,
+                                                    sar2_model_right_shift(ctrl->averageCount),
+                                                    UNSIGNED_RIGHT_ALIGNED);
+        bool changed = avg_control_add(ctrl, result);
+
+        if (i >= (results / 2u))
+        {
+            changes += changed ? 1u : 0u;
+            if (counted != NULL)
+            {
+                counted[sar2_model_right_shift(ctrl->averageCount)]++;
+            }
+        }
+    }
+
+    return changes;
+}
+
+/*******************************************************************************
+* Function Name: result_var
+********************************************************************************
+* Summary:
+*  Returns the expected variance of a result of DC noise.
+*
+* Parameters:
+*  uint32_t sigma - Noise of a single conversion, in codes
+*  uint32_t averageCount - Average count of the result
+*
+*******************************************************************************/
+static double result_var(uint32_t sigma, uint32_t averageCount)
+{
+    return ((double)sigma * (double)sigma / (double)averageCount) + QUANT_VAR;
+}
+
+/*******************************************************************************
+* Function Name: test_noise_steps
+********************************************************************************
+* Summary:
+*  Steps the noise of a DC input up and down and checks after each step that
+*  the controller settled, without further changes, on the lowest average
+*  count that meets the target, and that the count followed the noise.
+*
+*******************************************************************************/
+static void test_noise_steps(void)
+{
+    static const double TARGET[] = { 4.0, 1.0 };
+    signal_source_t src;
+    avg_control_t ctrl;
+    uint32_t target;
+    uint32_t step;
+
+    for (target = 0u; target < (sizeof(TARGET) / sizeof(TARGET[0])); target++)
+    {
+        uint32_t previousCount = 1u;
+        uint32_t previousSigma = 0u;
+
+        signal_source_init(&src, SIGNAL_DC_NOISE, 1234u);
+        avg_control_init(&ctrl, AVG_CONTROL_VAR_Q8(TARGET[target]), 1u);
+
+        for (step = 0u; step < NOISE_STEPS; step++)
+        {
+            uint32_t sigma = NOISE_SIGMA[step];
+            uint32_t count;
+
+            src.noiseSigma = (int32_t)(sigma << 8);
+            TEST_CHECK(run_controller(&src, &ctrl, PHASE_RESULTS, NULL) == 0u);
+
+            count = ctrl.averageCount;
+
+            /* Meets the target, unless the count is at its maximum */
+            TEST_CHECK((count == SAR2_MODEL_AVERAGE_MAX) ||
+                       (result_var(sigma, count) <= TARGET[target]));
+
+            /* Half the count would not meet it */
+            TEST_CHECK((count == 1u) || (result_var(sigma, count / 2u) > (TARGET[target] * 0.9)));
+
+            /* More noise never lowers the count, less never raises it */
+            TEST_CHECK((sigma > previousSigma) ? (count >= previousCount) : (count <= previousCount));
+
+            previousCount = count;
+            previousSigma = sigma;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_quantization_floor
+********************************************************************************
+* Summary:
+*  Checks a target next to the truncation noise: the count stays at the level
+*  that meets it and only leaves it for the periodic retries.
+*
+*******************************************************************************/
+static void test_quantization_floor(void)
+{
+    uint32_t counted[9] = { 0u };
+    signal_source_t src;
+    avg_control_t ctrl;
+
+    signal_source_init(&src, SIGNAL_DC_NOISE, 42u);
+    avg_control_init(&ctrl, AVG_CONTROL_VAR_Q8(0.25), 1u);
+    (void)run_controller(&src, &ctrl, MOVING_RESULTS, counted);
+
+    /* 16/128 + 1/12 meets 0.25, 16/64 + 1/12 does not */
+    TEST_CHECK(counted[7] >= ((MOVING_RESULTS / 2u) * 95u / 100u));
+}
+
+/*******************************************************************************
+* Function Name: test_moving_inputs
+********************************************************************************
+* Summary:
+*  Checks that inputs that move between consecutive results, where doubling
+*  the count does not reduce the variance, stay at the lowest count that was
+*  reached and retry a doubling only every AVG_CONTROL_RETRY measurements.
+*
+*******************************************************************************/
+static void test_moving_inputs(void)
+{
+    static const int32_t TYPE[] = { SIGNAL_SINE, SIGNAL_RAMP, SIGNAL_CHIRP, SIGNAL_STEP_GLITCH };
+    static const uint32_t LOG2_COUNT[] = { 0u, 0u, 0u, 2u };
+    uint32_t windows = (MOVING_RESULTS / 2u) / AVG_CONTROL_WINDOW;
+    signal_source_t src;
+    avg_control_t ctrl;
+    uint32_t changes;
+    uint32_t i;
+
+    for (i = 0u; i < (sizeof(TYPE) / sizeof(TYPE[0])); i++)
+    {
+        uint32_t counted[9] = { 0u };
+
+        signal_source_init(&src, TYPE[i], 42u);
+        avg_control_init(&ctrl, AVG_CONTROL_VAR_Q8(1.0), 1u);
+        changes = run_controller(&src, &ctrl, MOVING_RESULTS, counted);
+
+        TEST_CHECK(counted[LOG2_COUNT[i]] >= ((MOVING_RESULTS / 2u) * 95u / 100u));
+
+        /* A doubling and its revert per retry */
+        TEST_CHECK(changes <= ((2u * windows / AVG_CONTROL_RETRY) + 2u));
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the closed-loop checks of the average count controller.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_noise_steps();
+    test_quantization_floor();
+    test_moving_inputs();
+
+    return TEST_REPORT("test_avg_control");
+}
+/* [] END OF FILE */
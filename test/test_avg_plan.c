@@ -0,0 +1,248 @@
+/******************************************************************************
+* File Name:   test_avg_plan.c
+*
+* Description: This file contains the host test of the averaging planner. It
+*              checks the split of averaging factors, powers of two and others,
+*              between the SAR2 and the software stage against an exhaustive
+*              search, with output rates that force a smaller hardware count,
+*              and the rounding of the software stage.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "test_common.h"
+#include "avg_plan.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Highest factor of the exhaustive check */
+#define SEARCH_FACTOR_MAX   (5000u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Expected split of one factor at one output rate */
+typedef struct
+{
+    uint32_t factor;
+    uint32_t outputRateHz;
+    uint32_t hwCount;
+    uint32_t swCount;
+    bool met;
+} plan_expect_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* 1 MHz conversions, 400 cycles per hardware result and 2000 per output at 320 MHz */
+static const avg_plan_cost_t COST =
+{
+    .conversionRateHz = 1000000u,
+    .cpuClockHz = 320000000u,
+    .cyclesPerResult = 400u,
+    .cyclesPerOutput = 2000u,
+    .maxLoadPpm = 1000000u
+};
+
+static const plan_expect_t PLAN_EXPECT[] =
+{
+    /* Exact splits with the highest hardware count */
+    { 256u,  1000u,  256u, 1u,  true },
+    { 4096u, 200u,   256u, 16u, true },
+    { 768u,  1000u,  256u, 3u,  true },
+    /* 256 * 4 = 1024 conversions fit 900 Hz, but not 1000 Hz: 8 * 125 is the highest exact split */
+    { 1000u, 900u,   256u, 4u,  true },
+    { 1000u, 1000u,  8u,   125u, true },
+    /* 100 conversions at 10 kHz leave 4 * 25, 200 at 5 kHz take 128 */
+    { 100u,  10000u, 4u,   25u, true },
+    { 100u,  5000u,  128u, 1u,  true },
+    /* 6016 conversions at 166 Hz, 6144 at 160 Hz */
+    { 6000u, 166u,   128u, 47u, true },
+    { 6000u, 160u,   256u, 24u, true },
+    { 3u,    1000u,  4u,   1u,  true },
+    /* 1000 conversions do not fit 1001 Hz whatever the split */
+    { 1000u, 1001u,  256u, 4u,  false },
+    /* 1111 conversions at 900 Hz only fit without hardware averaging, beyond the CPU */
+    { 1111u, 900u,   1u,   1111u, false }
+};
+
+/*******************************************************************************
+* Function Name: test_expect
+********************************************************************************
+* Summary:
+*  Checks the splits of PLAN_EXPECT.
+*
+*******************************************************************************/
+static void test_expect(void)
+{
+    uint32_t i;
+
+    for (i = 0u; i < (sizeof(PLAN_EXPECT) / sizeof(PLAN_EXPECT[0])); i++)
+    {
+        const plan_expect_t *expect = &PLAN_EXPECT[i];
+        avg_plan_t plan;
+        bool met = avg_plan_select(expect->factor, expect->outputRateHz, &COST, &plan);
+
+        TEST_CHECK(met == expect->met);
+        TEST_CHECK(plan.hwCount == expect->hwCount);
+        TEST_CHECK(plan.swCount == expect->swCount);
+        TEST_CHECK(plan.factor == (expect->hwCount * expect->swCount));
+        TEST_CHECK((1u << plan.hwShift) == plan.hwCount);
+        TEST_CHECK(plan.resultRateHz == (plan.swCount * expect->outputRateHz));
+        TEST_CHECK(plan.cpuLoadPpm == avg_plan_load_ppm(&COST, plan.swCount, expect->outputRateHz));
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_search
+********************************************************************************
+* Summary:
+*  Compares the split of every factor up to SEARCH_FACTOR_MAX, at several
+*  output rates, with the lowest load found by trying every hardware count.
+*
+*******************************************************************************/
+static void test_search(void)
+{
+    static const uint32_t RATES_HZ[] = { 200u, 900u, 1000u, 2500u };
+    uint32_t r;
+    uint32_t factor;
+
+    for (r = 0u; r < (sizeof(RATES_HZ) / sizeof(RATES_HZ[0])); r++)
+    {
+        for (factor = 1u; factor <= SEARCH_FACTOR_MAX; factor++)
+        {
+            uint32_t bestLoad = UINT32_MAX;
+            uint32_t hwCount;
+            avg_plan_t plan;
+            bool met = avg_plan_select(factor, RATES_HZ[r], &COST, &plan);
+
+            for (hwCount = 1u; hwCount <= AVG_PLAN_HW_COUNT_MAX; hwCount <<= 1)
+            {
+                uint32_t swCount = (factor + hwCount - 1u) / hwCount;
+                uint32_t load = avg_plan_load_ppm(&COST, swCount, RATES_HZ[r]);
+
+                if (((hwCount * swCount * RATES_HZ[r]) <= COST.conversionRateHz) && (load < bestLoad))
+                {
+                    bestLoad = load;
+                }
+            }
+
+            TEST_CHECK(met == (bestLoad <= COST.maxLoadPpm));
+            TEST_CHECK(plan.factor >= factor);
+            TEST_CHECK(plan.factor == (plan.hwCount * plan.swCount));
+            if (bestLoad != UINT32_MAX)
+            {
+                TEST_CHECK(plan.cpuLoadPpm == bestLoad);
+                TEST_CHECK((plan.factor * RATES_HZ[r]) <= COST.conversionRateHz);
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_limits
+********************************************************************************
+* Summary:
+*  Checks the load limit, a zero factor, and a factor beyond the software
+*  stage.
+*
+*******************************************************************************/
+static void test_limits(void)
+{
+    avg_plan_cost_t cost = COST;
+    avg_plan_t plan;
+
+    /* 256 * 16 at 200 Hz costs (16 * 400 + 2000) * 200 cycles per second, 5250 ppm */
+    cost.maxLoadPpm = 5250u;
+    TEST_CHECK(avg_plan_select(4096u, 200u, &cost, &plan));
+    cost.maxLoadPpm = 5249u;
+    TEST_CHECK(!avg_plan_select(4096u, 200u, &cost, &plan));
+    TEST_CHECK((plan.hwCount == 256u) && (plan.swCount == 16u) && (plan.cpuLoadPpm == 5250u));
+
+    TEST_CHECK(!avg_plan_select(0u, 200u, &COST, &plan));
+    TEST_CHECK(!avg_plan_select((AVG_PLAN_HW_COUNT_MAX * AVG_PLAN_SW_COUNT_MAX) + 1u, 1u, &COST, &plan));
+    TEST_CHECK(avg_plan_select(AVG_PLAN_HW_COUNT_MAX * AVG_PLAN_SW_COUNT_MAX, 0u, &COST, &plan));
+    TEST_CHECK(plan.swCount == AVG_PLAN_SW_COUNT_MAX);
+}
+
+/*******************************************************************************
+* Function Name: test_accum
+********************************************************************************
+* Summary:
+*  Checks that the software stage returns the rounded mean of every count
+*  results.
+*
+*******************************************************************************/
+static void test_accum(void)
+{
+    static const uint16_t RESULTS[] = { 1u, 2u, 2u, 4095u, 4095u, 4094u, 7u };
+    avg_accum_t accum;
+    uint16_t output = 0u;
+    uint32_t outputs = 0u;
+    uint32_t i;
+
+    avg_accum_init(&accum, 3u);
+
+    for (i = 0u; i < (sizeof(RESULTS) / sizeof(RESULTS[0])); i++)
+    {
+        if (avg_accum_add(&accum, RESULTS[i], &output))
+        {
+            outputs++;
+            TEST_CHECK(output == ((outputs == 1u) ? 2u : 4095u));
+        }
+    }
+
+    TEST_CHECK(outputs == 2u);
+    TEST_CHECK(accum.n == 1u);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the averaging planner tests.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_expect();
+    test_search();
+    test_limits();
+    test_accum();
+
+    return TEST_REPORT("test_avg_plan");
+}
+/* [] END OF FILE */
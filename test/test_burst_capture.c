@@ -0,0 +1,204 @@
+/******************************************************************************
+* File Name:   test_burst_capture.c
+*
+* Description: This file contains the host test of the burst capture: buffer
+*              handling, wrap-safe interval timing, overflow event counting and
+*              the sample rate, with emulated time stamps.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "test_common.h"
+#include "burst_capture.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Emulated time stamp clock and conversion interval: 1 Msps at 250 MHz */
+#define TEST_CLOCK_HZ       (250000000u)
+#define TEST_INTERVAL       (250u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static burst_capture_t g_burst;
+static uint32_t g_rng = 1u;
+
+/*******************************************************************************
+* Function Name: next_random
+********************************************************************************
+* Summary:
+*  Returns the next value of a 32-bit xorshift generator.
+*
+*******************************************************************************/
+static uint32_t next_random(void)
+{
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 17;
+    g_rng ^= g_rng << 5;
+    return g_rng;
+}
+
+/*******************************************************************************
+* Function Name: test_regular
+********************************************************************************
+* Summary:
+*  Fills the buffer at a constant interval, with one overflow event that
+*  doubles one interval, across a wrap around of the time stamp counter.
+*
+*******************************************************************************/
+static void test_regular(void)
+{
+    uint32_t timestamp = 0xFFFFF000u;
+    bool full = false;
+    bool same = true;
+    uint32_t i;
+
+    /* More samples than the buffer holds are limited to its size */
+    burst_capture_start(&g_burst, 100000u);
+    TEST_CHECK(g_burst.target == BURST_CAPTURE_SIZE);
+    TEST_CHECK(!g_burst.done);
+
+    for (i = 0u; (i < (2u * BURST_CAPTURE_SIZE)) && !full; i++)
+    {
+        if (i == 500u)
+        {
+            /* The SAR reports a group overflow, one conversion interval is skipped */
+            burst_capture_gap(&g_burst);
+            timestamp += TEST_INTERVAL;
+        }
+        full = burst_capture_add(&g_burst, (uint16_t)i, timestamp);
+        timestamp += TEST_INTERVAL;
+    }
+
+    TEST_CHECK(full && (i == BURST_CAPTURE_SIZE));
+    TEST_CHECK(g_burst.count == BURST_CAPTURE_SIZE);
+    TEST_CHECK(g_burst.gaps == 1u);
+    TEST_CHECK(g_burst.minInterval == TEST_INTERVAL);
+    TEST_CHECK(g_burst.maxInterval == (2u * TEST_INTERVAL));
+    TEST_CHECK(g_burst.elapsed == (((uint64_t)BURST_CAPTURE_SIZE * TEST_INTERVAL)));
+
+    for (i = 0u; i < BURST_CAPTURE_SIZE; i++)
+    {
+        same = same && (g_burst.buf[i] == (uint16_t)i);
+    }
+    TEST_CHECK(same);
+
+    /* (count - 1) intervals took count * TEST_INTERVAL because of the overflow event */
+    TEST_CHECK(burst_capture_rate(&g_burst, TEST_CLOCK_HZ) ==
+               (uint32_t)(((uint64_t)(BURST_CAPTURE_SIZE - 1u) * TEST_CLOCK_HZ) /
+                          ((uint64_t)BURST_CAPTURE_SIZE * TEST_INTERVAL)));
+
+    /* A full buffer ignores further samples and overflow events */
+    TEST_CHECK(burst_capture_add(&g_burst, 1u, timestamp));
+    burst_capture_gap(&g_burst);
+    TEST_CHECK((g_burst.count == BURST_CAPTURE_SIZE) && (g_burst.gaps == 1u));
+}
+
+/*******************************************************************************
+* Function Name: test_jitter
+********************************************************************************
+* Summary:
+*  Checks the interval statistics and the rate for random intervals.
+*
+*******************************************************************************/
+static void test_jitter(void)
+{
+    const uint32_t samples = 5000u;
+    uint32_t timestamp = next_random();
+    uint32_t minInterval = UINT32_MAX;
+    uint32_t maxInterval = 0u;
+    uint64_t elapsed = 0u;
+    uint32_t i;
+
+    burst_capture_start(&g_burst, samples);
+    for (i = 0u; i < samples; i++)
+    {
+        uint32_t interval = 200u + (next_random() % 101u);
+
+        TEST_CHECK(burst_capture_add(&g_burst, 0u, timestamp) == (i == (samples - 1u)));
+        timestamp += interval;
+
+        /* The interval after the last sample is not part of the burst */
+        if (i != (samples - 1u))
+        {
+            elapsed += interval;
+            minInterval = (interval < minInterval) ? interval : minInterval;
+            maxInterval = (interval > maxInterval) ? interval : maxInterval;
+        }
+    }
+
+    TEST_CHECK(g_burst.elapsed == elapsed);
+    TEST_CHECK(g_burst.minInterval == minInterval);
+    TEST_CHECK(g_burst.maxInterval == maxInterval);
+    TEST_CHECK(burst_capture_rate(&g_burst, TEST_CLOCK_HZ) ==
+               (uint32_t)(((uint64_t)(samples - 1u) * TEST_CLOCK_HZ) / elapsed));
+}
+
+/*******************************************************************************
+* Function Name: test_empty
+********************************************************************************
+* Summary:
+*  Checks that an empty burst is done at once and that the rate of fewer than
+*  two samples is 0.
+*
+*******************************************************************************/
+static void test_empty(void)
+{
+    burst_capture_start(&g_burst, 0u);
+    TEST_CHECK(g_burst.done);
+    TEST_CHECK(burst_capture_rate(&g_burst, TEST_CLOCK_HZ) == 0u);
+
+    burst_capture_start(&g_burst, 10u);
+    (void)burst_capture_add(&g_burst, 0u, 1234u);
+    TEST_CHECK(burst_capture_rate(&g_burst, TEST_CLOCK_HZ) == 0u);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the checks of the burst capture.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_regular();
+    test_jitter();
+    test_empty();
+
+    return TEST_REPORT("test_burst_capture");
+}
+/* [] END OF FILE */
@@ -0,0 +1,551 @@
+/******************************************************************************
+* File Name:   test_capture.c
+*
+* Description: This file contains the host test of the capture tool. It generates
+*              a framed stream with a dropped frame, a corrupted frame, a duplicate
+*              frame, garbage bytes, and a truncated frame, captures it from a file,
+*              a pipe, and a pseudo terminal, and checks the records of the capture
+*              file and its statistics.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#if !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE
+#endif
+#if !defined(_XOPEN_SOURCE)
+#define _XOPEN_SOURCE 700
+#endif
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "test_common.h"
+#include "stream_codec.h"
+#include "stream_frame.h"
+#include "signal_source.h"
+#include "sar2_model.h"
+#include "adc_result.h"
+#include "tools/capture.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of sample frames generated */
+#define TEST_FRAMES     (2048u)
+
+/* Number of samples generated */
+#define TEST_SAMPLES    (TEST_FRAMES * STREAM_BLOCK_SAMPLES)
+
+/* Time base ticks between two samples, and the time of the first sample */
+#define SAMPLE_TICKS    (3200u)
+#define START_TIME      (5000000u)
+
+/* Impairments of the generated stream, by sample frame */
+#define DROP_FRAME      (100u)  /* Not sent */
+#define CORRUPT_FRAME   (300u)  /* One payload bit flipped */
+#define DUPLICATE_FRAME (500u)  /* Sent twice */
+#define GARBAGE_FRAME   (600u)  /* Followed by GARBAGE_SIZE bytes of noise */
+#define GARBAGE_SIZE    (37u)
+
+/* Configuration frames are repeated before these sample frames */
+#define RESYNC_FRAME_1  (200u)
+#define RESYNC_FRAME_2  (400u)
+
+/* Capacity of the capture file that runs full */
+#define SMALL_CAPACITY  (1000u)
+
+/* Bytes written to a pipe or pseudo terminal at once */
+#define WRITE_CHUNK     (1000u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Frames of a generated stream */
+typedef struct
+{
+    uint8_t *bytes;
+    uint32_t size;
+    uint16_t sequence;
+    uint64_t frameTime;
+} stream_writer_t;
+
+/* Capture run in a thread */
+typedef struct
+{
+    int fd;
+    capture_options_t options;
+    capture_result_t result;
+    int rc;
+} capture_job_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint16_t g_samples[TEST_SAMPLES];
+static uint8_t g_stream[(TEST_SAMPLES * 4u) + 4096u];
+static uint32_t g_streamSize;
+
+/*******************************************************************************
+* Function Name: sleep_ms
+********************************************************************************
+* Summary:
+*  Waits for a number of milliseconds.
+*
+*******************************************************************************/
+static void sleep_ms(uint32_t ms)
+{
+    const struct timespec wait = { (time_t)(ms / 1000u), (long)(ms % 1000u) * 1000000L };
+
+    (void)nanosleep(&wait, NULL);
+}
+
+/*******************************************************************************
+* Function Name: frame_time
+********************************************************************************
+* Summary:
+*  Returns the time of the first sample of a sample frame.
+*
+*******************************************************************************/
+static uint64_t frame_time(uint32_t frame)
+{
+    return START_TIME + ((uint64_t)frame * STREAM_BLOCK_SAMPLES * SAMPLE_TICKS);
+}
+
+/*******************************************************************************
+* Function Name: write_config
+********************************************************************************
+* Summary:
+*  Appends a configuration frame with the time of the next sample frame.
+*
+*******************************************************************************/
+static void write_config(stream_writer_t *w, uint64_t time)
+{
+    const stream_frame_config_t config =
+    {
+        .outputFormat = UNSIGNED_RIGHT_ALIGNED, .blockSamples = STREAM_BLOCK_SAMPLES, .averageCount = 1u,
+        .bandGapMv = 1200u, .tickHz = 320000000u, .time = time
+    };
+    uint8_t *frame = &w->bytes[w->size];
+    uint32_t length = stream_frame_pack_config(&frame[STREAM_FRAME_HEADER_SIZE], &config);
+
+    w->size += stream_frame_finish(frame, STREAM_FRAME_TYPE_CONFIG, w->sequence++, length);
+    w->frameTime = time;
+}
+
+/*******************************************************************************
+* Function Name: write_samples
+********************************************************************************
+* Summary:
+*  Appends a sample frame, the way the application sends them.
+*
+* Return:
+*  uint32_t - Size of the frame
+*
+*******************************************************************************/
+static uint32_t write_samples(stream_writer_t *w, uint32_t frameIndex)
+{
+    uint8_t *frame = &w->bytes[w->size];
+    uint64_t time = frame_time(frameIndex);
+    uint32_t length;
+    uint32_t size;
+
+    length = stream_frame_pack_varint(&frame[STREAM_FRAME_HEADER_SIZE], time - w->frameTime);
+    length += stream_encode_block(&g_samples[frameIndex * STREAM_BLOCK_SAMPLES], STREAM_BLOCK_SAMPLES,
+                                  &frame[STREAM_FRAME_HEADER_SIZE + length]);
+    size = stream_frame_finish(frame, STREAM_FRAME_TYPE_SAMPLES, w->sequence++, length);
+    w->size += size;
+    w->frameTime = time;
+
+    return size;
+}
+
+/*******************************************************************************
+* Function Name: generate_stream
+********************************************************************************
+* Summary:
+*  Generates the impaired stream of a sine into g_stream. The sequence numbers
+*  wrap around, and a truncated frame ends the stream.
+*
+*******************************************************************************/
+static void generate_stream(void)
+{
+    stream_writer_t w = { .bytes = g_stream, .size = 0u, .sequence = 0xFF00u, .frameTime = 0u };
+    signal_source_t src;
+    uint32_t size;
+    uint32_t f;
+
+    signal_source_init(&src, SIGNAL_SINE, 42u);
+    for (f = 0u; f < TEST_SAMPLES; f++)
+    {
+        g_samples[f] = signal_source_next_result(&src, 1u, 0u, UNSIGNED_RIGHT_ALIGNED);
+    }
+
+    write_config(&w, START_TIME);
+    for (f = 0u; f < TEST_FRAMES; f++)
+    {
+        if ((f == RESYNC_FRAME_1) || (f == RESYNC_FRAME_2))
+        {
+            write_config(&w, frame_time(f));
+        }
+
+        size = write_samples(&w, f);
+
+        if (f == DROP_FRAME)
+        {
+            w.size -= size;
+        }
+        else if (f == CORRUPT_FRAME)
+        {
+            w.bytes[w.size - size + STREAM_FRAME_HEADER_SIZE + 3u] ^= 0x10u;
+        }
+        else if (f == DUPLICATE_FRAME)
+        {
+            memcpy(&w.bytes[w.size], &w.bytes[w.size - size], size);
+            w.size += size;
+        }
+        else if (f == GARBAGE_FRAME)
+        {
+            memset(&w.bytes[w.size], 0x11, GARBAGE_SIZE);
+            w.size += GARBAGE_SIZE;
+        }
+    }
+
+    /* The capture ended in the middle of the next frame */
+    w.frameTime = frame_time(TEST_FRAMES - 1u);
+    size = write_samples(&w, TEST_FRAMES - 1u);
+    w.size -= size / 2u;
+
+    g_streamSize = w.size;
+}
+
+/*******************************************************************************
+* Function Name: check_records
+********************************************************************************
+* Summary:
+*  Checks the first records of a capture against the generated samples: the
+*  dropped and the corrupted frame are missing, and the frames after them have
+*  no valid time until the next configuration frame.
+*
+* Return:
+*  bool - true if all records match
+*
+*******************************************************************************/
+static bool check_records(const capture_record_t *rec, uint64_t count)
+{
+    uint64_t n = 0u;
+    bool timeValid;
+    bool ok = true;
+    uint32_t f;
+    uint32_t i;
+
+    for (f = 0u; (f < TEST_FRAMES) && (n < count); f++)
+    {
+        if ((f == DROP_FRAME) || (f == CORRUPT_FRAME))
+        {
+            continue;
+        }
+
+        timeValid = !(((f > DROP_FRAME) && (f < RESYNC_FRAME_1)) || ((f > CORRUPT_FRAME) && (f < RESYNC_FRAME_2)));
+
+        for (i = 0u; (i < STREAM_BLOCK_SAMPLES) && (n < count); i++, n++)
+        {
+            ok = ok && (rec[n].result == g_samples[(f * STREAM_BLOCK_SAMPLES) + i]) && (rec[n].index == i) &&
+                 (rec[n].averageCount == 1u) && (rec[n].outputFormat == UNSIGNED_RIGHT_ALIGNED) &&
+                 (rec[n].flags == (timeValid ? 0u : CAPTURE_FLAG_TIME_INVALID)) &&
+                 (!timeValid || (rec[n].time == frame_time(f)));
+        }
+    }
+
+    return ok && (n == count);
+}
+
+/*******************************************************************************
+* Function Name: check_capture
+********************************************************************************
+* Summary:
+*  Checks a complete capture: the result, the header, the size, and the
+*  records of the capture file.
+*
+*******************************************************************************/
+static void check_capture(const char *path, const capture_result_t *result)
+{
+    const uint64_t expected = (uint64_t)(TEST_FRAMES - 2u) * STREAM_BLOCK_SAMPLES;
+    const capture_header_t *h;
+    capture_map_t map;
+
+    TEST_CHECK(!result->full);
+    TEST_CHECK(result->records == expected);
+    TEST_CHECK(result->stream.bytes == g_streamSize);
+    TEST_CHECK(result->stream.lostFrames == 2u);
+    TEST_CHECK(result->stream.crcErrors >= 1u);
+    TEST_CHECK(result->stream.duplicates == 1u);
+    TEST_CHECK(result->stream.skippedBytes >= GARBAGE_SIZE);
+    TEST_CHECK(result->stream.configFrames == 3u);
+    TEST_CHECK(result->stream.unconfigured == 0u);
+
+    TEST_CHECK(capture_open(path, &map) == 0);
+    if (map.header == NULL)
+    {
+        return;
+    }
+
+    h = map.header;
+    TEST_CHECK(h->records == expected);
+    TEST_CHECK(map.size == (sizeof(capture_header_t) + (expected * sizeof(capture_record_t))));
+    TEST_CHECK(h->tickHz == 320000000u);
+    TEST_CHECK((h->bytes == result->stream.bytes) && (h->frames == result->stream.frames) &&
+               (h->crcErrors == result->stream.crcErrors) && (h->lostFrames == result->stream.lostFrames) &&
+               (h->skippedBytes == result->stream.skippedBytes));
+    TEST_CHECK(check_records(map.records, h->records));
+
+    capture_close(&map);
+}
+
+/*******************************************************************************
+* Function Name: capture_thread
+********************************************************************************
+* Summary:
+*  Runs a capture job.
+*
+*******************************************************************************/
+static void *capture_thread(void *arg)
+{
+    capture_job_t *job = (capture_job_t *)arg;
+
+    job->rc = capture_run(job->fd, &job->options, &job->result);
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: write_all
+********************************************************************************
+* Summary:
+*  Writes the generated stream to a pipe or pseudo terminal in chunks.
+*
+*******************************************************************************/
+static void write_all(int fd)
+{
+    uint32_t pos = 0u;
+    ssize_t n;
+
+    while (pos < g_streamSize)
+    {
+        n = write(fd, &g_stream[pos], ((g_streamSize - pos) < WRITE_CHUNK) ? (g_streamSize - pos) : WRITE_CHUNK);
+        if (n <= 0)
+        {
+            break;
+        }
+        pos += (uint32_t)n;
+    }
+
+    TEST_CHECK(pos == g_streamSize);
+}
+
+/*******************************************************************************
+* Function Name: wait_drained
+********************************************************************************
+* Summary:
+*  Waits until the reader has read all bytes written to a pipe or pseudo
+*  terminal.
+*
+*******************************************************************************/
+static void wait_drained(int fd)
+{
+    uint32_t idle = 0u;
+    int pending;
+
+    while (idle < 5u)
+    {
+        sleep_ms(10u);
+        idle = ((ioctl(fd, FIONREAD, &pending) == 0) && (pending == 0)) ? (idle + 1u) : 0u;
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_file
+********************************************************************************
+* Summary:
+*  Captures the stream from a file, which ends the capture at its end, and
+*  into a capture file too small for it, which ends the capture when full.
+*
+*******************************************************************************/
+static void test_file(const char *streamPath, const char *capturePath)
+{
+    capture_options_t options = { .path = capturePath, .capacity = TEST_SAMPLES, .progress = false };
+    capture_result_t result;
+    capture_map_t map;
+    int fd;
+
+    fd = open(streamPath, O_RDONLY);
+    TEST_CHECK(fd >= 0);
+    TEST_CHECK(capture_run(fd, &options, &result) == 0);
+    (void)close(fd);
+    check_capture(capturePath, &result);
+    printf("file: %u bytes in %.3f ms\r\n", (unsigned)g_streamSize, result.seconds * 1000.0);
+
+    options.capacity = SMALL_CAPACITY;
+    fd = open(streamPath, O_RDONLY);
+    TEST_CHECK(capture_run(fd, &options, &result) == 0);
+    (void)close(fd);
+    TEST_CHECK(result.full);
+    TEST_CHECK(result.records == SMALL_CAPACITY);
+
+    TEST_CHECK(capture_open(capturePath, &map) == 0);
+    if (map.header != NULL)
+    {
+        TEST_CHECK(map.header->records == SMALL_CAPACITY);
+        TEST_CHECK(map.header->capacity == SMALL_CAPACITY);
+        TEST_CHECK(map.size == (sizeof(capture_header_t) + (SMALL_CAPACITY * sizeof(capture_record_t))));
+        TEST_CHECK(check_records(map.records, SMALL_CAPACITY));
+        capture_close(&map);
+    }
+
+    /* A file that is not a capture is rejected */
+    TEST_CHECK(capture_open(streamPath, &map) != 0);
+}
+
+/*******************************************************************************
+* Function Name: test_pipe
+********************************************************************************
+* Summary:
+*  Captures the stream from a pipe that stays open; capture_stop() ends the
+*  capture after all bytes were read, and none of them is lost.
+*
+*******************************************************************************/
+static void test_pipe(const char *capturePath)
+{
+    capture_job_t job = { .options = { .path = capturePath, .capacity = TEST_SAMPLES, .progress = false } };
+    pthread_t thread;
+    int fds[2];
+
+    TEST_CHECK(pipe(fds) == 0);
+    job.fd = fds[0];
+    TEST_CHECK(pthread_create(&thread, NULL, &capture_thread, &job) == 0);
+
+    write_all(fds[1]);
+    wait_drained(fds[0]);
+    capture_stop();
+    (void)pthread_join(thread, NULL);
+    (void)close(fds[0]);
+    (void)close(fds[1]);
+
+    TEST_CHECK(job.rc == 0);
+    check_capture(capturePath, &job.result);
+}
+
+/*******************************************************************************
+* Function Name: test_pty
+********************************************************************************
+* Summary:
+*  Captures the stream from the raw slave side of a pseudo terminal, like
+*  from the serial port of the kit; the hang-up of the master side ends the
+*  capture.
+*
+*******************************************************************************/
+static void test_pty(const char *capturePath)
+{
+    capture_job_t job = { .options = { .path = capturePath, .capacity = TEST_SAMPLES, .progress = false } };
+    struct termios tio;
+    pthread_t thread;
+    int master;
+
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((master < 0) || (grantpt(master) != 0) || (unlockpt(master) != 0))
+    {
+        printf("pty: not available, skipped\r\n");
+        return;
+    }
+
+    job.fd = open(ptsname(master), O_RDONLY | O_NOCTTY);
+    TEST_CHECK(job.fd >= 0);
+    TEST_CHECK(tcgetattr(job.fd, &tio) == 0);
+    cfmakeraw(&tio);
+    TEST_CHECK(tcsetattr(job.fd, TCSANOW, &tio) == 0);
+
+    TEST_CHECK(pthread_create(&thread, NULL, &capture_thread, &job) == 0);
+    write_all(master);
+    wait_drained(job.fd);
+    (void)close(master);
+    (void)pthread_join(thread, NULL);
+    (void)close(job.fd);
+
+    TEST_CHECK(job.rc == 0);
+    check_capture(capturePath, &job.result);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the capture checks with temporary stream and capture files.
+*
+*******************************************************************************/
+int main(void)
+{
+    char streamPath[] = "/tmp/test_capture_streamXXXXXX";
+    char capturePath[] = "/tmp/test_capture_fileXXXXXX";
+    int streamFd;
+    int captureFd;
+
+    generate_stream();
+
+    streamFd = mkstemp(streamPath);
+    captureFd = mkstemp(capturePath);
+    TEST_CHECK((streamFd >= 0) && (captureFd >= 0));
+    if ((streamFd < 0) || (captureFd < 0))
+    {
+        return TEST_REPORT("test_capture");
+    }
+    TEST_CHECK(write(streamFd, g_stream, g_streamSize) == (ssize_t)g_streamSize);
+    (void)close(streamFd);
+    (void)close(captureFd);
+
+    test_file(streamPath, capturePath);
+    test_pipe(capturePath);
+    test_pty(capturePath);
+
+    (void)unlink(streamPath);
+    (void)unlink(capturePath);
+
+    return TEST_REPORT("test_capture");
+}
+/* [] END OF FILE */
@@ -0,0 +1,77 @@
+/******************************************************************************
+* File Name:   test_common.h
+*
+* Description: This file contains the check macros shared by the host tests of
+*              the device independent modules.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Records a failed check with its location, without stopping the test */
+#define TEST_CHECK(cond)                                                        \
+    do                                                                          \
+    {                                                                           \
+        g_testChecks++;                                                         \
+        if (!(cond))                                                            \
+        {                                                                       \
+            g_testFailures++;                                                   \
+            printf("%s:%d: check failed: %s\r\n", __FILE__, __LINE__, #cond);   \
+        }                                                                       \
+    } while (0)
+
+/* Prints the summary of a test program and returns its exit code */
+#define TEST_REPORT(name)                                                       \
+    (printf("%-20s %s (%lu checks, %lu failed)\r\n", (name),                    \
+            (g_testFailures == 0u) ? "PASS" : "FAIL",                           \
+            (unsigned long)g_testChecks, (unsigned long)g_testFailures),        \
+     (g_testFailures == 0u) ? 0 : 1)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint32_t g_testChecks;
+static uint32_t g_testFailures;
+
+#endif /* TEST_COMMON_H */
+/* [] END OF FILE */
@@ -0,0 +1,652 @@
+/******************************************************************************
+* File Name:   test_emu.c
+*
+* Description: This file contains the end-to-end test of the application
+*              on the host emulation of the device (emu/emu.c): main.c,
+*              built unmodified as emu_app, is run with key scripts on its
+*              standard input, and its output is checked: the result display,
+*              the loss counters, the burst capture rate against the emulated
+*              conversion time, the range events, the decoded sample stream,
+*              and the low-power blocks.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include "test_common.h"
+#include "burst_capture.h"
+#include "tools/stream_decoder.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Time between two keys of a script, in ms; a space is a key without action */
+#define KEY_MS              (300u)
+
+/* Group rate of the emulated SAR2: band gap and AN0, 120 + 16 cycles each at 100 MHz / 26 */
+#define EXPECTED_RATE       ((100000000u / 26u) / (2u * (120u + 16u)))
+
+/* Interrupt latency: the same group time in cycles of the emulated 200 MHz CPU clock */
+#define EXPECTED_LATENCY    ((200u * 26u * 2u * (120u + 16u)) / 100u)
+
+/* Sample period at an average count of 512: two groups of 256 AN0 and one band gap conversion */
+#define EXPECTED_AVG512_NS  ((2ull * (256u + 1u) * (120u + 16u) * 26u * 1000u) / 100u)
+
+/* Window of the range events, see RANGE_WINDOW_AN0 in main.c */
+#define RANGE_LO            (0x400u)
+#define RANGE_HI            (0xC00u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Output of one run of the application */
+typedef struct
+{
+    char *data;
+    size_t size;
+    int status;
+} run_output_t;
+
+/* Sample frames seen by the stream decoder */
+typedef struct
+{
+    uint32_t blocks;
+    uint32_t outOfRange;
+    uint32_t timeBackwards;
+    uint64_t firstTime;
+    uint64_t lastTime;
+} stream_check_t;
+
+/*******************************************************************************
+* Function Name: run_app
+********************************************************************************
+* Summary:
+*  Runs emu_app with the given keys on its standard input and the given
+*  environment variable settings, and collects its output, which is
+*  terminated with a zero byte.
+*
+*******************************************************************************/
+static void run_app(const char *env, const char *keys, run_output_t *out)
+{
+    char command[256];
+    size_t capacity = 65536u;
+    size_t n;
+    FILE *pipe;
+
+    snprintf(command, sizeof(command), "printf '%s' | %s EMU_KEY_MS=%u ./emu_app", keys, env, KEY_MS);
+
+    out->data = malloc(capacity);
+    out->size = 0u;
+    out->status = -1;
+
+    pipe = popen(command, "r");
+    if ((pipe == NULL) || (out->data == NULL))
+    {
+        return;
+    }
+
+    while ((n = fread(&out->data[out->size], 1u, capacity - out->size - 1u, pipe)) != 0u)
+    {
+        out->size += n;
+        if ((capacity - out->size) < 4096u)
+        {
+            capacity *= 2u;
+            out->data = realloc(out->data, capacity);
+            if (out->data == NULL)
+            {
+                break;
+            }
+        }
+    }
+
+    out->status = pclose(pipe);
+    if (out->data != NULL)
+    {
+        out->data[out->size] = '\0';
+    }
+}
+
+/*******************************************************************************
+* Function Name: find_text
+********************************************************************************
+* Summary:
+*  Returns the first occurrence of text in the output from position from on,
+*  or NULL. The output may hold binary frames with zero bytes.
+*
+*******************************************************************************/
+static const char *find_text(const run_output_t *out, const char *from, const char *text)
+{
+    size_t len = strlen(text);
+    const char *end = out->data + out->size;
+    const char *p;
+
+    for (p = (from != NULL) ? from : out->data; (p + len) <= end; p++)
+    {
+        if ((*p == *text) && (memcmp(p, text, len) == 0))
+        {
+            return p;
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: read_value
+********************************************************************************
+* Summary:
+*  Returns the number following the last occurrence of label, or -1 if the
+*  label is not in the output.
+*
+*******************************************************************************/
+static long read_value(const run_output_t *out, const char *label)
+{
+    const char *found = NULL;
+    const char *p = NULL;
+
+    while ((p = find_text(out, (p != NULL) ? (p + 1) : NULL, label)) != NULL)
+    {
+        found = p;
+    }
+
+    return (found != NULL) ? strtol(found + strlen(label), NULL, 10) : -1;
+}
+
+/*******************************************************************************
+* Function Name: stream_block
+********************************************************************************
+* Summary:
+*  Stream decoder callback: checks the range of the samples and that the
+*  time of the blocks rises.
+*
+*******************************************************************************/
+static void stream_block(void *context, const stream_decoder_block_t *block)
+{
+    stream_check_t *check = (stream_check_t *)context;
+    uint32_t i;
+
+    for (i = 0u; i < block->count; i++)
+    {
+        if (block->samples[i] > 0xFFFu)
+        {
+            check->outOfRange++;
+        }
+    }
+
+    if (check->blocks == 0u)
+    {
+        check->firstTime = block->time;
+    }
+    else if (block->time <= check->lastTime)
+    {
+        check->timeBackwards++;
+    }
+
+    check->lastTime = block->time;
+    check->blocks++;
+}
+
+/*******************************************************************************
+* Function Name: test_display
+********************************************************************************
+* Summary:
+*  Checks the banner, the result display, and the loss counters of the
+*  software triggered conversions, which must not lose any result.
+*
+*******************************************************************************/
+static void test_display(void)
+{
+    run_output_t out;
+
+    run_app("", "  l ", &out);
+
+    TEST_CHECK(out.status == 0);
+    TEST_CHECK(find_text(&out, NULL, "Code Example: SAR ADC Various Processing of Conversion Result") != NULL);
+    TEST_CHECK(find_text(&out, NULL, "Output format: Unsigned/Right Aligned") != NULL);
+    TEST_CHECK(find_text(&out, NULL, "Average count: 1\r\n") != NULL);
+    TEST_CHECK(find_text(&out, NULL, "Potentiometer voltage: ") != NULL);
+    TEST_CHECK(read_value(&out, "Results serviced:") > 1000);
+    TEST_CHECK(read_value(&out, "Invalid results:") == 0);
+    TEST_CHECK(read_value(&out, "Result overflows:") == 0);
+    TEST_CHECK(read_value(&out, "Group overflow events:") == 0);
+    TEST_CHECK(read_value(&out, "UART lines dropped:") == 0);
+
+    free(out.data);
+}
+
+/*******************************************************************************
+* Function Name: test_burst
+********************************************************************************
+* Summary:
+*  Checks that the burst capture fills its buffer at the group rate of the
+*  emulated SAR2 and sees the whole sine on AN0.
+*
+*******************************************************************************/
+static void test_burst(void)
+{
+    run_output_t out;
+    const char *line;
+    long rate;
+
+    run_app("", " f ", &out);
+
+    TEST_CHECK(out.status == 0);
+    TEST_CHECK(read_value(&out, "Burst:") == (long)BURST_CAPTURE_SIZE);
+
+    line = find_text(&out, NULL, " samples, ");
+    rate = (line != NULL) ? strtol(line + strlen(" samples, "), NULL, 10) : -1;
+    TEST_CHECK((rate > (long)(EXPECTED_RATE * 9u / 10u)) && (rate < (long)(EXPECTED_RATE * 11u / 10u)));
+
+    line = find_text(&out, NULL, "Result min/mean/max: ");
+    TEST_CHECK(line != NULL);
+    if (line != NULL)
+    {
+        char *next;
+        long min = strtol(line + strlen("Result min/mean/max: "), &next, 10);
+        long mean = strtol(next + 1, &next, 10);
+        long max = strtol(next + 1, NULL, 10);
+
+        /* Sine of 2048 +/- 1800 codes */
+        TEST_CHECK((min < 400) && (max > 3700));
+        TEST_CHECK((mean > 1948) && (mean < 2148));
+    }
+
+    free(out.data);
+}
+
+/*******************************************************************************
+* Function Name: test_burst_timeout
+********************************************************************************
+* Summary:
+*  Stops the emulated SAR2 shortly after the burst capture has started: the
+*  capture must give up after BURST_TIMEOUT_MS and report the samples it got
+*  instead of waiting forever.
+*
+*******************************************************************************/
+static void test_burst_timeout(void)
+{
+    run_output_t out;
+    const char *line;
+    long count = -1;
+
+    /* 'f' is read at 2 * KEY_MS, the SAR2 stops 150 ms later */
+    run_app("EMU_SAR_STOP_MS=750", " f ", &out);
+
+    TEST_CHECK(out.status == 0);
+
+    line = find_text(&out, NULL, "Burst timed out after 2000 ms with ");
+    TEST_CHECK(line != NULL);
+    if (line != NULL)
+    {
+        count = strtol(line + strlen("Burst timed out after 2000 ms with "), NULL, 10);
+    }
+
+    /* About 150 ms of samples */
+    TEST_CHECK((count > (long)(EXPECTED_RATE / 20u)) && (count < (long)BURST_CAPTURE_SIZE));
+    TEST_CHECK(read_value(&out, "Burst:") == count);
+
+    free(out.data);
+}
+
+/*******************************************************************************
+* Function Name: test_probe
+********************************************************************************
+* Summary:
+*  Checks the interrupt latency and jitter of the execution time report: the
+*  latency from the software trigger to the handler is the group time of the
+*  emulated SAR2, every handler entry is recorded, and no group completes
+*  before the previous one is serviced.
+*
+*******************************************************************************/
+static void test_probe(void)
+{
+    run_output_t out;
+    const char *line;
+    char *next;
+    long count = -1;
+    long min = -1;
+    long mean = -1;
+    long jitterCount = -1;
+
+    run_app("", "  p ", &out);
+
+    TEST_CHECK(out.status == 0);
+
+    line = find_text(&out, NULL, "\r\nLatency ");
+    if (line != NULL)
+    {
+        count = strtol(line + strlen("\r\nLatency "), &next, 10);
+        min = strtol(next, &next, 10);
+        mean = strtol(next, NULL, 10);
+    }
+    line = find_text(&out, NULL, "\r\nJitter ");
+    if (line != NULL)
+    {
+        jitterCount = strtol(line + strlen("\r\nJitter "), NULL, 10);
+    }
+
+    TEST_CHECK(count > 1000);
+    TEST_CHECK((min >= (long)EXPECTED_LATENCY) && (min < (long)(EXPECTED_LATENCY + 500u)));
+    TEST_CHECK((mean >= min) && (mean < (long)(EXPECTED_LATENCY + 1000u)));
+    TEST_CHECK(jitterCount == (count - 2));
+    TEST_CHECK(read_value(&out, "Group overflow events:") == 0);
+
+    free(out.data);
+}
+
+/*******************************************************************************
+* Function Name: test_range
+********************************************************************************
+* Summary:
+*  Checks the range events: AN0 leaves the window outside of it, enters it
+*  inside of it, the events alternate, and their time does not go back.
+*
+*******************************************************************************/
+static void test_range(void)
+{
+    run_output_t out;
+    const char *p;
+    uint32_t events = 0u;
+    uint32_t wrong = 0u;
+    long lastTime = -1;
+    bool lastEnter = true;
+
+    run_app("", " w ", &out);
+
+    TEST_CHECK(out.status == 0);
+    p = find_text(&out, NULL, "time_ms,channel,event,result\r\n");
+    TEST_CHECK(p != NULL);
+
+    while ((p != NULL) && ((p = find_text(&out, p + 1, ",AN0,")) != NULL))
+    {
+        const char *start = p;
+        bool enter = (strncmp(p + 5, "enter,", 6u) == 0);
+        long result = strtol(p + 11, NULL, 10);
+
+        while ((start > out.data) && (start[-1] != '\n'))
+        {
+            start--;
+        }
+
+        if (enter)
+        {
+            wrong += ((result < (long)RANGE_LO) || (result > (long)RANGE_HI)) ? 1u : 0u;
+        }
+        else
+        {
+            wrong += ((result >= (long)RANGE_LO) && (result <= (long)RANGE_HI)) ? 1u : 0u;
+        }
+        wrong += ((events != 0u) && (enter == lastEnter)) ? 1u : 0u;
+        wrong += (strtol(start, NULL, 10) < lastTime) ? 1u : 0u;
+
+        lastTime = strtol(start, NULL, 10);
+        lastEnter = enter;
+        events++;
+    }
+
+    /* The sine crosses the window four times per period */
+    TEST_CHECK(events >= 8u);
+    TEST_CHECK(wrong == 0u);
+
+    free(out.data);
+}
+
+/*******************************************************************************
+* Function Name: test_stream
+********************************************************************************
+* Summary:
+*  Decodes the sample stream out of the output, which also holds the text
+*  before and after it: no frame may be lost or damaged.
+*
+*******************************************************************************/
+static void test_stream(void)
+{
+    static stream_decoder_t dec;
+    stream_check_t check = { 0 };
+    run_output_t out;
+
+    run_app("", " m  m ", &out);
+
+    TEST_CHECK(out.status == 0);
+
+    stream_decoder_init(&dec, &stream_block, &check);
+    stream_decoder_feed(&dec, (const uint8_t *)out.data, (uint32_t)out.size);
+
+    TEST_CHECK(dec.stats.configFrames >= 1u);
+    TEST_CHECK(check.blocks >= 10u);
+    TEST_CHECK(dec.stats.crcErrors == 0u);
+    TEST_CHECK(dec.stats.malformed == 0u);
+    TEST_CHECK(dec.stats.lostFrames == 0u);
+    TEST_CHECK(dec.stats.unconfigured == 0u);
+    TEST_CHECK(check.outOfRange == 0u);
+    TEST_CHECK(check.timeBackwards == 0u);
+    TEST_CHECK(dec.haveConfig && (dec.config.tickHz != 0u) && (dec.config.averageCount == 1u));
+
+    /* The display is back after the stream */
+    TEST_CHECK(find_text(&out, (const char *)out.data + out.size / 2u, "Output format: ") != NULL);
+
+    free(out.data);
+}
+
+/*******************************************************************************
+* Function Name: test_averaging
+********************************************************************************
+* Summary:
+*  Checks an average count above the SAR2 maximum in the sample stream: at
+*  512, the SAR2 averages 256 conversions and the software stage two of its
+*  results, so a sample takes two groups of 256 AN0 conversions and one band
+*  gap conversion.
+*
+*******************************************************************************/
+static void test_averaging(void)
+{
+    static stream_decoder_t dec;
+    stream_check_t check = { 0 };
+    run_output_t out;
+    uint64_t samplePeriodNs;
+
+    run_app("", "ddddddddd m        m ", &out);
+
+    TEST_CHECK(out.status == 0);
+
+    stream_decoder_init(&dec, &stream_block, &check);
+    stream_decoder_feed(&dec, (const uint8_t *)out.data, (uint32_t)out.size);
+
+    TEST_CHECK(dec.stats.crcErrors == 0u);
+    TEST_CHECK(dec.stats.lostFrames == 0u);
+    TEST_CHECK(check.outOfRange == 0u);
+    TEST_CHECK(dec.haveConfig && (dec.config.averageCount == 512u));
+    TEST_CHECK(check.blocks >= 3u);
+
+    /* Every block but the last holds STREAM_BLOCK_SAMPLES samples */
+    if (dec.haveConfig && (dec.config.tickHz != 0u) && (check.blocks >= 2u))
+    {
+        samplePeriodNs = ((check.lastTime - check.firstTime) * 1000000000u) /
+                         ((uint64_t)dec.config.tickHz * STREAM_BLOCK_SAMPLES * (check.blocks - 1u));
+        TEST_CHECK(samplePeriodNs > ((EXPECTED_AVG512_NS * 95u) / 100u));
+        TEST_CHECK(samplePeriodNs < ((EXPECTED_AVG512_NS * 105u) / 100u));
+    }
+
+    free(out.data);
+}
+
+/*******************************************************************************
+* Function Name: test_stages
+********************************************************************************
+* Summary:
+*  Checks the stages of the main loop under overload: in stream mode the
+*  acquisition produces more samples than the UART carries. The processing
+*  stage must drop the excess in the sample ring and count it, every
+*  acquired result must either reach the stream or be counted as a drop,
+*  and the command stage must still read the key that ends the stream.
+*
+*******************************************************************************/
+static void test_stages(void)
+{
+    stream_decoder_t dec;
+    stream_check_t check = { 0 };
+    run_output_t out;
+    const char *report = NULL;
+    const char *p = NULL;
+    char *next;
+    long drops = -1;
+    long gaps = -1;
+    double span;
+    double rate;
+
+    run_app("", " l m   m l ", &out);
+
+    TEST_CHECK(out.status == 0);
+
+    stream_decoder_init(&dec, &stream_block, &check);
+    stream_decoder_feed(&dec, (const uint8_t *)out.data, (uint32_t)out.size);
+
+    while ((p = find_text(&out, (p != NULL) ? (p + 1) : NULL, "Stream ring drops:")) != NULL)
+    {
+        report = p;
+    }
+    if (report != NULL)
+    {
+        drops = strtol(report + strlen("Stream ring drops:"), &next, 10);
+        gaps = (strncmp(next, " in ", 4u) == 0) ? strtol(next + 4, NULL, 10) : -1;
+    }
+
+    TEST_CHECK((drops > 0) && (gaps > 0) && (gaps <= drops));
+    TEST_CHECK(dec.stats.lostFrames == 0u);
+    TEST_CHECK(find_text(&out, (report != NULL) ? report : (out.data + out.size), "Output format: ") != NULL);
+
+    /* Streamed and dropped samples together make up the group rate */
+    span = (dec.haveConfig && (dec.config.tickHz != 0u) && (check.blocks > 1u)) ?
+           ((double)(check.lastTime - check.firstTime) / (double)dec.config.tickHz) : 0.0;
+    rate = (span > 0.0) ? ((double)((uint64_t)drops + dec.stats.samples) / span) : 0.0;
+    TEST_CHECK((rate > (EXPECTED_RATE * 0.9)) && (rate < (EXPECTED_RATE * 1.1)));
+
+    free(out.data);
+}
+
+/*******************************************************************************
+* Function Name: test_lowpower
+********************************************************************************
+* Summary:
+*  Checks the low-power block acquisition at 1 kHz: the block lines, no
+*  overruns or late sample periods, and no invalid results, as the group
+*  converts within a sample period.
+*
+*******************************************************************************/
+static void test_lowpower(void)
+{
+    run_output_t out;
+    const char *p;
+    uint32_t blocks = 0u;
+    uint32_t wrong = 0u;
+
+    run_app("", " zz   l ", &out);
+
+    TEST_CHECK(out.status == 0);
+    TEST_CHECK(find_text(&out, NULL, "Low-power mode: 100 Hz") != NULL);
+    TEST_CHECK(find_text(&out, NULL, "block,min,mean,max,overruns,late,invalid\r\n") != NULL);
+    p = find_text(&out, NULL, "Low-power mode: 1000 Hz");
+    TEST_CHECK(p != NULL);
+
+    while ((p != NULL) && ((p = find_text(&out, p + 1, "\r\n")) != NULL))
+    {
+        char *next;
+        long block;
+        long min;
+        long mean;
+        long max;
+        long overruns;
+        long late;
+        long invalid;
+
+        /* strtol() would skip the line breaks of an empty line */
+        if ((p[2] < '0') || (p[2] > '9'))
+        {
+            continue;
+        }
+
+        block = strtol(p + 2, &next, 10);
+        if (*next != ',')
+        {
+            continue;
+        }
+
+        min = strtol(next + 1, &next, 10);
+        mean = strtol(next + 1, &next, 10);
+        max = strtol(next + 1, &next, 10);
+        overruns = strtol(next + 1, &next, 10);
+        late = strtol(next + 1, &next, 10);
+        invalid = strtol(next + 1, NULL, 10);
+
+        wrong += (block != (long)blocks) ? 1u : 0u;
+        wrong += ((min > mean) || (mean > max) || (max > 0xFFF)) ? 1u : 0u;
+        wrong += ((overruns != 0) || (late != 0) || (invalid != 0)) ? 1u : 0u;
+        blocks++;
+    }
+
+    TEST_CHECK(blocks >= 2u);
+    TEST_CHECK(wrong == 0u);
+    TEST_CHECK(read_value(&out, "Invalid results:") == 0);
+
+    free(out.data);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the end-to-end tests on emu_app.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_display();
+    test_burst();
+    test_burst_timeout();
+    test_probe();
+    test_range();
+    test_stream();
+    test_averaging();
+    test_stages();
+    test_lowpower();
+
+    return TEST_REPORT("test_emu");
+}
+/* [] END OF FILE */
@@ -0,0 +1,371 @@
+/******************************************************************************
+* File Name:   test_lowpower.c
+*
+* Description: This file contains the host test of the low-power block
+*              acquisition. It emulates the acquisition with the block buffer
+*              functions against a timeline with a timer interrupt per sample,
+*              CPU sleep, and wake-up, and checks that no result is lost at
+*              the sample rates and clock dividers of the low-power mode,
+*              that the loss counters report an overloaded CPU, and that the
+*              current estimate of the firmware agrees with the emulation. It
+*              prints the current table of the README.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include <string.h>
+#include <inttypes.h>
+#include "test_common.h"
+#include "lowpower_acq.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Blocks emulated per sample rate */
+#define SIM_BLOCKS (16u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Outcome of an emulated acquisition */
+typedef struct
+{
+    uint32_t samples;       /* Conversions triggered */
+    uint32_t blocks;        /* Blocks processed */
+    uint32_t overruns;      /* Results dropped, every block was full */
+    uint32_t late;          /* Triggers that found the CPU still in the previous handler */
+    uint32_t errors;        /* Processed blocks not holding the expected results */
+    uint64_t activeNs;      /* Time the CPU was running */
+    uint64_t sleepNs;       /* Time the CPU was sleeping */
+    uint32_t averageUa;     /* Average current */
+} lowpower_sim_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Costs and currents of g_lowpowerCost in main.c, at a 320 MHz CPU clock */
+static const lowpower_cost_t COST =
+{
+    .cpuClockHz = 320000000u,
+    .sampleCycles = 400u,
+    .blockCycles = 40000u,
+    .wakeupNs = 1000u,
+    .conversionNs = 2000u,
+    .staticUa = 20000u,
+    .activeUaPerMhz = 150u,
+    .sleepUaPerMhz = 50u,
+    .sarUa = 3000u
+};
+
+/* Sample rates of LOWPOWER_RATES_HZ in main.c, and the dividers of the README table */
+static const uint32_t RATES_HZ[] = { 100u, 1000u, 10000u, 100000u };
+static const uint32_t DIVIDERS[] = { 8u, 8u, 8u, 2u };
+
+/*******************************************************************************
+* Function Name: cycles_to_ns
+********************************************************************************
+* Summary:
+*  Converts CPU cycles at clockHz into nanoseconds, rounded up.
+*
+*******************************************************************************/
+static uint64_t cycles_to_ns(uint32_t cycles, uint32_t clockHz)
+{
+    return (((uint64_t)cycles * 1000000000u) + clockHz - 1u) / clockHz;
+}
+
+/*******************************************************************************
+* Function Name: simulate
+********************************************************************************
+* Summary:
+*  Emulates durationMs of the acquisition at rateHz with the CPU clock
+*  divided by divider, using the block buffer functions of the firmware:
+*  - a timer triggers a conversion every 1/rateHz; the interrupt handler
+*    stores the previous result with lowpower_acq_add() and starts the next
+*    conversion
+*  - when the main loop has no complete block, the CPU sleeps until the next
+*    interrupt and pays the wake-up time
+*  - a complete block is processed by the main loop in blockCycles, and the
+*    interrupt handler preempts the processing
+*  The results are a running count, so that every processed block can be
+*  checked for missing or repeated results. The average current is the
+*  time-weighted current of the running and sleeping CPU plus the SAR ADC
+*  during the conversions.
+*
+*******************************************************************************/
+static void simulate(const lowpower_cost_t *cost, uint32_t rateHz, uint32_t divider, uint32_t durationMs,
+                     lowpower_sim_t *sim)
+{
+    static lowpower_acq_t acq;
+    uint32_t clockHz = cost->cpuClockHz / divider;
+    uint64_t periodNs = 1000000000u / rateHz;
+    uint64_t sampleNs = cycles_to_ns(cost->sampleCycles, clockHz);
+    uint64_t blockNs = cycles_to_ns(cost->blockCycles, clockHz);
+    uint64_t endNs = (uint64_t)durationMs * 1000000u;
+    uint64_t t = 0u;
+    uint64_t trigger;
+    uint64_t busyNs = 0u;
+    uint64_t charge;
+    const uint16_t *block = NULL;
+    uint16_t result = 0u;
+    bool asleep = false;
+    uint32_t i;
+
+    memset(sim, 0, sizeof(*sim));
+    lowpower_acq_reset(&acq);
+
+    for (trigger = periodNs; trigger <= endNs; trigger += periodNs)
+    {
+        /* Main loop up to the interrupt: process the complete blocks, then sleep */
+        asleep = false;
+        while (t < trigger)
+        {
+            uint64_t step;
+
+            if (block == NULL)
+            {
+                block = lowpower_acq_block(&acq);
+                busyNs = blockNs;
+            }
+
+            if (block == NULL)
+            {
+                sim->sleepNs += trigger - t;
+                t = trigger;
+                asleep = true;
+                break;
+            }
+
+            step = ((trigger - t) < busyNs) ? (trigger - t) : busyNs;
+            busyNs -= step;
+            t += step;
+            sim->activeNs += step;
+
+            if (busyNs == 0u)
+            {
+                for (i = 1u; i < LOWPOWER_BLOCK_SAMPLES; i++)
+                {
+                    if (block[i] != (uint16_t)(block[i - 1u] + 1u))
+                    {
+                        sim->errors++;
+                        break;
+                    }
+                }
+                lowpower_acq_release(&acq);
+                sim->blocks++;
+                block = NULL;
+            }
+        }
+
+        /* Interrupt handler, delayed if the previous one is still running */
+        if (t > trigger)
+        {
+            sim->late++;
+        }
+        else if (asleep)
+        {
+            t += cost->wakeupNs;
+            sim->activeNs += cost->wakeupNs;
+        }
+
+        (void)lowpower_acq_add(&acq, result++);
+        sim->samples++;
+        t += sampleNs;
+        sim->activeNs += sampleNs;
+    }
+
+    sim->overruns = acq.overruns;
+
+    /* Charge in uA * ns */
+    charge = (sim->activeNs * (cost->staticUa + (((uint64_t)cost->activeUaPerMhz * clockHz) / 1000000u))) +
+             (sim->sleepNs * (cost->staticUa + (((uint64_t)cost->sleepUaPerMhz * clockHz) / 1000000u))) +
+             ((uint64_t)sim->samples * cost->conversionNs * cost->sarUa);
+    sim->averageUa = ((sim->activeNs + sim->sleepNs) != 0u) ?
+                     (uint32_t)(charge / (sim->activeNs + sim->sleepNs)) : 0u;
+}
+
+/*******************************************************************************
+* Function Name: duration_ms
+********************************************************************************
+* Summary:
+*  Returns the time SIM_BLOCKS blocks take at rateHz, in ms.
+*
+*******************************************************************************/
+static uint32_t duration_ms(uint32_t rateHz)
+{
+    return ((SIM_BLOCKS * LOWPOWER_BLOCK_SAMPLES * 1000u) / rateHz) + 1u;
+}
+
+/*******************************************************************************
+* Function Name: test_buffers
+********************************************************************************
+* Summary:
+*  Checks the block buffers: a block is handed over when it is complete and
+*  in the order it was filled, and results that find every block full are
+*  dropped and counted.
+*
+*******************************************************************************/
+static void test_buffers(void)
+{
+    static lowpower_acq_t acq;
+    const uint16_t *block;
+    uint32_t completed = 0u;
+    uint32_t i;
+
+    lowpower_acq_reset(&acq);
+    TEST_CHECK(lowpower_acq_block(&acq) == NULL);
+
+    for (i = 0u; i < ((LOWPOWER_BLOCK_NUM * LOWPOWER_BLOCK_SAMPLES) + 3u); i++)
+    {
+        completed += lowpower_acq_add(&acq, (uint16_t)i) ? 1u : 0u;
+    }
+
+    TEST_CHECK(completed == LOWPOWER_BLOCK_NUM);
+    TEST_CHECK(acq.overruns == 3u);
+
+    block = lowpower_acq_block(&acq);
+    TEST_CHECK((block != NULL) && (block[0] == 0u) && (block[LOWPOWER_BLOCK_SAMPLES - 1u] == (LOWPOWER_BLOCK_SAMPLES - 1u)));
+    lowpower_acq_release(&acq);
+
+    /* The released block is refilled, the next one is the second */
+    TEST_CHECK(!lowpower_acq_add(&acq, 0xFFFu));
+    TEST_CHECK(acq.overruns == 3u);
+    block = lowpower_acq_block(&acq);
+    TEST_CHECK((block != NULL) && (block[0] == LOWPOWER_BLOCK_SAMPLES));
+    lowpower_acq_release(&acq);
+    TEST_CHECK(lowpower_acq_block(&acq) == NULL);
+
+    acq.late = 1u;
+    lowpower_acq_reset(&acq);
+    TEST_CHECK((acq.overruns == 0u) && (acq.late == 0u) && (acq.count == 0u));
+}
+
+/*******************************************************************************
+* Function Name: test_rates
+********************************************************************************
+* Summary:
+*  Emulates every sample rate of the low-power mode at the divider selected
+*  by lowpower_select_divider(): no result may be lost or late, and
+*  lowpower_estimate() must not be below the emulation, and above it by no
+*  more than 1% of the current and 5% of the CPU time. Prints one row of the current table of the
+*  README per rate, with the estimates at the full and the divided clock.
+*
+*******************************************************************************/
+static void test_rates(void)
+{
+    uint32_t i;
+
+    printf("Sample rate | Divider | CPU running, full clock | Average current, full clock | "
+           "CPU running, divided | Average current, divided\r\n");
+
+    for (i = 0u; i < (sizeof(RATES_HZ) / sizeof(RATES_HZ[0])); i++)
+    {
+        uint32_t divider = lowpower_select_divider(&COST, RATES_HZ[i]);
+        lowpower_estimate_t full;
+        lowpower_estimate_t divided;
+        lowpower_sim_t sim;
+        uint64_t simPpm;
+
+        TEST_CHECK(divider == DIVIDERS[i]);
+
+        simulate(&COST, RATES_HZ[i], divider, duration_ms(RATES_HZ[i]), &sim);
+        TEST_CHECK(sim.blocks >= (SIM_BLOCKS - 1u));
+        TEST_CHECK(sim.overruns == 0u);
+        TEST_CHECK(sim.late == 0u);
+        TEST_CHECK(sim.errors == 0u);
+
+        lowpower_estimate(&COST, RATES_HZ[i], 1u, &full);
+        lowpower_estimate(&COST, RATES_HZ[i], divider, &divided);
+
+        simPpm = (sim.activeNs * 1000000u) / (sim.activeNs + sim.sleepNs);
+        /* The estimate pays the wake-up for every result, also those that interrupt a block processing */
+        TEST_CHECK((divided.activePpm >= simPpm) && ((divided.activePpm * 100u) <= (simPpm * 105u)));
+        TEST_CHECK((divided.averageUa >= sim.averageUa) && ((divided.averageUa * 100u) <= (sim.averageUa * 101u)));
+
+        printf("%" PRIu32 " %s | %" PRIu32 " | %" PRIu32 ".%" PRIu32 "%% | %" PRIu32 " uA | %" PRIu32 ".%" PRIu32
+               "%% | %" PRIu32 " uA\r\n",
+               (RATES_HZ[i] < 1000u) ? RATES_HZ[i] : (RATES_HZ[i] / 1000u), (RATES_HZ[i] < 1000u) ? "Hz" : "kHz",
+               divider, full.activePpm / 10000u, (full.activePpm / 1000u) % 10u, full.averageUa,
+               divided.activePpm / 10000u, (divided.activePpm / 1000u) % 10u, divided.averageUa);
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_overload
+********************************************************************************
+* Summary:
+*  Checks that the loss counters report an overloaded CPU: 100 kHz at a
+*  divider of 8, where every interrupt handler runs into the next sample
+*  period and no block gets processed, and a block processing time longer
+*  than a block at 10 kHz, where the handlers keep up but both blocks fill.
+*  The results are then dropped between blocks, each block stays whole.
+*  A rate beyond the CPU at the full clock gets no divider.
+*
+*******************************************************************************/
+static void test_overload(void)
+{
+    lowpower_cost_t slowBlocks = COST;
+    lowpower_sim_t sim;
+
+    simulate(&COST, 100000u, 8u, duration_ms(100000u), &sim);
+    TEST_CHECK(sim.late > 0u);
+    TEST_CHECK(sim.overruns > 0u);
+
+    /* 30 ms per block, filled in 25.6 ms */
+    slowBlocks.blockCycles = 9600000u;
+    simulate(&slowBlocks, 10000u, 1u, duration_ms(10000u), &sim);
+    TEST_CHECK(sim.late == 0u);
+    TEST_CHECK(sim.overruns > 0u);
+    TEST_CHECK(sim.errors == 0u);
+    TEST_CHECK(lowpower_select_divider(&slowBlocks, 10000u) == 0u);
+
+    TEST_CHECK(lowpower_select_divider(&COST, 1000000u) == 0u);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the low-power acquisition tests.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_buffers();
+    test_rates();
+    test_overload();
+
+    return TEST_REPORT("test_lowpower");
+}
+/* [] END OF FILE */
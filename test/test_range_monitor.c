@@ -0,0 +1,179 @@
+/******************************************************************************
+* File Name:   test_range_monitor.c
+*
+* Description: This file contains the host test of the range monitor: the hysteresis
+*              of the window, and the range interrupt sequence of range event mode,
+*              emulated with the SAR2 range detection model, against the monitor
+*              updated in software with every result.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "test_common.h"
+#include "range_monitor.h"
+#include "sar2_model.h"
+#include "signal_source.h"
+#include "adc_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of results per signal, window and output format */
+#define TEST_RESULTS    (100000u)
+
+/* Average count of the results */
+#define TEST_AVERAGE    (4u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Windows: the AN0 window, open to either end, the full range, and narrow ones */
+static const range_window_t WINDOWS[] =
+{
+    { 0x400u, 0xC00u, 0x40u },
+    { 0x000u, 0x800u, 0x10u },
+    { 0x800u, 0xFFFu, 0x10u },
+    { 0x000u, 0xFFFu, 0x00u },
+    { 100u, 200u, 50u },
+    { 0x7F0u, 0x810u, 0x00u },
+};
+
+/*******************************************************************************
+* Function Name: test_hysteresis
+********************************************************************************
+* Summary:
+*  Checks the events of the AN0 window at its edges: leaving at the edges,
+*  re-entering only past the hysteresis.
+*
+*******************************************************************************/
+static void test_hysteresis(void)
+{
+    range_monitor_t mon;
+
+    range_monitor_init(&mon, &WINDOWS[0]);
+
+    TEST_CHECK(!range_monitor_update(&mon, 0x400u));
+    TEST_CHECK(!range_monitor_update(&mon, 0xC00u));
+    TEST_CHECK(range_monitor_update(&mon, 0x3FFu));
+    TEST_CHECK(!mon.inside);
+    TEST_CHECK(!range_monitor_update(&mon, 0x43Fu));
+    TEST_CHECK(range_monitor_update(&mon, 0x440u));
+    TEST_CHECK(mon.inside);
+    TEST_CHECK(range_monitor_update(&mon, 0xC01u));
+    TEST_CHECK(!range_monitor_update(&mon, 0xBC1u));
+    TEST_CHECK(range_monitor_update(&mon, 0xBC0u));
+    TEST_CHECK(mon.events == 4u);
+}
+
+/*******************************************************************************
+* Function Name: test_emulated_irq
+********************************************************************************
+* Summary:
+*  Emulates range event mode as handle_range_IRQ() runs it: the monitor is
+*  updated only for results that meet the range detection setting, which is
+*  set up again after each event. The events must match a monitor updated
+*  with every result, and every emulated interrupt must be an event.
+*
+*******************************************************************************/
+static void test_emulated_irq(void)
+{
+    signal_source_t src;
+    range_monitor_t hw;
+    range_monitor_t sw;
+    range_detect_t detect;
+    int32_t type;
+    int32_t format;
+    uint32_t window;
+    uint32_t irqs;
+    uint32_t i;
+
+    for (type = 0; type < SIGNAL_TYPE_NUM; type++)
+    {
+        for (window = 0u; window < (sizeof(WINDOWS) / sizeof(WINDOWS[0])); window++)
+        {
+            for (format = 0; format < FORMAT_NUM; format++)
+            {
+                bool same = true;
+
+                signal_source_init(&src, type, 123u);
+                range_monitor_init(&hw, &WINDOWS[window]);
+                range_monitor_init(&sw, &WINDOWS[window]);
+                range_monitor_detect(&hw, format, &detect);
+                irqs = 0u;
+
+                for (i = 0u; i < TEST_RESULTS; i++)
+                {
+                    uint16_t result = signal_source_next_result(&src, TEST_AVERAGE,
+                                                                sar2_model_right_shift(TEST_AVERAGE), format);
+                    uint16_t decoded = adc_result_decode(result, format);
+                    bool swEvent = range_monitor_update(&sw, decoded);
+                    bool hwEvent = false;
+
+                    if (sar2_model_range_hit(result, detect.mode, detect.lo, detect.hi, format))
+                    {
+                        irqs++;
+                        hwEvent = range_monitor_update(&hw, decoded);
+                        if (hwEvent)
+                        {
+                            range_monitor_detect(&hw, format, &detect);
+                        }
+                    }
+
+                    same = same && (hwEvent == swEvent) && (hw.inside == sw.inside);
+                }
+
+                TEST_CHECK(same);
+                TEST_CHECK(irqs == hw.events);
+                TEST_CHECK(hw.events == sw.events);
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the checks of the range monitor.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_hysteresis();
+    test_emulated_irq();
+
+    return TEST_REPORT("test_range_monitor");
+}
+/* [] END OF FILE */
@@ -0,0 +1,204 @@
+/******************************************************************************
+* File Name:   test_replay.c
+*
+* Description: This file contains the host golden-output regression of the capture
+*              replay. Every capture of the built-in corpus is re-encoded into each
+*              output format like replay_capture() does and processed with the
+*              device independent part of process_conversion(). The millivolt
+*              results must not depend on the output format and must match the
+*              recorded golden checksums.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include <string.h>
+#include "test_common.h"
+#include "replay.h"
+#include "adc_result.h"
+#include "sar2_model.h"
+#include "stream_frame.h"
+#include "cycle_probe.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of replays of the whole corpus timed by bench_replay() */
+#define BENCH_REPLAYS   (2000u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Expected output of one capture of the corpus */
+typedef struct
+{
+    const char *name;
+    uint16_t minMv;
+    uint16_t maxMv;
+    uint16_t crc;       /* stream_frame_crc16() of the millivolt values, little endian */
+} replay_golden_t;
+
+/* Output of one replay */
+typedef struct
+{
+    adc_stats_t stats;
+    uint16_t crc;
+} replay_output_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const replay_golden_t GOLDEN[] =
+{
+    { "ramp",  0u,    3299u, 0x642Cu },
+    { "sine",  199u,  3103u, 0xC8A3u },
+    { "noise", 1627u, 1674u, 0x3656u }
+};
+
+/*******************************************************************************
+* Function Name: replay
+********************************************************************************
+* Summary:
+*  Replays a capture in an output format: each record is re-encoded with the
+*  SAR2 result model as replay_capture() does, decoded and converted to
+*  millivolt as process_conversion() does.
+*
+*******************************************************************************/
+static void replay(const replay_capture_t *capture, int32_t outputFormat, replay_output_t *out)
+{
+    uint8_t mv[2u * REPLAY_CAPTURE_SAMPLES];
+    uint32_t i;
+
+    adc_stats_reset(&out->stats);
+
+    for (i = 0u; i < capture->count; i++)
+    {
+        uint16_t raw = adc_result_decode(capture->records[i].resultAN0_raw, capture->outputFormat);
+        uint16_t resultAN0;
+        uint32_t voltageMv;
+
+        raw = sar2_model_format(raw, outputFormat);
+        resultAN0 = adc_result_decode(raw, outputFormat);
+        voltageMv = adc_result_to_mv(resultAN0, capture->records[i].resultVBG);
+
+        adc_stats_add(&out->stats, (uint16_t)voltageMv);
+        mv[2u * i] = (uint8_t)voltageMv;
+        mv[(2u * i) + 1u] = (uint8_t)(voltageMv >> 8);
+    }
+
+    out->crc = stream_frame_crc16(mv, 2u * capture->count);
+}
+
+/*******************************************************************************
+* Function Name: test_corpus
+********************************************************************************
+* Summary:
+*  Checks the shape of the corpus and the replay output of every capture in
+*  every output format against the golden values.
+*
+*******************************************************************************/
+static void test_corpus(void)
+{
+    replay_output_t out;
+    uint32_t c;
+    int32_t format;
+
+    TEST_CHECK(REPLAY_CORPUS_NUM == (sizeof(GOLDEN) / sizeof(GOLDEN[0])));
+
+    for (c = 0u; c < REPLAY_CORPUS_NUM; c++)
+    {
+        const replay_capture_t *capture = &REPLAY_CORPUS[c];
+
+        TEST_CHECK(strcmp(capture->name, GOLDEN[c].name) == 0);
+        TEST_CHECK(capture->count == REPLAY_CAPTURE_SAMPLES);
+        TEST_CHECK((capture->outputFormat >= 0) && (capture->outputFormat < FORMAT_NUM));
+        TEST_CHECK(sar2_model_right_shift((uint32_t)capture->averageCount) <= 8u);
+
+        for (format = 0; format < FORMAT_NUM; format++)
+        {
+            replay(capture, format, &out);
+
+            TEST_CHECK(out.stats.count == capture->count);
+            TEST_CHECK(out.stats.min == GOLDEN[c].minMv);
+            TEST_CHECK(out.stats.max == GOLDEN[c].maxMv);
+            TEST_CHECK(out.crc == GOLDEN[c].crc);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_replay
+********************************************************************************
+* Summary:
+*  Times the replay of the whole corpus and prints the records per second.
+*
+*******************************************************************************/
+static void bench_replay(void)
+{
+    replay_output_t out;
+    uint32_t records = 0u;
+    uint32_t start;
+    uint32_t elapsedNs;
+    uint32_t i;
+    uint32_t c;
+
+    start = cycle_probe_now();
+    for (i = 0u; i < BENCH_REPLAYS; i++)
+    {
+        for (c = 0u; c < REPLAY_CORPUS_NUM; c++)
+        {
+            replay(&REPLAY_CORPUS[c], (int32_t)(i % FORMAT_NUM), &out);
+            records += REPLAY_CORPUS[c].count;
+        }
+    }
+    elapsedNs = cycle_probe_elapsed(start);
+
+    printf("replay: %.1f M records/s\r\n", (double)records * 1000.0 / (double)elapsedNs);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the golden-output regression and the timing of the replay.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_corpus();
+    bench_replay();
+
+    return TEST_REPORT("test_replay");
+}
+/* [] END OF FILE */
@@ -0,0 +1,402 @@
+/******************************************************************************
+* File Name:   test_sample_ring.c
+*
+* Description: This file contains the host test of the sample ring: the
+*              full and empty states across a wrap around of the indexes,
+*              and a producer and a consumer thread, first without loss when
+*              the producer waits for room, then with a full ring, where the
+*              dropped samples must match the gaps the consumer sees.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+#include "test_common.h"
+#include "sample_ring.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Samples pushed by the producer thread in the lossless and the overflow test */
+#define LOSSLESS_SAMPLES    (1000000u)
+#define OVERFLOW_SAMPLES    (200000u)
+
+/* In the overflow test, the producer sleeps for PACE_SLEEP_US after every
+ * PRODUCER_BURST samples, like an interrupt handler that runs at a fixed
+ * rate, and the consumer after every CONSUMER_BATCH samples, so that the
+ * ring runs full again and again */
+#define PRODUCER_BURST      (200u)
+#define CONSUMER_BATCH      (100u)
+#define PACE_SLEEP_US       (100u)
+
+/* Index start close to the wrap around of the 32-bit indexes */
+#define WRAP_START          (0xFFFFFFFFu - (SAMPLE_RING_SIZE / 2u))
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* State shared by the producer and the consumer thread */
+typedef struct
+{
+    sample_ring_t ring;
+    uint32_t samples;
+    bool waitForRoom;       /* Producer retries a push on a full ring instead of dropping */
+    bool paced;             /* Both threads sleep between their batches */
+    volatile uint32_t done; /* Set by the producer after the last push */
+
+    /* Producer: drops and runs of consecutive drops, like the stream ring counters */
+    uint32_t drops;
+    uint32_t dropGaps;
+
+    /* Consumer */
+    uint32_t received;
+    uint32_t missing;       /* Sequence numbers skipped */
+    uint32_t gaps;          /* Runs of skipped sequence numbers */
+    uint32_t outOfOrder;
+    uint32_t corrupt;
+} ring_test_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static ring_test_t g_test;
+
+/*******************************************************************************
+* Function Name: make_sample
+********************************************************************************
+* Summary:
+*  Fills every field of a sample from its sequence number, so that a sample
+*  read while it is written shows up as an inconsistent one.
+*
+*******************************************************************************/
+static void make_sample(uint32_t seq, adc_sample_t *sample)
+{
+    sample->resultAN0 = (uint16_t)seq;
+    sample->resultVBG = (uint16_t)~seq;
+    sample->timestamp = seq;
+    sample->averageCount = (uint16_t)(seq >> 16);
+    sample->outputFormat = (uint8_t)(seq * 31u);
+}
+
+/*******************************************************************************
+* Function Name: sample_ok
+********************************************************************************
+* Summary:
+*  Tells whether all fields of a sample match its sequence number.
+*
+*******************************************************************************/
+static bool sample_ok(const adc_sample_t *sample)
+{
+    adc_sample_t expected;
+
+    make_sample(sample->timestamp, &expected);
+
+    return (sample->resultAN0 == expected.resultAN0) && (sample->resultVBG == expected.resultVBG) &&
+           (sample->averageCount == expected.averageCount) && (sample->outputFormat == expected.outputFormat);
+}
+
+/*******************************************************************************
+* Function Name: sleep_us
+********************************************************************************
+* Summary:
+*  Waits for a number of microseconds.
+*
+*******************************************************************************/
+static void sleep_us(uint32_t us)
+{
+    const struct timespec wait = { (time_t)(us / 1000000u), (long)(us % 1000000u) * 1000L };
+
+    (void)nanosleep(&wait, NULL);
+}
+
+/*******************************************************************************
+* Function Name: test_full_empty
+********************************************************************************
+* Summary:
+*  Fills the ring to SAMPLE_RING_SIZE entries and empties it again twice,
+*  with the indexes passing their wrap around: the push after the last free
+*  entry and the pop from the empty ring fail, and the samples come out in
+*  order.
+*
+*******************************************************************************/
+static void test_full_empty(void)
+{
+    sample_ring_t *ring = &g_test.ring;
+    adc_sample_t sample;
+    uint32_t seq = 0u;
+    uint32_t next = 0u;
+    uint32_t round;
+    uint32_t i;
+
+    sample_ring_reset(ring);
+    TEST_CHECK(!sample_ring_pop(ring, &sample));
+
+    ring->head = WRAP_START;
+    ring->tail = WRAP_START;
+
+    for (round = 0u; round < 2u; round++)
+    {
+        for (i = 0u; i < SAMPLE_RING_SIZE; i++)
+        {
+            make_sample(seq++, &sample);
+            TEST_CHECK(sample_ring_push(ring, &sample));
+        }
+
+        make_sample(seq, &sample);
+        TEST_CHECK(!sample_ring_push(ring, &sample));
+
+        for (i = 0u; i < SAMPLE_RING_SIZE; i++)
+        {
+            TEST_CHECK(sample_ring_pop(ring, &sample));
+            TEST_CHECK((sample.timestamp == next++) && sample_ok(&sample));
+        }
+
+        TEST_CHECK(!sample_ring_pop(ring, &sample));
+    }
+
+    TEST_CHECK(ring->head == (WRAP_START + (2u * SAMPLE_RING_SIZE)));
+    TEST_CHECK(ring->head < WRAP_START);
+}
+
+/*******************************************************************************
+* Function Name: producer
+********************************************************************************
+* Summary:
+*  Producer thread: pushes the samples with rising sequence numbers. On a
+*  full ring, it either yields and retries, or drops the sample and counts
+*  it like the interrupt handler does.
+*
+*******************************************************************************/
+static void *producer(void *arg)
+{
+    ring_test_t *t = (ring_test_t *)arg;
+    adc_sample_t sample;
+    bool dropping = false;
+    bool pushed;
+    uint32_t seq;
+
+    for (seq = 0u; seq < t->samples; seq++)
+    {
+        if (t->paced && ((seq % PRODUCER_BURST) == 0u))
+        {
+            sleep_us(PACE_SLEEP_US);
+        }
+
+        make_sample(seq, &sample);
+
+        while (!(pushed = sample_ring_push(&t->ring, &sample)) && t->waitForRoom)
+        {
+            (void)sched_yield();
+        }
+
+        if (pushed)
+        {
+            dropping = false;
+        }
+        else
+        {
+            t->drops++;
+            t->dropGaps += dropping ? 0u : 1u;
+            dropping = true;
+        }
+    }
+
+    __atomic_store_n(&t->done, 1u, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: consumer
+********************************************************************************
+* Summary:
+*  Consumer thread: pops until the producer is done and the ring is empty,
+*  and checks the order and the contents of the samples and the gaps in the
+*  sequence numbers.
+*
+*******************************************************************************/
+static void *consumer(void *arg)
+{
+    ring_test_t *t = (ring_test_t *)arg;
+    adc_sample_t sample;
+    uint32_t next = 0u;
+
+    for (;;)
+    {
+        uint32_t done = __atomic_load_n(&t->done, __ATOMIC_ACQUIRE);
+
+        if (!sample_ring_pop(&t->ring, &sample))
+        {
+            /* The ring was empty after the last push */
+            if (done != 0u)
+            {
+                break;
+            }
+            (void)sched_yield();
+            continue;
+        }
+
+        t->corrupt += sample_ok(&sample) ? 0u : 1u;
+
+        if (sample.timestamp < next)
+        {
+            t->outOfOrder++;
+        }
+        else
+        {
+            if (sample.timestamp > next)
+            {
+                t->missing += sample.timestamp - next;
+                t->gaps++;
+            }
+            next = sample.timestamp + 1u;
+        }
+
+        t->received++;
+        if (t->paced && ((t->received % CONSUMER_BATCH) == 0u))
+        {
+            sleep_us(PACE_SLEEP_US);
+        }
+    }
+
+    /* Samples dropped at the end leave no later sample to show the gap */
+    if (next < t->samples)
+    {
+        t->missing += t->samples - next;
+        t->gaps++;
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: run_threads
+********************************************************************************
+* Summary:
+*  Runs the producer and the consumer thread on a reset ring until both are
+*  done.
+*
+*******************************************************************************/
+static void run_threads(uint32_t samples, bool waitForRoom, bool paced)
+{
+    pthread_t producerThread;
+    pthread_t consumerThread;
+    bool started;
+
+    memset(&g_test, 0, sizeof(g_test));
+    sample_ring_reset(&g_test.ring);
+    g_test.samples = samples;
+    g_test.waitForRoom = waitForRoom;
+    g_test.paced = paced;
+
+    started = (pthread_create(&consumerThread, NULL, &consumer, &g_test) == 0);
+    TEST_CHECK(started);
+    if (!started)
+    {
+        return;
+    }
+    TEST_CHECK(pthread_create(&producerThread, NULL, &producer, &g_test) == 0);
+
+    (void)pthread_join(producerThread, NULL);
+    (void)pthread_join(consumerThread, NULL);
+}
+
+/*******************************************************************************
+* Function Name: test_lossless
+********************************************************************************
+* Summary:
+*  The producer waits for room: every sample arrives once, in order and
+*  intact, and the ring ends empty.
+*
+*******************************************************************************/
+static void test_lossless(void)
+{
+    run_threads(LOSSLESS_SAMPLES, true, false);
+
+    TEST_CHECK(g_test.received == LOSSLESS_SAMPLES);
+    TEST_CHECK(g_test.drops == 0u);
+    TEST_CHECK(g_test.missing == 0u);
+    TEST_CHECK(g_test.outOfOrder == 0u);
+    TEST_CHECK(g_test.corrupt == 0u);
+    TEST_CHECK(g_test.ring.head == g_test.ring.tail);
+}
+
+/*******************************************************************************
+* Function Name: test_overflow
+********************************************************************************
+* Summary:
+*  The consumer takes half as many samples per pause as the producer
+*  pushes, and the producer drops samples on a full ring: the samples that
+*  arrive are in order and intact, the samples the consumer misses are
+*  exactly the dropped ones, and the runs of drops match the gaps.
+*
+*******************************************************************************/
+static void test_overflow(void)
+{
+    run_threads(OVERFLOW_SAMPLES, false, true);
+
+    TEST_CHECK(g_test.drops > 0u);
+    TEST_CHECK(g_test.dropGaps > 10u);
+    TEST_CHECK((g_test.received + g_test.drops) == OVERFLOW_SAMPLES);
+    TEST_CHECK(g_test.missing == g_test.drops);
+    TEST_CHECK(g_test.gaps == g_test.dropGaps);
+    TEST_CHECK(g_test.outOfOrder == 0u);
+    TEST_CHECK(g_test.corrupt == 0u);
+    TEST_CHECK(g_test.ring.head == g_test.ring.tail);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the tests of the sample ring.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_full_empty();
+    test_lossless();
+    test_overflow();
+
+    return TEST_REPORT("test_sample_ring");
+}
+/* [] END OF FILE */
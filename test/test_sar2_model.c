@@ -0,0 +1,191 @@
+/******************************************************************************
+* File Name:   test_sar2_model.c
+*
+* Description: This file contains the host test of the SAR2 result model: the right
+*              shift of each average count, the output format encoding against the
+*              decoding in adc_result.c, the averaged result, and the range detection
+*              conditions.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "test_common.h"
+#include "sar2_model.h"
+#include "adc_result.h"
+
+/*******************************************************************************
+* Function Name: test_right_shift
+********************************************************************************
+* Summary:
+*  Checks that the right shift of every average count divides the sum of the
+*  conversions by the average count.
+*
+*******************************************************************************/
+static void test_right_shift(void)
+{
+    uint32_t averageCount;
+    uint8_t expected = 0u;
+
+    for (averageCount = 1u; averageCount <= SAR2_MODEL_AVERAGE_MAX; averageCount *= 2u)
+    {
+        TEST_CHECK(sar2_model_right_shift(averageCount) == expected);
+        expected++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_format
+********************************************************************************
+* Summary:
+*  Checks the register values of the output formats at the ends and the middle
+*  of the range, and that adc_result_decode() restores every 12-bit code.
+*
+*******************************************************************************/
+static void test_format(void)
+{
+    uint32_t code;
+    int32_t format;
+
+    TEST_CHECK(sar2_model_format(0x000u, UNSIGNED_RIGHT_ALIGNED) == 0x0000u);
+    TEST_CHECK(sar2_model_format(0xFFFu, UNSIGNED_RIGHT_ALIGNED) == 0x0FFFu);
+    TEST_CHECK(sar2_model_format(0x000u, SIGNED_RIGHT_ALIGNED) == 0xF800u);
+    TEST_CHECK(sar2_model_format(0x800u, SIGNED_RIGHT_ALIGNED) == 0x0000u);
+    TEST_CHECK(sar2_model_format(0xFFFu, SIGNED_RIGHT_ALIGNED) == 0x07FFu);
+    TEST_CHECK(sar2_model_format(0x001u, LEFT_ALIGNED) == 0x0010u);
+    TEST_CHECK(sar2_model_format(0xFFFu, LEFT_ALIGNED) == 0xFFF0u);
+
+    for (code = 0u; code <= SAR2_MODEL_CODE_MAX; code++)
+    {
+        for (format = 0; format < FORMAT_NUM; format++)
+        {
+            TEST_CHECK(adc_result_decode(sar2_model_format(code, format), format) == code);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_result
+********************************************************************************
+* Summary:
+*  Checks that sar2_model_result() returns the mean of the conversions for
+*  every average count: constant codes give the code itself, and a ramp of
+*  codes gives its truncated mean.
+*
+*******************************************************************************/
+static void test_result(void)
+{
+    uint16_t codes[SAR2_MODEL_AVERAGE_MAX];
+    uint32_t averageCount;
+    uint32_t i;
+
+    for (averageCount = 1u; averageCount <= SAR2_MODEL_AVERAGE_MAX; averageCount *= 2u)
+    {
+        uint8_t shift = sar2_model_right_shift(averageCount);
+        uint32_t sum = 0u;
+
+        for (i = 0u; i < averageCount; i++)
+        {
+            codes[i] = (uint16_t)SAR2_MODEL_CODE_MAX;
+        }
+        TEST_CHECK(sar2_model_result(codes, averageCount, shift, UNSIGNED_RIGHT_ALIGNED) == SAR2_MODEL_CODE_MAX);
+        TEST_CHECK(sar2_model_result(codes, averageCount, shift, LEFT_ALIGNED) == 0xFFF0u);
+
+        for (i = 0u; i < averageCount; i++)
+        {
+            codes[i] = (uint16_t)(1000u + (7u * i));
+            sum += codes[i];
+        }
+        TEST_CHECK(sar2_model_result(codes, averageCount, shift, UNSIGNED_RIGHT_ALIGNED) == (sum / averageCount));
+        TEST_CHECK(sar2_model_result(codes, averageCount, shift, SIGNED_RIGHT_ALIGNED) ==
+                   (uint16_t)((int32_t)(sum / averageCount) - 0x800));
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_range_hit
+********************************************************************************
+* Summary:
+*  Checks the four range detection conditions at the thresholds, with the
+*  thresholds compared as unsigned numbers in the unsigned formats and as
+*  signed numbers in the signed format.
+*
+*******************************************************************************/
+static void test_range_hit(void)
+{
+    uint32_t code;
+    int32_t format;
+    const uint32_t lo = 0x400u;
+    const uint32_t hi = 0xC00u;
+
+    for (format = 0; format < FORMAT_NUM; format++)
+    {
+        uint16_t loReg = sar2_model_format(lo, format);
+        uint16_t hiReg = sar2_model_format(hi, format);
+
+        for (code = 0u; code <= SAR2_MODEL_CODE_MAX; code++)
+        {
+            uint16_t result = sar2_model_format(code, format);
+            bool below = (code < lo);
+            bool above = (code >= hi);
+
+            TEST_CHECK(sar2_model_range_hit(result, SAR2_RANGE_BELOW_LO, loReg, hiReg, format) == below);
+            TEST_CHECK(sar2_model_range_hit(result, SAR2_RANGE_INSIDE_RANGE, loReg, hiReg, format) == (!below && !above));
+            TEST_CHECK(sar2_model_range_hit(result, SAR2_RANGE_ABOVE_HI, loReg, hiReg, format) == above);
+            TEST_CHECK(sar2_model_range_hit(result, SAR2_RANGE_OUTSIDE_RANGE, loReg, hiReg, format) == (below || above));
+        }
+    }
+
+    /* A negative result is below a positive threshold only when compared as signed */
+    TEST_CHECK(sar2_model_range_hit(0xF800u, SAR2_RANGE_BELOW_LO, 0x0001u, 0x0002u, SIGNED_RIGHT_ALIGNED));
+    TEST_CHECK(!sar2_model_range_hit(0xF800u, SAR2_RANGE_BELOW_LO, 0x0001u, 0x0002u, UNSIGNED_RIGHT_ALIGNED));
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the checks of the SAR2 result model.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_right_shift();
+    test_format();
+    test_result();
+    test_range_hit();
+
+    return TEST_REPORT("test_sar2_model");
+}
+/* [] END OF FILE */
@@ -0,0 +1,371 @@
+/******************************************************************************
+* File Name:   test_sar2_sched.c
+*
+* Description: This file contains the host test of the SAR2 group scheduling model.
+*              It checks single groups against their conversion time and reproduces
+*              the preemption example and the starvation case of the README.
+*              It checks that a critical group waits for at most one channel
+*              of the lower priority groups, and the priorities, preemption
+*              types, and feasibility given by sar2_sched_assign().
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "test_common.h"
+#include "sar2_sched.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Simulated time of the README example in SAR clock cycles */
+#define EXAMPLE_CYCLES      (1000000u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Expected outcome of the README example for one background preemption type */
+typedef struct
+{
+    uint8_t preemptionType;
+    uint32_t urgentLatencyMax;
+    uint32_t backgroundLatencyMean;
+    uint32_t backgroundLatencyMax;
+    uint32_t backgroundCancelled;
+} sched_expect_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Table "Background preemption type" of the README */
+static const sched_expect_t EXAMPLE_EXPECT[] =
+{
+    { SAR2_PREEMPTION_FINISH_RESUME, 164u, 548u, 566u,  0u },
+    { SAR2_PREEMPTION_ABORT_CANCEL,  30u,  537u, 566u,  268u },
+    { SAR2_PREEMPTION_ABORT_RESTART, 30u,  695u, 1101u, 0u },
+    { SAR2_PREEMPTION_ABORT_RESUME,  30u,  588u, 699u,  0u }
+};
+
+/*******************************************************************************
+* Function Name: run_example
+********************************************************************************
+* Summary:
+*  Runs the README example: a 1-channel group of 30 cycles with priority 0 and
+*  the given trigger period, next to a 4-channel background group of 134
+*  cycles per channel with priority 3, triggered every 2000 cycles.
+*
+*******************************************************************************/
+static void run_example(uint8_t backgroundPreemption, uint32_t urgentPeriod, sar2_sched_stats_t *stats)
+{
+    const sar2_sched_group_t groups[2] =
+    {
+        { 0u, SAR2_PREEMPTION_FINISH_RESUME, 1u, 30u, urgentPeriod, 0u },
+        { 3u, backgroundPreemption, 4u, 134u, 2000u, 0u }
+    };
+
+    sar2_sched_run(groups, 2u, EXAMPLE_CYCLES, stats);
+}
+
+/*******************************************************************************
+* Function Name: test_single
+********************************************************************************
+* Summary:
+*  Checks that a group on its own completes in its conversion time, and that
+*  triggers arriving while it is still converting are counted as overflows.
+*
+*******************************************************************************/
+static void test_single(void)
+{
+    const sar2_sched_group_t relaxed = { 0u, SAR2_PREEMPTION_FINISH_RESUME, 2u, 100u, 1000u, 0u };
+    const sar2_sched_group_t busy = { 0u, SAR2_PREEMPTION_FINISH_RESUME, 2u, 100u, 150u, 0u };
+    sar2_sched_stats_t stats;
+
+    sar2_sched_run(&relaxed, 1u, 100000u, &stats);
+    TEST_CHECK(stats.triggers == 100u);
+    TEST_CHECK(stats.completed == 100u);
+    TEST_CHECK((stats.latencyMin == 200u) && (stats.latencyMax == 200u));
+    TEST_CHECK((stats.overflows == 0u) && (stats.preempted == 0u) && (stats.cancelled == 0u));
+
+    /* Every other trigger arrives while the previous group is still converting */
+    sar2_sched_run(&busy, 1u, 300000u, &stats);
+    TEST_CHECK(stats.triggers == 1000u);
+    TEST_CHECK(stats.overflows == 1000u);
+    TEST_CHECK(stats.latencyMax == 200u);
+}
+
+/*******************************************************************************
+* Function Name: test_example
+********************************************************************************
+* Summary:
+*  Checks the latencies and lost groups of the README example for every
+*  background preemption type.
+*
+*******************************************************************************/
+static void test_example(void)
+{
+    sar2_sched_stats_t stats[2];
+    uint32_t i;
+
+    for (i = 0u; i < (sizeof(EXAMPLE_EXPECT) / sizeof(EXAMPLE_EXPECT[0])); i++)
+    {
+        const sched_expect_t *expect = &EXAMPLE_EXPECT[i];
+
+        run_example(expect->preemptionType, 997u, stats);
+
+        /* The priority 0 group is never lost (only the last trigger may still be converting at the
+         * end of the simulation) and waits at most for one background channel */
+        TEST_CHECK((stats[0].overflows == 0u) && (stats[0].cancelled == 0u));
+        TEST_CHECK(stats[0].completed >= (stats[0].triggers - 1u));
+        TEST_CHECK(stats[0].latencyMin == 30u);
+        TEST_CHECK(stats[0].latencyMax == expect->urgentLatencyMax);
+
+        TEST_CHECK(stats[1].triggers == 500u);
+        TEST_CHECK(stats[1].cancelled == expect->backgroundCancelled);
+        TEST_CHECK(stats[1].completed == (500u - expect->backgroundCancelled));
+        TEST_CHECK((uint32_t)(stats[1].latencySum / stats[1].completed) == expect->backgroundLatencyMean);
+        TEST_CHECK(stats[1].latencyMax == expect->backgroundLatencyMax);
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_starvation
+********************************************************************************
+* Summary:
+*  Checks the README starvation case: with the priority 0 group triggered
+*  every 140 cycles, only 110 cycles are left between its conversions, less
+*  than one background channel. The groups that abort the channel never
+*  complete, the FINISH_RESUME group still does.
+*
+*******************************************************************************/
+static void test_starvation(void)
+{
+    sar2_sched_stats_t stats[2];
+
+    run_example(SAR2_PREEMPTION_ABORT_RESTART, 140u, stats);
+    TEST_CHECK(stats[1].completed == 0u);
+    TEST_CHECK(stats[1].overflows == 499u);
+
+    run_example(SAR2_PREEMPTION_ABORT_RESUME, 140u, stats);
+    TEST_CHECK(stats[1].completed == 0u);
+    TEST_CHECK(stats[1].overflows == 499u);
+
+    run_example(SAR2_PREEMPTION_ABORT_CANCEL, 140u, stats);
+    TEST_CHECK(stats[1].completed == 0u);
+    TEST_CHECK(stats[1].cancelled == 500u);
+
+    run_example(SAR2_PREEMPTION_FINISH_RESUME, 140u, stats);
+    TEST_CHECK(stats[1].completed == 500u);
+}
+
+/*******************************************************************************
+* Function Name: test_inversion
+********************************************************************************
+* Summary:
+*  Three groups with priorities 0, 1, and 2: a 1-channel group of 30 cycles,
+*  an 8-channel group of 100 cycles per channel, and a 4-channel group of 134
+*  cycles per channel. With FINISH_RESUME, the priority 0 group waits for at
+*  most one channel of the group that converts when it is triggered, never
+*  for the rest of the priority 1 group (no unbounded inversion through a
+*  medium priority group). With ABORT_RESUME, it never waits.
+*
+*******************************************************************************/
+static void test_inversion(void)
+{
+    sar2_sched_group_t groups[3] =
+    {
+        { 0u, SAR2_PREEMPTION_FINISH_RESUME, 1u, 30u, 997u, 0u },
+        { 1u, SAR2_PREEMPTION_FINISH_RESUME, 8u, 100u, 3001u, 11u },
+        { 2u, SAR2_PREEMPTION_FINISH_RESUME, 4u, 134u, 2000u, 0u }
+    };
+    sar2_sched_stats_t stats[3];
+
+    sar2_sched_run(groups, 3u, EXAMPLE_CYCLES, stats);
+    TEST_CHECK(stats[0].latencyMin == 30u);
+    TEST_CHECK((stats[0].latencyMax > 30u) && (stats[0].latencyMax <= (30u + 134u)));
+    TEST_CHECK((stats[1].preempted != 0u) && (stats[2].preempted != 0u));
+    TEST_CHECK((stats[1].overflows == 0u) && (stats[2].overflows == 0u));
+
+    /* The priority 1 group waits for at most one channel of the priority 2 group */
+    TEST_CHECK(stats[1].latencyMax <= (800u + 134u + (2u * 30u)));
+
+    groups[1].preemptionType = SAR2_PREEMPTION_ABORT_RESUME;
+    groups[2].preemptionType = SAR2_PREEMPTION_ABORT_RESUME;
+    sar2_sched_run(groups, 3u, EXAMPLE_CYCLES, stats);
+    TEST_CHECK((stats[0].latencyMin == 30u) && (stats[0].latencyMax == 30u));
+    TEST_CHECK((stats[1].overflows == 0u) && (stats[2].overflows == 0u));
+}
+
+/*******************************************************************************
+* Function Name: check_assigned
+********************************************************************************
+* Summary:
+*  Runs assigned groups and checks that every group completes without lost
+*  triggers and that every critical group stays within its budget.
+*
+*******************************************************************************/
+static void check_assigned(const sar2_sched_request_t *requests, const sar2_sched_group_t *groups, uint32_t groupNum)
+{
+    sar2_sched_stats_t stats[SAR2_SCHED_GROUPS_MAX];
+    uint32_t i;
+
+    sar2_sched_run(groups, groupNum, EXAMPLE_CYCLES, stats);
+
+    for (i = 0u; i < groupNum; i++)
+    {
+        TEST_CHECK((stats[i].overflows == 0u) && (stats[i].cancelled == 0u));
+        TEST_CHECK(stats[i].completed >= (stats[i].triggers - 1u));
+        if (requests[i].groupClass == SAR2_SCHED_CLASS_CRITICAL)
+        {
+            TEST_CHECK(stats[i].latencyMax <= requests[i].latencyBudget);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_assign
+********************************************************************************
+* Summary:
+*  Checks the assignment of the group of this example, alone and critical,
+*  and of two critical and two background groups given out of priority
+*  order: the priorities follow the budgets and the trigger periods, and
+*  the background group whose channel would break the budget of the
+*  priority 0 group is the only one that gets ABORT_RESUME.
+*
+*******************************************************************************/
+static void test_assign(void)
+{
+    /* VBG and AN0: 2 channels of 136 cycles, triggered by software */
+    const sar2_sched_request_t example = { SAR2_SCHED_CLASS_CRITICAL, 2u, 136u, 0u, 0u, 272u };
+    const sar2_sched_request_t requests[4] =
+    {
+        { SAR2_SCHED_CLASS_BACKGROUND, 4u, 134u, 2000u, 0u, 0u },
+        { SAR2_SCHED_CLASS_CRITICAL,   2u, 60u,  1500u, 7u, 600u },
+        { SAR2_SCHED_CLASS_BACKGROUND, 2u, 50u,  500u,  3u, 0u },
+        { SAR2_SCHED_CLASS_CRITICAL,   1u, 30u,  997u,  0u, 150u }
+    };
+    static const uint8_t expectedPriority[4] = { 3u, 1u, 2u, 0u };
+    static const uint8_t expectedPreemption[4] =
+    {
+        SAR2_PREEMPTION_ABORT_RESUME, SAR2_PREEMPTION_FINISH_RESUME,
+        SAR2_PREEMPTION_FINISH_RESUME, SAR2_PREEMPTION_FINISH_RESUME
+    };
+    sar2_sched_group_t groups[4];
+    uint32_t i;
+
+    /* design.modus: priority 0 and FINISH_RESUME */
+    TEST_CHECK(sar2_sched_assign(&example, 1u, groups));
+    TEST_CHECK((groups[0].priority == 0u) && (groups[0].preemptionType == SAR2_PREEMPTION_FINISH_RESUME));
+
+    TEST_CHECK(sar2_sched_assign(requests, 4u, groups));
+    for (i = 0u; i < 4u; i++)
+    {
+        TEST_CHECK(groups[i].priority == expectedPriority[i]);
+        TEST_CHECK(groups[i].preemptionType == expectedPreemption[i]);
+        TEST_CHECK((groups[i].channels == requests[i].channels) &&
+                   (groups[i].triggerPeriod == requests[i].triggerPeriod));
+    }
+    check_assigned(requests, groups, 4u);
+}
+
+/*******************************************************************************
+* Function Name: test_infeasible
+********************************************************************************
+* Summary:
+*  Checks the cases sar2_sched_assign() rejects: a critical group that misses
+*  its budget on its own, groups that need more than the whole conversion
+*  time, and the starvation case of the README, where the budget forces
+*  ABORT_RESUME on a background channel longer than the idle time between
+*  the critical conversions. A budget that allows one background channel
+*  is still rejected while that channel makes the critical group overrun its
+*  trigger period; a longer period is accepted, and every group completes.
+*
+*******************************************************************************/
+static void test_infeasible(void)
+{
+    const sar2_sched_request_t tooLong = { SAR2_SCHED_CLASS_CRITICAL, 2u, 30u, 1000u, 0u, 59u };
+    const sar2_sched_request_t overload[2] =
+    {
+        { SAR2_SCHED_CLASS_BACKGROUND, 4u, 134u, 1000u, 0u, 0u },
+        { SAR2_SCHED_CLASS_BACKGROUND, 4u, 120u, 1000u, 0u, 0u }
+    };
+    sar2_sched_request_t starving[2] =
+    {
+        { SAR2_SCHED_CLASS_CRITICAL,   1u, 30u,  140u,  0u, 100u },
+        { SAR2_SCHED_CLASS_BACKGROUND, 4u, 134u, 2000u, 0u, 0u }
+    };
+    sar2_sched_group_t groups[2];
+    sar2_sched_stats_t stats[2];
+
+    TEST_CHECK(!sar2_sched_assign(&tooLong, 1u, groups));
+    TEST_CHECK(!sar2_sched_assign(overload, 2u, groups));
+
+    TEST_CHECK(!sar2_sched_assign(starving, 2u, groups));
+    TEST_CHECK(groups[1].preemptionType == SAR2_PREEMPTION_ABORT_RESUME);
+    sar2_sched_run(groups, 2u, EXAMPLE_CYCLES, stats);
+    TEST_CHECK(stats[1].completed == 0u);
+
+    /* A budget that allows one background channel still fails: the critical
+     * group then runs into its next trigger */
+    starving[0].latencyBudget = 30u + 134u;
+    TEST_CHECK(!sar2_sched_assign(starving, 2u, groups));
+    groups[1].preemptionType = SAR2_PREEMPTION_FINISH_RESUME;
+    sar2_sched_run(groups, 2u, EXAMPLE_CYCLES, stats);
+    TEST_CHECK((stats[0].latencyMax > 140u) && (stats[0].overflows != 0u));
+
+    /* With a trigger period that leaves room for one background channel, it is accepted */
+    starving[0].triggerPeriod = 170u;
+    TEST_CHECK(sar2_sched_assign(starving, 2u, groups));
+    TEST_CHECK(groups[1].preemptionType == SAR2_PREEMPTION_FINISH_RESUME);
+    check_assigned(starving, groups, 2u);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the checks of the scheduling model.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_single();
+    test_example();
+    test_starvation();
+    test_inversion();
+    test_assign();
+    test_infeasible();
+
+    return TEST_REPORT("test_sar2_sched");
+}
+/* [] END OF FILE */
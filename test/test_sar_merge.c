@@ -0,0 +1,312 @@
+/******************************************************************************
+* File Name:   test_sar_merge.c
+*
+* Description: This file contains the host test of the merge of the sample
+*              rings of several SAR2 units: the order by timestamp across
+*              the wrap around, the wait for an empty ring and the drain,
+*              and one producer thread per emulated unit, whose time-aligned
+*              results must come out interleaved in sample order, complete,
+*              at the number of units times the rate of one unit.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <pthread.h>
+#include <sched.h>
+#include "test_common.h"
+#include "sar_merge.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Results converted by each emulated unit in the threaded test */
+#define UNIT_SAMPLES    (200000u)
+
+/* CPU cycles between two triggers of the units, one group of the example at
+ * 200 MHz, and the interrupt latency added per unit index, so that the units
+ * triggered together are processed one after the other */
+#define GROUP_CYCLES    (14144u)
+#define SKEW_CYCLES     (37u)
+
+/* Timestamp of the first trigger, close to the wrap around of the 32-bit
+ * cycle counter */
+#define WRAP_START      (0xFFFFFFFFu - (100u * GROUP_CYCLES))
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* One emulated SAR2 unit: its ring and the thread that stands for its
+ * interrupt handler */
+typedef struct
+{
+    sample_ring_t ring;
+    pthread_t thread;
+    uint32_t unit;
+    volatile uint32_t done;     /* Set by the producer after the last push */
+} unit_emu_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static unit_emu_t g_units[SAR_MERGE_MAX_UNITS];
+
+/*******************************************************************************
+* Function Name: make_sample
+********************************************************************************
+* Summary:
+*  Fills a sample of a unit from its sequence number and timestamp.
+*
+*******************************************************************************/
+static void make_sample(uint32_t unit, uint32_t seq, uint32_t timestamp, adc_sample_t *sample)
+{
+    sample->resultAN0 = (uint16_t)seq;
+    sample->resultVBG = (uint16_t)unit;
+    sample->timestamp = timestamp;
+    sample->averageCount = (uint16_t)(seq >> 16);
+    sample->outputFormat = 0u;
+}
+
+/*******************************************************************************
+* Function Name: sample_seq
+********************************************************************************
+* Summary:
+*  Returns the sequence number stored by make_sample().
+*
+*******************************************************************************/
+static uint32_t sample_seq(const adc_sample_t *sample)
+{
+    return ((uint32_t)sample->averageCount << 16) | sample->resultAN0;
+}
+
+/*******************************************************************************
+* Function Name: test_order
+********************************************************************************
+* Summary:
+*  Three units with results across the wrap around of the timestamps: the
+*  merge waits while a unit's ring is empty, returns the results by
+*  timestamp and equal timestamps in unit order, and returns the rest once
+*  draining.
+*
+*******************************************************************************/
+static void test_order(void)
+{
+    sample_ring_t *rings[3] = { &g_units[0].ring, &g_units[1].ring, &g_units[2].ring };
+    static const uint32_t expectedUnit[6] = { 2u, 0u, 1u, 0u, 1u, 2u };
+    static const uint32_t expectedTime[6] = { 0xFFFFFFF0u, 0xFFFFFFFFu, 0xFFFFFFFFu, 5u, 5u, 9u };
+    sar_merge_t merge;
+    sar_merge_sample_t out;
+    adc_sample_t sample;
+    uint32_t i;
+
+    for (i = 0u; i < 3u; i++)
+    {
+        sample_ring_reset(rings[i]);
+    }
+    sar_merge_init(&merge, rings, 3u);
+
+    TEST_CHECK(!sar_merge_pop(&merge, false, &out));
+    TEST_CHECK(!sar_merge_pop(&merge, true, &out));
+
+    make_sample(0u, 0u, 0xFFFFFFFFu, &sample);
+    TEST_CHECK(sample_ring_push(rings[0], &sample));
+    make_sample(0u, 1u, 5u, &sample);
+    TEST_CHECK(sample_ring_push(rings[0], &sample));
+    make_sample(2u, 0u, 0xFFFFFFF0u, &sample);
+    TEST_CHECK(sample_ring_push(rings[2], &sample));
+    make_sample(2u, 1u, 9u, &sample);
+    TEST_CHECK(sample_ring_push(rings[2], &sample));
+
+    /* Unit 1 may still deliver an older result */
+    TEST_CHECK(!sar_merge_pop(&merge, false, &out));
+
+    make_sample(1u, 0u, 0xFFFFFFFFu, &sample);
+    TEST_CHECK(sample_ring_push(rings[1], &sample));
+    make_sample(1u, 1u, 5u, &sample);
+    TEST_CHECK(sample_ring_push(rings[1], &sample));
+
+    for (i = 0u; i < 4u; i++)
+    {
+        TEST_CHECK(sar_merge_pop(&merge, false, &out));
+        TEST_CHECK((out.unit == expectedUnit[i]) && (out.sample.resultVBG == expectedUnit[i]));
+        TEST_CHECK(out.sample.timestamp == expectedTime[i]);
+    }
+
+    /* Unit 0 is empty: the remaining results wait for it until draining */
+    TEST_CHECK(!sar_merge_pop(&merge, false, &out));
+    for (i = 4u; i < 6u; i++)
+    {
+        TEST_CHECK(sar_merge_pop(&merge, true, &out));
+        TEST_CHECK((out.unit == expectedUnit[i]) && (out.sample.timestamp == expectedTime[i]));
+    }
+    TEST_CHECK(!sar_merge_pop(&merge, true, &out));
+
+    TEST_CHECK((merge.merged[0] == 2u) && (merge.merged[1] == 2u) && (merge.merged[2] == 2u));
+}
+
+/*******************************************************************************
+* Function Name: unit_producer
+********************************************************************************
+* Summary:
+*  Producer thread of an emulated unit: pushes UNIT_SAMPLES results, one per
+*  trigger, timestamped with the trigger time plus the latency of the unit.
+*  On a full ring, it yields and retries.
+*
+*******************************************************************************/
+static void *unit_producer(void *arg)
+{
+    unit_emu_t *u = (unit_emu_t *)arg;
+    adc_sample_t sample;
+    uint32_t seq;
+
+    for (seq = 0u; seq < UNIT_SAMPLES; seq++)
+    {
+        make_sample(u->unit, seq, WRAP_START + (seq * GROUP_CYCLES) + (u->unit * SKEW_CYCLES), &sample);
+
+        while (!sample_ring_push(&u->ring, &sample))
+        {
+            (void)sched_yield();
+        }
+    }
+
+    __atomic_store_n(&u->done, 1u, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: test_units
+********************************************************************************
+* Summary:
+*  Runs unitCount units on their own threads and merges their rings in the
+*  calling thread. Result i of the merged stream must be result i / unitCount
+*  of unit i % unitCount, none may be missing, and the stream must carry
+*  unitCount results per trigger period.
+*
+*******************************************************************************/
+static void test_units(uint32_t unitCount)
+{
+    sample_ring_t *rings[SAR_MERGE_MAX_UNITS];
+    sar_merge_t merge;
+    sar_merge_sample_t out;
+    uint32_t received = 0u;
+    uint32_t misplaced = 0u;
+    uint32_t first = 0u;
+    uint32_t last = 0u;
+    uint32_t unit;
+    bool drain = false;
+
+    for (unit = 0u; unit < unitCount; unit++)
+    {
+        g_units[unit].unit = unit;
+        g_units[unit].done = 0u;
+        sample_ring_reset(&g_units[unit].ring);
+        rings[unit] = &g_units[unit].ring;
+    }
+    sar_merge_init(&merge, rings, unitCount);
+
+    for (unit = 0u; unit < unitCount; unit++)
+    {
+        TEST_CHECK(pthread_create(&g_units[unit].thread, NULL, unit_producer, &g_units[unit]) == 0);
+    }
+
+    for (;;)
+    {
+        /* Once every producer is done, the results left in the rings are
+         * the last ones: drain them */
+        if (!drain)
+        {
+            drain = true;
+            for (unit = 0u; unit < unitCount; unit++)
+            {
+                drain = drain && (__atomic_load_n(&g_units[unit].done, __ATOMIC_ACQUIRE) != 0u);
+            }
+        }
+
+        if (!sar_merge_pop(&merge, drain, &out))
+        {
+            if (drain)
+            {
+                break;
+            }
+            (void)sched_yield();
+            continue;
+        }
+
+        if ((out.unit != (received % unitCount)) || (out.sample.resultVBG != out.unit) ||
+            (sample_seq(&out.sample) != (received / unitCount)))
+        {
+            misplaced++;
+        }
+
+        first = (received == 0u) ? out.sample.timestamp : first;
+        last = out.sample.timestamp;
+        received++;
+    }
+
+    for (unit = 0u; unit < unitCount; unit++)
+    {
+        TEST_CHECK(pthread_join(g_units[unit].thread, NULL) == 0);
+        TEST_CHECK(merge.merged[unit] == UNIT_SAMPLES);
+    }
+
+    TEST_CHECK(misplaced == 0u);
+    TEST_CHECK(received == (unitCount * UNIT_SAMPLES));
+
+    /* The stream spans UNIT_SAMPLES trigger periods, across the wrap around */
+    TEST_CHECK((((last - first) / GROUP_CYCLES) + 1u) == UNIT_SAMPLES);
+    TEST_CHECK((received / (((last - first) / GROUP_CYCLES) + 1u)) == unitCount);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the tests of the merge.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_order();
+    test_units(1u);
+    test_units(2u);
+    test_units(SAR_MERGE_MAX_UNITS);
+
+    return TEST_REPORT("test_sar_merge");
+}
+/* [] END OF FILE */
@@ -0,0 +1,239 @@
+/******************************************************************************
+* File Name:   test_signal_source.c
+*
+* Description: This file contains the host test of the synthetic signal sources:
+*              reproducibility per seed, the 12-bit quantization, the averaging
+*              through the SAR2 result model and the noise level, followed by the
+*              generation rate of each shape.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include <math.h>
+#include "test_common.h"
+#include "signal_source.h"
+#include "sar2_model.h"
+#include "adc_result.h"
+#include "cycle_probe.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of conversions compared per shape */
+#define TEST_CODES      (1000000u)
+
+/* Number of conversions timed per shape */
+#define BENCH_CODES     (20000000u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Sink of the benchmark output, so the generation is not optimized away */
+static volatile uint32_t g_sink;
+
+/*******************************************************************************
+* Function Name: test_codes
+********************************************************************************
+* Summary:
+*  Checks for every shape that the same seed reproduces the same sequence, that
+*  another seed changes it, and that every code is a 12-bit value.
+*
+*******************************************************************************/
+static void test_codes(void)
+{
+    signal_source_t a;
+    signal_source_t b;
+    signal_source_t c;
+    int32_t type;
+    uint32_t i;
+
+    for (type = 0; type < SIGNAL_TYPE_NUM; type++)
+    {
+        bool same = true;
+        bool inRange = true;
+        bool differs = false;
+
+        TEST_CHECK(SIGNAL_TYPE_STR[type] != NULL);
+
+        signal_source_init(&a, type, 42u);
+        signal_source_init(&b, type, 42u);
+        signal_source_init(&c, type, 43u);
+
+        for (i = 0u; i < TEST_CODES; i++)
+        {
+            uint16_t code = signal_source_next_code(&a);
+
+            same = same && (code == signal_source_next_code(&b));
+            differs = differs || (code != signal_source_next_code(&c));
+            inRange = inRange && (code <= SAR2_MODEL_CODE_MAX);
+        }
+
+        TEST_CHECK(same);
+        TEST_CHECK(differs);
+        TEST_CHECK(inRange);
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_results
+********************************************************************************
+* Summary:
+*  Checks that signal_source_next_result() equals the SAR2 result model
+*  applied to the codes of a source with the same seed, for every average
+*  count and output format.
+*
+*******************************************************************************/
+static void test_results(void)
+{
+    uint16_t codes[SAR2_MODEL_AVERAGE_MAX];
+    signal_source_t a;
+    signal_source_t b;
+    uint32_t averageCount;
+    int32_t format;
+    uint32_t i;
+    uint32_t n;
+
+    for (averageCount = 1u; averageCount <= SAR2_MODEL_AVERAGE_MAX; averageCount *= 2u)
+    {
+        uint8_t shift = sar2_model_right_shift(averageCount);
+
+        for (format = 0; format < FORMAT_NUM; format++)
+        {
+            bool same = true;
+
+            signal_source_init(&a, SIGNAL_CHIRP, 7u);
+            signal_source_init(&b, SIGNAL_CHIRP, 7u);
+
+            for (n = 0u; n < 1000u; n++)
+            {
+                for (i = 0u; i < averageCount; i++)
+                {
+                    codes[i] = signal_source_next_code(&b);
+                }
+                same = same && (signal_source_next_result(&a, averageCount, shift, format) ==
+                                sar2_model_result(codes, averageCount, shift, format));
+            }
+
+            TEST_CHECK(same);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_noise
+********************************************************************************
+* Summary:
+*  Checks the DC source: mid scale mean, a noise sigma of about 4 codes, and
+*  the reduction of the noise by the square root of the average count.
+*
+*******************************************************************************/
+static void test_noise(void)
+{
+    signal_source_t src;
+    adc_stats_t single;
+    adc_stats_t averaged;
+    uint32_t i;
+
+    signal_source_init(&src, SIGNAL_DC_NOISE, 1u);
+    adc_stats_reset(&single);
+    for (i = 0u; i < TEST_CODES; i++)
+    {
+        adc_stats_add(&single, signal_source_next_code(&src));
+    }
+
+    adc_stats_reset(&averaged);
+    for (i = 0u; i < (TEST_CODES / 16u); i++)
+    {
+        adc_stats_add(&averaged, signal_source_next_result(&src, 16u, 4u, UNSIGNED_RIGHT_ALIGNED));
+    }
+
+    TEST_CHECK(fabs(single.mean - 2048.0) < 0.5);
+    TEST_CHECK(fabs(sqrt(adc_stats_variance(&single)) - 4.0) < 0.4);
+
+    /* Truncation adds up to 1/12 code^2 of quantization noise to the averaged result */
+    TEST_CHECK(fabs(sqrt(adc_stats_variance(&averaged)) - 1.0) < 0.2);
+}
+
+/*******************************************************************************
+* Function Name: bench_codes
+********************************************************************************
+* Summary:
+*  Times the generation of every shape and prints the conversions per second.
+*
+*******************************************************************************/
+static void bench_codes(void)
+{
+    signal_source_t src;
+    int32_t type;
+    uint32_t start;
+    uint32_t elapsedNs;
+    uint32_t sum;
+    uint32_t i;
+
+    for (type = 0; type < SIGNAL_TYPE_NUM; type++)
+    {
+        signal_source_init(&src, type, 42u);
+        sum = 0u;
+
+        start = cycle_probe_now();
+        for (i = 0u; i < BENCH_CODES; i++)
+        {
+            sum += signal_source_next_code(&src);
+        }
+        elapsedNs = cycle_probe_elapsed(start);
+        g_sink = sum;
+
+        printf("%s %.0f M conversions/s\r\n", SIGNAL_TYPE_STR[type],
+               (double)BENCH_CODES * 1000.0 / (double)elapsedNs);
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the checks and the timing of the signal sources.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_codes();
+    test_results();
+    test_noise();
+    bench_codes();
+
+    return TEST_REPORT("test_signal_source");
+}
+/* [] END OF FILE */
@@ -0,0 +1,531 @@
+/******************************************************************************
+* File Name:   test_stream_codec.c
+*
+* Description: This file contains the host test of the sample stream format: the
+*              delta + Rice block codec on synthetic and recorded signals, its escape
+*              path and worst case size, the CRC, varint, configuration and sequence
+*              number helpers of the frames, and the host decoder on a clean stream.
+*              It reports the compression ratio and the codec throughput.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include <string.h>
+#include "test_common.h"
+#include "stream_codec.h"
+#include "stream_frame.h"
+#include "signal_source.h"
+#include "sar2_model.h"
+#include "adc_result.h"
+#include "replay.h"
+#include "cycle_probe.h"
+#include "tools/stream_decoder.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of samples per signal for the round trips and the compression ratio */
+#define TEST_SAMPLES    (65536u)
+
+/* Number of random blocks checked against the worst case size */
+#define RANDOM_BLOCKS   (100000u)
+
+/* Number of samples timed per signal */
+#define BENCH_SAMPLES   (4000000u)
+
+/* Bytes per second of a 115200 baud 8N1 link */
+#define LINK_BYTES_PER_S    (11520u)
+
+/* Time base ticks between two samples in the generated streams */
+#define SAMPLE_TICKS    (3200u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Frames of a generated stream and the samples they hold */
+typedef struct
+{
+    uint8_t *bytes;
+    uint32_t size;
+    uint16_t sequence;
+    uint64_t frameTime;
+} stream_writer_t;
+
+/* Expected samples of a decoded stream */
+typedef struct
+{
+    const uint16_t *samples;
+    uint32_t next;
+    uint64_t startTime;
+    bool ok;
+} stream_check_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint16_t g_samples[TEST_SAMPLES];
+static uint8_t g_stream[TEST_SAMPLES * 4u];
+
+/* Sink of the benchmark output, so the coding is not optimized away */
+static volatile uint32_t g_sink;
+
+/*******************************************************************************
+* Function Name: next_random
+********************************************************************************
+* Summary:
+*  Returns the next value of a xorshift32 generator.
+*
+*******************************************************************************/
+static uint32_t next_random(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+
+    return *state;
+}
+
+/*******************************************************************************
+* Function Name: round_trip
+********************************************************************************
+* Summary:
+*  Encodes and decodes one block and checks that the samples, the size, and
+*  the number of bytes consumed match. Truncating the block must be detected.
+*
+* Return:
+*  uint32_t - Size of the encoded block
+*
+*******************************************************************************/
+static uint32_t round_trip(const uint16_t *samples, uint32_t count)
+{
+    uint8_t block[STREAM_BLOCK_MAX_SIZE + 4u];
+    uint16_t decoded[STREAM_BLOCK_SAMPLES];
+    uint32_t size = stream_encode_block(samples, count, block);
+
+    TEST_CHECK(size <= STREAM_BLOCK_MAX_SIZE);
+    TEST_CHECK(stream_decode_block(block, size, decoded) == size);
+    TEST_CHECK(memcmp(decoded, samples, count * sizeof(samples[0])) == 0);
+
+    /* Padding can hide the loss of the last byte only if it holds no code bits */
+    TEST_CHECK((stream_decode_block(block, size - 1u, decoded) == 0u) ||
+               (memcmp(decoded, samples, count * sizeof(samples[0])) != 0));
+
+    return size;
+}
+
+/*******************************************************************************
+* Function Name: fill_signal
+********************************************************************************
+* Summary:
+*  Fills g_samples with the decoded results of a synthetic source, without
+*  averaging.
+*
+*******************************************************************************/
+static void fill_signal(int32_t type)
+{
+    signal_source_t src;
+    uint32_t i;
+
+    signal_source_init(&src, type, 42u);
+    for (i = 0u; i < TEST_SAMPLES; i++)
+    {
+        g_samples[i] = signal_source_next_result(&src, 1u, 0u, UNSIGNED_RIGHT_ALIGNED);
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_round_trips
+********************************************************************************
+* Summary:
+*  Round trips full and partial blocks of every synthetic signal and of the
+*  recorded captures of the corpus.
+*
+*******************************************************************************/
+static void test_round_trips(void)
+{
+    uint16_t samples[STREAM_BLOCK_SAMPLES];
+    const replay_capture_t *capture;
+    int32_t type;
+    uint32_t count;
+    uint32_t i;
+    uint32_t c;
+
+    for (type = 0; type < SIGNAL_TYPE_NUM; type++)
+    {
+        fill_signal(type);
+
+        for (i = 0u; i < TEST_SAMPLES; i += STREAM_BLOCK_SAMPLES)
+        {
+            (void)round_trip(&g_samples[i], STREAM_BLOCK_SAMPLES);
+        }
+        for (count = 1u; count <= STREAM_BLOCK_SAMPLES; count++)
+        {
+            (void)round_trip(&g_samples[count * 7u], count);
+        }
+    }
+
+    for (c = 0u; c < REPLAY_CORPUS_NUM; c++)
+    {
+        capture = &REPLAY_CORPUS[c];
+        for (i = 0u; (i + STREAM_BLOCK_SAMPLES) <= capture->count; i += STREAM_BLOCK_SAMPLES)
+        {
+            for (count = 0u; count < STREAM_BLOCK_SAMPLES; count++)
+            {
+                samples[count] = adc_result_decode(capture->records[i + count].resultAN0_raw,
+                                                   capture->outputFormat);
+            }
+            (void)round_trip(samples, STREAM_BLOCK_SAMPLES);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_escape
+********************************************************************************
+* Summary:
+*  Checks the escaped residuals: a full-scale step in a flat block is written
+*  as STREAM_RICE_ESCAPE one bits and STREAM_ESCAPE_BITS bits, and the largest
+*  16-bit steps in both directions decode.
+*
+*******************************************************************************/
+static void test_escape(void)
+{
+    uint16_t samples[STREAM_BLOCK_SAMPLES];
+    uint32_t i;
+
+    /* One residual of zigzag(4095) = 8190 among 30 zeros selects k = 8; 8190 >> 8 = 31 is escaped */
+    for (i = 0u; i < STREAM_BLOCK_SAMPLES; i++)
+    {
+        samples[i] = (i < (STREAM_BLOCK_SAMPLES / 2u)) ? 0u : SAR2_MODEL_CODE_MAX;
+    }
+    TEST_CHECK(round_trip(samples, STREAM_BLOCK_SAMPLES) ==
+               (STREAM_BLOCK_HEADER_SIZE + (((30u * (1u + 8u)) + STREAM_RICE_ESCAPE + STREAM_ESCAPE_BITS + 7u) / 8u)));
+
+    /* Steps of +65535 and -65535 among zeros */
+    for (i = 0u; i < STREAM_BLOCK_SAMPLES; i++)
+    {
+        samples[i] = ((i == 10u) || (i == 20u)) ? 0xFFFFu : 0u;
+    }
+    (void)round_trip(samples, STREAM_BLOCK_SAMPLES);
+
+    /* Alternating full-scale 16-bit values */
+    for (i = 0u; i < STREAM_BLOCK_SAMPLES; i++)
+    {
+        samples[i] = ((i & 1u) != 0u) ? 0xFFFFu : 0u;
+    }
+    (void)round_trip(samples, STREAM_BLOCK_SAMPLES);
+}
+
+/*******************************************************************************
+* Function Name: test_worst_case
+********************************************************************************
+* Summary:
+*  Checks STREAM_BLOCK_MAX_SIZE against random 16-bit and 12-bit blocks and
+*  blocks of rare full-scale glitches. The bound assumes every residual is
+*  escaped, which the choice of k prevents, so it is not reached; the largest
+*  size found is printed.
+*
+*******************************************************************************/
+static void test_worst_case(void)
+{
+    uint16_t samples[STREAM_BLOCK_SAMPLES];
+    uint32_t state = 1u;
+    uint32_t largest = 0u;
+    uint32_t size;
+    uint32_t i;
+    uint32_t b;
+
+    for (b = 0u; b < RANDOM_BLOCKS; b++)
+    {
+        uint32_t mode = b % 3u;
+
+        for (i = 0u; i < STREAM_BLOCK_SAMPLES; i++)
+        {
+            uint32_t r = next_random(&state);
+
+            /* Random 16-bit values, random 12-bit values, or rare full-scale glitches */
+            samples[i] = (mode == 0u) ? (uint16_t)r :
+                         (mode == 1u) ? (uint16_t)(r & SAR2_MODEL_CODE_MAX) :
+                         (((r >> 16) & 7u) == 0u) ? 0xFFFFu : (uint16_t)(r & 3u);
+        }
+
+        size = round_trip(samples, 1u + (b % STREAM_BLOCK_SAMPLES));
+        if (size > largest)
+        {
+            largest = size;
+        }
+    }
+
+    TEST_CHECK(largest <= STREAM_BLOCK_MAX_SIZE);
+    printf("worst case: %u bytes of %u allowed in %u random blocks\r\n", (unsigned)largest,
+           (unsigned)STREAM_BLOCK_MAX_SIZE, (unsigned)RANDOM_BLOCKS);
+}
+
+/*******************************************************************************
+* Function Name: test_frame_fields
+********************************************************************************
+* Summary:
+*  Checks the CRC against the CRC-16/CCITT-FALSE check value, the varint and
+*  configuration payloads, and the sequence number gaps.
+*
+*******************************************************************************/
+static void test_frame_fields(void)
+{
+    static const uint64_t VALUES[] = { 0u, 1u, 127u, 128u, 16383u, 16384u, 0xFFFFFFFFu, UINT64_MAX };
+    const stream_frame_config_t config =
+    {
+        .outputFormat = 2u, .blockSamples = 32u, .averageCount = 256u, .bandGapMv = 1200u,
+        .tickHz = 320000000u, .time = 0x0123456789ABCDEFu
+    };
+    stream_frame_config_t unpacked;
+    uint8_t payload[STREAM_FRAME_CONFIG_SIZE];
+    uint64_t value;
+    uint32_t size;
+    uint32_t i;
+
+    TEST_CHECK(stream_frame_crc16((const uint8_t *)"123456789", 9u) == 0x29B1u);
+    TEST_CHECK(stream_frame_crc16(payload, 0u) == 0xFFFFu);
+
+    for (i = 0u; i < (sizeof(VALUES) / sizeof(VALUES[0])); i++)
+    {
+        size = stream_frame_pack_varint(payload, VALUES[i]);
+        TEST_CHECK(size <= STREAM_FRAME_VARINT_MAX_SIZE);
+        TEST_CHECK(stream_frame_unpack_varint(payload, size, &value) == size);
+        TEST_CHECK(value == VALUES[i]);
+        TEST_CHECK(stream_frame_unpack_varint(payload, size - 1u, &value) == 0u);
+    }
+    TEST_CHECK(stream_frame_pack_varint(payload, UINT64_MAX) == STREAM_FRAME_VARINT_MAX_SIZE);
+
+    TEST_CHECK(stream_frame_pack_config(payload, &config) == STREAM_FRAME_CONFIG_SIZE);
+    TEST_CHECK(stream_frame_unpack_config(payload, STREAM_FRAME_CONFIG_SIZE, &unpacked) == STREAM_FRAME_CONFIG_SIZE);
+    TEST_CHECK((unpacked.outputFormat == config.outputFormat) && (unpacked.blockSamples == config.blockSamples) &&
+               (unpacked.averageCount == config.averageCount) && (unpacked.bandGapMv == config.bandGapMv) &&
+               (unpacked.tickHz == config.tickHz) && (unpacked.time == config.time));
+    TEST_CHECK(stream_frame_unpack_config(payload, STREAM_FRAME_CONFIG_SIZE - 1u, &unpacked) == 0u);
+
+    TEST_CHECK(stream_frame_sequence_gap(5u, 6u) == 0u);
+    TEST_CHECK(stream_frame_sequence_gap(5u, 8u) == 2u);
+    TEST_CHECK(stream_frame_sequence_gap(0xFFFFu, 0u) == 0u);
+    TEST_CHECK(stream_frame_sequence_gap(0xFFFEu, 1u) == 2u);
+    TEST_CHECK(stream_frame_sequence_gap(7u, 7u) == 0u);
+    TEST_CHECK(stream_frame_sequence_gap(1u, 0u) == 0xFFFEu);
+}
+
+/*******************************************************************************
+* Function Name: write_frame
+********************************************************************************
+* Summary:
+*  Appends a configuration frame, or a sample frame with the time of its
+*  first sample, to a generated stream, the way the application sends them.
+*
+*******************************************************************************/
+static void write_frame(stream_writer_t *w, const stream_frame_config_t *config, uint64_t time,
+                        const uint16_t *samples, uint32_t count)
+{
+    uint8_t *frame = &w->bytes[w->size];
+    uint32_t length;
+
+    if (config != NULL)
+    {
+        length = stream_frame_pack_config(&frame[STREAM_FRAME_HEADER_SIZE], config);
+        w->size += stream_frame_finish(frame, STREAM_FRAME_TYPE_CONFIG, w->sequence++, length);
+        w->frameTime = config->time;
+    }
+    else
+    {
+        length = stream_frame_pack_varint(&frame[STREAM_FRAME_HEADER_SIZE], time - w->frameTime);
+        w->frameTime = time;
+        length += stream_encode_block(samples, count, &frame[STREAM_FRAME_HEADER_SIZE + length]);
+        w->size += stream_frame_finish(frame, STREAM_FRAME_TYPE_SAMPLES, w->sequence++, length);
+    }
+}
+
+/*******************************************************************************
+* Function Name: check_block
+********************************************************************************
+* Summary:
+*  Decoder callback: compares a decoded frame with the next expected samples
+*  and their time.
+*
+*******************************************************************************/
+static void check_block(void *context, const stream_decoder_block_t *block)
+{
+    stream_check_t *check = (stream_check_t *)context;
+
+    check->ok = check->ok && block->timeValid &&
+                (block->time == (check->startTime + ((uint64_t)check->next * SAMPLE_TICKS))) &&
+                (memcmp(block->samples, &check->samples[check->next], block->count * sizeof(uint16_t)) == 0);
+    check->next += block->count;
+}
+
+/*******************************************************************************
+* Function Name: encode_stream
+********************************************************************************
+* Summary:
+*  Generates the stream of g_samples into g_stream: a configuration frame and
+*  full sample frames, one sample every SAMPLE_TICKS ticks.
+*
+* Return:
+*  uint32_t - Size of the stream in bytes
+*
+*******************************************************************************/
+static uint32_t encode_stream(uint64_t startTime)
+{
+    const stream_frame_config_t config =
+    {
+        .outputFormat = UNSIGNED_RIGHT_ALIGNED, .blockSamples = STREAM_BLOCK_SAMPLES, .averageCount = 1u,
+        .bandGapMv = 1200u, .tickHz = 320000000u, .time = startTime
+    };
+    stream_writer_t w = { .bytes = g_stream, .size = 0u, .sequence = 0xFFF0u, .frameTime = 0u };
+    uint32_t i;
+
+    write_frame(&w, &config, 0u, NULL, 0u);
+    for (i = 0u; i < TEST_SAMPLES; i += STREAM_BLOCK_SAMPLES)
+    {
+        write_frame(&w, NULL, startTime + ((uint64_t)i * SAMPLE_TICKS), &g_samples[i], STREAM_BLOCK_SAMPLES);
+    }
+
+    return w.size;
+}
+
+/*******************************************************************************
+* Function Name: test_decoder
+********************************************************************************
+* Summary:
+*  Decodes the stream of every synthetic signal, fed in chunks of random size,
+*  across a wrap around of the sequence number, and reports the compression
+*  ratio and the samples per second it allows on a 115200 baud link.
+*
+*******************************************************************************/
+static void test_decoder(void)
+{
+    static stream_decoder_t dec;
+    stream_check_t check;
+    uint32_t state = 7u;
+    uint32_t size;
+    uint32_t pos;
+    uint32_t n;
+    int32_t type;
+
+    for (type = 0; type < SIGNAL_TYPE_NUM; type++)
+    {
+        fill_signal(type);
+        size = encode_stream(1000000u);
+
+        check = (stream_check_t){ .samples = g_samples, .next = 0u, .startTime = 1000000u, .ok = true };
+        stream_decoder_init(&dec, &check_block, &check);
+
+        for (pos = 0u; pos < size; pos += n)
+        {
+            n = 1u + (next_random(&state) % 300u);
+            n = ((pos + n) > size) ? (size - pos) : n;
+            stream_decoder_feed(&dec, &g_stream[pos], n);
+        }
+
+        TEST_CHECK(check.ok);
+        TEST_CHECK(check.next == TEST_SAMPLES);
+        TEST_CHECK(dec.stats.frames == (1u + (TEST_SAMPLES / STREAM_BLOCK_SAMPLES)));
+        TEST_CHECK((dec.stats.crcErrors | dec.stats.lostFrames | dec.stats.skippedBytes | dec.stats.malformed) == 0u);
+
+        /* The ratio counts the whole stream against 16-bit binary samples */
+        printf("%-13s %.3f bytes/sample, ratio %.2f:1, %.0f samples/s at 115200 baud (binary: %u)\r\n",
+               SIGNAL_TYPE_STR[type], (double)size / TEST_SAMPLES, (2.0 * TEST_SAMPLES) / (double)size,
+               (double)LINK_BYTES_PER_S * TEST_SAMPLES / (double)size, (unsigned)(LINK_BYTES_PER_S / 2u));
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_codec
+********************************************************************************
+* Summary:
+*  Times the encoding and decoding of blocks of the DC source with noise and
+*  of the sine, and prints the time per sample.
+*
+*******************************************************************************/
+static void bench_codec(void)
+{
+    static const int32_t TYPE[] = { SIGNAL_DC_NOISE, SIGNAL_SINE };
+    uint8_t block[STREAM_BLOCK_MAX_SIZE];
+    uint16_t decoded[STREAM_BLOCK_SAMPLES];
+    uint32_t encodeNs;
+    uint32_t decodeNs;
+    uint32_t start;
+    uint32_t sum = 0u;
+    uint32_t i;
+    uint32_t t;
+
+    for (t = 0u; t < (sizeof(TYPE) / sizeof(TYPE[0])); t++)
+    {
+        fill_signal(TYPE[t]);
+
+        start = cycle_probe_now();
+        for (i = 0u; i < BENCH_SAMPLES; i += STREAM_BLOCK_SAMPLES)
+        {
+            sum += stream_encode_block(&g_samples[i % TEST_SAMPLES], STREAM_BLOCK_SAMPLES, block);
+        }
+        encodeNs = cycle_probe_elapsed(start);
+
+        start = cycle_probe_now();
+        for (i = 0u; i < BENCH_SAMPLES; i += STREAM_BLOCK_SAMPLES)
+        {
+            sum += stream_decode_block(block, sizeof(block), decoded);
+        }
+        decodeNs = cycle_probe_elapsed(start);
+        g_sink = sum;
+
+        printf("%-13s encode %.2f ns/sample, decode %.2f ns/sample\r\n", SIGNAL_TYPE_STR[TYPE[t]],
+               (double)encodeNs / BENCH_SAMPLES, (double)decodeNs / BENCH_SAMPLES);
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the checks and the report of the stream format.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_round_trips();
+    test_escape();
+    test_worst_case();
+    test_frame_fields();
+    test_decoder();
+    bench_codec();
+
+    return TEST_REPORT("test_stream_codec");
+}
+/* [] END OF FILE */
@@ -0,0 +1,366 @@
+/******************************************************************************
+* File Name:   test_timebase.c
+*
+* Description: This file contains the host test of the 64-bit time base. Built
+*              for the PC, it replaces the time stamp clock with a counter set
+*              by the test and checks timebase_now() and timebase_extend()
+*              across the wrap around of the 32-bit time stamps and with a
+*              CPU clock divider. Built for the emulation of test/emu with
+*              CYCLE_PROBE_SYSTICK, it checks that the SysTick interrupt extends
+*              the 24-bit counter, also while the interrupts are disabled,
+*              and that timebase_hz() stays at the undivided CPU clock while
+*              the divider and SystemCoreClock change.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <time.h>
+#include "test_common.h"
+#include "timebase.h"
+#include "cycle_probe.h"
+#if defined(__ARM_ARCH)
+#include "cybsp.h"
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if defined(__ARM_ARCH)
+/* CPU clock of the emulation, and the time base ticks per millisecond */
+#define CPU_CLOCK_HZ        (200000000u)
+#define TICKS_PER_MS        (CPU_CLOCK_HZ / 1000u)
+
+/* Allowed difference between the time base and the host clock: the time
+ * between the two reads, far below one period of the 24-bit counter */
+#define TOLERANCE_TICKS     (TICKS_PER_MS)
+
+/* Waits spanning several periods of the counter (84 ms at 200 MHz, 336 ms
+ * at 50 MHz), and the critical sections, each shorter than one period */
+#define LONG_WAIT_MS        (700u)
+#define BLOCKED_MS          (40u)
+#define BLOCKED_ROUNDS      (8u)
+#else
+/* Time stamp the fake clock starts at, close to its wrap around */
+#define WRAP_START          (0xFFFFFF00u)
+
+/* Step of the fake clock, below the wrap around period */
+#define LARGE_STEP          (0x40000000u)
+#endif
+
+#if defined(__ARM_ARCH)
+/*******************************************************************************
+* Function Name: host_ns
+********************************************************************************
+* Summary:
+*  Returns the monotonic time of the host in nanoseconds, the clock the
+*  emulation derives the CPU cycles from.
+*
+*******************************************************************************/
+static uint64_t host_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: sleep_ms
+********************************************************************************
+* Summary:
+*  Sleeps for a number of milliseconds, resuming after the interrupt signals
+*  of the emulation.
+*
+*******************************************************************************/
+static void sleep_ms(uint32_t ms)
+{
+    uint64_t end = host_ns() + ((uint64_t)ms * 1000000u);
+    struct timespec wake = { (time_t)(end / 1000000000u), (long)(end % 1000000000u) };
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL) != 0)
+    {
+    }
+}
+
+/*******************************************************************************
+* Function Name: check_elapsed
+********************************************************************************
+* Summary:
+*  Checks that the time base advanced by the undivided CPU cycles of the
+*  host time elapsed since the reference reads.
+*
+*******************************************************************************/
+static void check_elapsed(uint64_t ticks0, uint64_t ns0, uint64_t ticks, uint64_t ns)
+{
+    int64_t expected = (int64_t)(((ns - ns0) * CPU_CLOCK_HZ) / 1000000000u);
+    int64_t error = (int64_t)(ticks - ticks0) - expected;
+
+    TEST_CHECK((error > -(int64_t)TOLERANCE_TICKS) && (error < (int64_t)TOLERANCE_TICKS));
+}
+
+/*******************************************************************************
+* Function Name: test_systick_wraps
+********************************************************************************
+* Summary:
+*  Reads the time base after a wait of several counter periods, during which
+*  only the SysTick interrupt counts the wrap arounds, and every millisecond
+*  in critical sections, where the wrap around of the counter is only
+*  pending.
+*
+*******************************************************************************/
+static void test_systick_wraps(void)
+{
+    uint64_t ticks0 = timebase_now();
+    uint64_t ns0 = host_ns();
+    uint64_t last = ticks0;
+    uint32_t round;
+    uint32_t ms;
+
+    sleep_ms(LONG_WAIT_MS);
+    check_elapsed(ticks0, ns0, timebase_now(), host_ns());
+
+    for (round = 0u; round < BLOCKED_ROUNDS; round++)
+    {
+        uint32_t interruptState = Cy_SysLib_EnterCriticalSection();
+
+        for (ms = 0u; ms < BLOCKED_MS; ms++)
+        {
+            uint64_t ticks;
+
+            Cy_SysLib_DelayUs(1000u);
+            ticks = timebase_now();
+            check_elapsed(ticks0, ns0, ticks, host_ns());
+            TEST_CHECK(ticks > last);
+            last = ticks;
+        }
+
+        Cy_SysLib_ExitCriticalSection(interruptState);
+        sleep_ms(1u);
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_systick_divider
+********************************************************************************
+* Summary:
+*  Divides the CPU clock by 4 the way the low-power mode does: the time base
+*  keeps counting undivided cycles across several periods of the slower
+*  counter, a time stamp is extended by its undivided age, and timebase_hz()
+*  stays at the undivided clock before and after SystemCoreClock follows the
+*  divider.
+*
+*******************************************************************************/
+static void test_systick_divider(void)
+{
+    uint64_t ticks0;
+    uint64_t ns0;
+    uint64_t now;
+    uint32_t stamp;
+    int64_t age;
+
+    TEST_CHECK(timebase_hz() == CPU_CLOCK_HZ);
+
+    timebase_set_divider(4u);
+    TEST_CHECK(Cy_SysClk_ClkHfSetDivider(1u, CY_SYSCLK_CLKHF_DIVIDE_BY_4) == CY_SYSCLK_SUCCESS);
+    TEST_CHECK(timebase_hz() == CPU_CLOCK_HZ);
+    SystemCoreClockUpdate();
+    TEST_CHECK(SystemCoreClock == (CPU_CLOCK_HZ / 4u));
+    TEST_CHECK(timebase_hz() == CPU_CLOCK_HZ);
+
+    ticks0 = timebase_now();
+    ns0 = host_ns();
+    sleep_ms(LONG_WAIT_MS);
+    check_elapsed(ticks0, ns0, timebase_now(), host_ns());
+
+    stamp = cycle_probe_now();
+    sleep_ms(20u);
+    now = timebase_now();
+    age = (int64_t)(now - timebase_extend(stamp)) - (int64_t)(20u * TICKS_PER_MS);
+    TEST_CHECK((age > -(int64_t)TOLERANCE_TICKS) && (age < (int64_t)TOLERANCE_TICKS));
+
+    timebase_set_divider(1u);
+    TEST_CHECK(Cy_SysClk_ClkHfSetDivider(1u, CY_SYSCLK_CLKHF_NO_DIVIDE) == CY_SYSCLK_SUCCESS);
+    SystemCoreClockUpdate();
+    TEST_CHECK(timebase_hz() == CPU_CLOCK_HZ);
+}
+#else
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Time stamp returned by the fake clock */
+static uint32_t g_fakeNow = WRAP_START;
+
+/*******************************************************************************
+* Function Name: cycle_probe_host_now
+********************************************************************************
+* Summary:
+*  Fake time stamp clock of the PC build, in place of the one of
+*  cycle_probe.c.
+*
+*******************************************************************************/
+uint32_t cycle_probe_host_now(void)
+{
+    return g_fakeNow;
+}
+
+/*******************************************************************************
+* Function Name: test_now
+********************************************************************************
+* Summary:
+*  Advances the fake clock in steps below its wrap around period, across
+*  two wrap arounds: the time base advances by each step and never wraps.
+*
+*******************************************************************************/
+static void test_now(void)
+{
+    uint64_t start = timebase_now();
+    uint64_t ticks = start;
+    uint32_t i;
+
+    for (i = 0u; i < 10u; i++)
+    {
+        g_fakeNow += LARGE_STEP;
+        TEST_CHECK(timebase_now() == (ticks + LARGE_STEP));
+        ticks += LARGE_STEP;
+    }
+
+    TEST_CHECK((ticks - start) == (10u * (uint64_t)LARGE_STEP));
+    TEST_CHECK(timebase_now() == ticks);
+    TEST_CHECK(timebase_hz() == 1000000000u);
+}
+
+/*******************************************************************************
+* Function Name: test_extend
+********************************************************************************
+* Summary:
+*  Extends time stamps older than the current time, from before a wrap
+*  around of the fake clock, and newer than the last read of the time base.
+*
+*******************************************************************************/
+static void test_extend(void)
+{
+    uint64_t ticks;
+    uint32_t stamp;
+
+    g_fakeNow = 0xFFFFFFF0u;
+    ticks = timebase_now();
+    stamp = g_fakeNow;
+
+    g_fakeNow += 0x20u;
+    TEST_CHECK(g_fakeNow == 0x10u);
+    TEST_CHECK(timebase_extend(stamp) == ticks);
+    TEST_CHECK(timebase_now() == (ticks + 0x20u));
+
+    /* Not yet seen by the time base */
+    g_fakeNow += 1000u;
+    stamp = g_fakeNow;
+    g_fakeNow += 5u;
+    TEST_CHECK(timebase_extend(stamp) == (ticks + 0x20u + 1000u));
+    TEST_CHECK(timebase_extend(g_fakeNow) == timebase_now());
+
+    /* Almost one wrap around period old */
+    stamp = g_fakeNow;
+    g_fakeNow += 0xFFFFFFF0u;
+    TEST_CHECK(timebase_now() == (timebase_extend(stamp) + 0xFFFFFFF0u));
+}
+
+/*******************************************************************************
+* Function Name: test_divider
+********************************************************************************
+* Summary:
+*  Sets a clock divider of 4: every tick of the fake clock after the change
+*  counts as 4 time base ticks, a time stamp taken after the change is
+*  extended by its undivided age, and the tick frequency does not change.
+*  The divider of 1 restores the rate.
+*
+*******************************************************************************/
+static void test_divider(void)
+{
+    uint64_t ticks = timebase_now();
+    uint32_t stamp;
+
+    g_fakeNow += 100u;
+    timebase_set_divider(4u);
+    TEST_CHECK(timebase_now() == (ticks + 100u));
+    TEST_CHECK(timebase_hz() == 1000000000u);
+
+    stamp = g_fakeNow;
+    g_fakeNow += 0x80000000u;
+    TEST_CHECK(timebase_now() == (ticks + 100u + (4u * (uint64_t)0x80000000u)));
+    TEST_CHECK(timebase_extend(stamp) == (ticks + 100u));
+
+    stamp = g_fakeNow;
+    g_fakeNow += 10u;
+    TEST_CHECK(timebase_extend(stamp) == (timebase_now() - 40u));
+
+    ticks = timebase_now();
+    timebase_set_divider(1u);
+    g_fakeNow += 100u;
+    TEST_CHECK(timebase_now() == (ticks + 100u));
+    TEST_CHECK(timebase_hz() == 1000000000u);
+}
+#endif
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the tests of the time base.
+*
+*******************************************************************************/
+int main(void)
+{
+#if defined(__ARM_ARCH)
+    TEST_CHECK(cybsp_init() == CY_RSLT_SUCCESS);
+    cycle_probe_init();
+
+    test_systick_wraps();
+    test_systick_divider();
+
+    return TEST_REPORT("test_timebase_systick");
+#else
+    test_now();
+    test_extend();
+    test_divider();
+
+    return TEST_REPORT("test_timebase");
+#endif
+}
+/* [] END OF FILE */
@@ -0,0 +1,286 @@
+/******************************************************************************
+* File Name:   test_trigger_capture.c
+*
+* Description: This file contains the host test of the pre/post-trigger capture.
+*              Randomized step and glitch signals are fed into the capture for all
+*              trigger types and compared with a direct reference implementation
+*              of the trigger conditions and the capture window.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "test_common.h"
+#include "trigger_capture.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of random signals */
+#define TEST_RUNS           (20000u)
+
+/* Longest random signal in samples */
+#define TEST_SIGNAL_MAX     (4096u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static trigger_capture_t g_capture;
+static uint16_t g_signal[TEST_SIGNAL_MAX];
+static uint16_t g_window[TRIGGER_CAPTURE_SIZE];
+static uint32_t g_rng = 1u;
+
+/*******************************************************************************
+* Function Name: next_random
+********************************************************************************
+* Summary:
+*  Returns the next value of a 32-bit xorshift generator.
+*
+*******************************************************************************/
+static uint32_t next_random(void)
+{
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 17;
+    g_rng ^= g_rng << 5;
+    return g_rng;
+}
+
+/*******************************************************************************
+* Function Name: reference_trigger
+********************************************************************************
+* Summary:
+*  Returns the index of the trigger sample of a signal, or -1 if the trigger
+*  does not fire. Edge triggers first wait for a sample on the start side of
+*  the level.
+*
+*******************************************************************************/
+static int32_t reference_trigger(const uint16_t *signal, uint32_t length, const trigger_config_t *config)
+{
+    bool armed = (config->type == TRIGGER_LEVEL) || (config->type == TRIGGER_WINDOW);
+    uint32_t i;
+
+    for (i = 0u; i < length; i++)
+    {
+        uint16_t value = signal[i];
+        bool fire;
+
+        if (!armed)
+        {
+            armed = (config->type == TRIGGER_RISING_EDGE) ? (value <= config->level) : (value >= config->level);
+            continue;
+        }
+
+        switch (config->type)
+        {
+            case TRIGGER_LEVEL:
+            case TRIGGER_RISING_EDGE:
+                fire = (value > config->level);
+                break;
+
+            case TRIGGER_FALLING_EDGE:
+                fire = (value < config->level);
+                break;
+
+            default:
+                fire = (value < config->level) || (value > config->high);
+                break;
+        }
+
+        if (fire)
+        {
+            return (int32_t)i;
+        }
+    }
+
+    return -1;
+}
+
+/*******************************************************************************
+* Function Name: make_signal
+********************************************************************************
+* Summary:
+*  Fills the signal with noise around a low level that steps to a high level
+*  in the middle, rising or falling, and sometimes adds a single-sample glitch.
+*
+*******************************************************************************/
+static void make_signal(uint32_t length, bool rising, bool glitch)
+{
+    uint32_t i;
+
+    for (i = 0u; i < length; i++)
+    {
+        bool high = ((i > (length / 2u)) == rising);
+
+        g_signal[i] = (uint16_t)((high ? 2000u : 1000u) + (next_random() % 200u));
+    }
+
+    if (glitch)
+    {
+        g_signal[next_random() % length] = (next_random() & 1u) ? 4000u : 10u;
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_random
+********************************************************************************
+* Summary:
+*  Compares the capture with the reference for random signals, trigger types,
+*  levels, and pre/post-trigger lengths, including lengths that exceed the
+*  buffer and are clamped to preSamples <= TRIGGER_CAPTURE_SIZE - 1 - postSamples.
+*
+*******************************************************************************/
+static void test_random(void)
+{
+    uint32_t typeFired[TRIGGER_TYPE_NUM] = { 0u };
+    uint32_t run;
+    uint32_t i;
+    int32_t type;
+
+    for (run = 0u; run < TEST_RUNS; run++)
+    {
+        uint32_t length = 100u + (next_random() % (TEST_SIGNAL_MAX - 100u));
+        trigger_config_t config;
+        int32_t trigger;
+        uint32_t triggerPos;
+        uint32_t windowLength;
+        bool complete;
+
+        make_signal(length, (next_random() & 1u) != 0u, (run % 7u) == 0u);
+
+        config.type = (int32_t)(run % TRIGGER_TYPE_NUM);
+        config.level = (uint16_t)(1100u + (next_random() % 1000u));
+        config.high = (uint16_t)(config.level + 200u + (next_random() % 800u));
+        config.preSamples = (uint16_t)(next_random() % 400u);
+        config.postSamples = (uint16_t)(next_random() % 400u);
+
+        trigger_capture_arm(&g_capture, &config);
+        for (i = 0u; i < length; i++)
+        {
+            trigger_capture_add(&g_capture, g_signal[i]);
+        }
+
+        trigger = reference_trigger(g_signal, length, &config);
+        complete = (trigger >= 0) && (((uint32_t)trigger + config.postSamples) < length);
+        windowLength = trigger_capture_read(&g_capture, g_window, &triggerPos);
+
+        TEST_CHECK((windowLength != 0u) == complete);
+        if (complete)
+        {
+            uint32_t preMax = TRIGGER_CAPTURE_SIZE - 1u - config.postSamples;
+            uint32_t pre = (config.preSamples < preMax) ? config.preSamples : preMax;
+            bool same = true;
+
+            if ((uint32_t)trigger < pre)
+            {
+                pre = (uint32_t)trigger;
+            }
+
+            TEST_CHECK(triggerPos == pre);
+            TEST_CHECK(windowLength == (pre + 1u + config.postSamples));
+            for (i = 0u; i < windowLength; i++)
+            {
+                same = same && (g_window[i] == g_signal[((uint32_t)trigger - pre) + i]);
+            }
+            TEST_CHECK(same);
+            TEST_CHECK(g_capture.state == TRIGGER_DONE);
+            typeFired[config.type]++;
+        }
+    }
+
+    /* Every trigger type must have been exercised */
+    for (type = 0; type < TRIGGER_TYPE_NUM; type++)
+    {
+        TEST_CHECK(typeFired[type] > 100u);
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_states
+********************************************************************************
+* Summary:
+*  Checks that a rising edge trigger ignores a signal that starts above the
+*  level, that a completed capture is frozen, and that disarming ignores the
+*  samples.
+*
+*******************************************************************************/
+static void test_states(void)
+{
+    const trigger_config_t config = { TRIGGER_RISING_EDGE, 1000u, 0u, 2u, 2u };
+    uint32_t triggerPos;
+    uint32_t i;
+
+    trigger_capture_arm(&g_capture, &config);
+    TEST_CHECK(g_capture.state == TRIGGER_ARMING);
+
+    /* Above the level from the start: no edge yet */
+    trigger_capture_add(&g_capture, 1500u);
+    TEST_CHECK(g_capture.state == TRIGGER_ARMING);
+    trigger_capture_add(&g_capture, 900u);
+    TEST_CHECK(g_capture.state == TRIGGER_ARMED);
+    trigger_capture_add(&g_capture, 1001u);
+    TEST_CHECK(g_capture.state == TRIGGER_FIRED);
+    trigger_capture_add(&g_capture, 1100u);
+    trigger_capture_add(&g_capture, 1200u);
+    TEST_CHECK(g_capture.state == TRIGGER_DONE);
+
+    /* Later samples do not change the frozen capture */
+    for (i = 0u; i < 1000u; i++)
+    {
+        trigger_capture_add(&g_capture, 0u);
+    }
+    TEST_CHECK(trigger_capture_read(&g_capture, g_window, &triggerPos) == 5u);
+    TEST_CHECK(triggerPos == 2u);
+    TEST_CHECK((g_window[0] == 1500u) && (g_window[2] == 1001u) && (g_window[4] == 1200u));
+
+    trigger_capture_disarm(&g_capture);
+    TEST_CHECK(g_capture.state == TRIGGER_IDLE);
+    trigger_capture_add(&g_capture, 4000u);
+    TEST_CHECK(trigger_capture_read(&g_capture, g_window, &triggerPos) == 0u);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the checks of the trigger capture.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_random();
+    test_states();
+
+    return TEST_REPORT("test_trigger_capture");
+}
+/* [] END OF FILE */
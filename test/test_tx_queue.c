@@ -0,0 +1,350 @@
+/******************************************************************************
+* File Name:   test_tx_queue.c
+*
+* Description: This file contains the host test of the transmit queue: messages
+*              across the wrap around of the buffer and of the indexes, the full
+*              queue, and a producer and a consumer thread that check every
+*              byte in order, the split of the contiguous data at the end of
+*              the buffer, and that only complete messages become visible.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include "test_common.h"
+#include "tx_queue.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Payload bytes written by the producer thread */
+#define TEST_PAYLOAD        (4000000u)
+
+/* Largest payload of a message; a message is a length byte and its payload */
+#define MSG_PAYLOAD_MAX     (200u)
+
+/* Index start close to the wrap around of the 32-bit indexes, not aligned
+ * to the buffer */
+#define WRAP_START          (0xFFFFFFFFu - (2u * TX_QUEUE_SIZE) - 37u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* State shared by the producer and the consumer thread */
+typedef struct
+{
+    tx_queue_t queue;
+    volatile uint32_t done;     /* Set by the producer after the last message */
+
+    /* Producer */
+    uint32_t messages;
+    uint32_t fullWrites;        /* Writes refused for lack of space */
+
+    /* Consumer */
+    uint32_t bytes;             /* Payload bytes checked */
+    uint32_t mismatches;
+    uint32_t splitPeeks;        /* Peeks ended by the end of the buffer while more was queued */
+    uint32_t partialMessages;   /* Times the queue ran empty inside a message */
+    uint32_t oversizedPeeks;
+} queue_test_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static queue_test_t g_test;
+
+/*******************************************************************************
+* Function Name: pattern
+********************************************************************************
+* Summary:
+*  Returns the expected payload byte at a position of the payload stream.
+*
+*******************************************************************************/
+static uint8_t pattern(uint32_t pos)
+{
+    return (uint8_t)(pos ^ (pos >> 8) ^ (pos >> 16));
+}
+
+/*******************************************************************************
+* Function Name: next_random
+********************************************************************************
+* Summary:
+*  Returns the next value of a 32-bit xorshift generator.
+*
+*******************************************************************************/
+static uint32_t next_random(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/*******************************************************************************
+* Function Name: test_wrap
+********************************************************************************
+* Summary:
+*  Writes and reads messages around the end of the buffer with the indexes
+*  passing their wrap around: the contiguous part ends at the end of the
+*  buffer, the rest follows from its start in order, a write that does not
+*  fit leaves the queue unchanged, and a write of the exact free space fits.
+*
+*******************************************************************************/
+static void test_wrap(void)
+{
+    tx_queue_t *queue = &g_test.queue;
+    uint8_t msg[TX_QUEUE_SIZE];
+    const uint8_t *data;
+    uint32_t head;
+    uint32_t n;
+    uint32_t i;
+
+    for (i = 0u; i < TX_QUEUE_SIZE; i++)
+    {
+        msg[i] = pattern(i);
+    }
+
+    tx_queue_reset(queue);
+    TEST_CHECK(tx_queue_peek(queue, &data) == 0u);
+
+    /* Leave 10 bytes before the end of the buffer, just before the index wrap around */
+    queue->head = 0u - TX_QUEUE_SIZE - 10u;
+    queue->tail = queue->head;
+
+    TEST_CHECK(tx_queue_write(queue, msg, 30u));
+    n = tx_queue_peek(queue, &data);
+    TEST_CHECK((n == 10u) && (data == &queue->buf[TX_QUEUE_SIZE - 10u]));
+    TEST_CHECK(memcmp(data, msg, 10u) == 0);
+    tx_queue_consume(queue, n);
+
+    n = tx_queue_peek(queue, &data);
+    TEST_CHECK((n == 20u) && (data == &queue->buf[0]));
+    TEST_CHECK(memcmp(data, &msg[10], 20u) == 0);
+    tx_queue_consume(queue, n);
+    TEST_CHECK(tx_queue_used(queue) == 0u);
+
+    /* Fill to one byte short, across the index wrap around */
+    TEST_CHECK(tx_queue_write(queue, msg, TX_QUEUE_SIZE - 1u));
+    TEST_CHECK(queue->head < queue->tail);
+    head = queue->head;
+    TEST_CHECK(!tx_queue_write(queue, msg, 2u));
+    TEST_CHECK((queue->head == head) && (tx_queue_used(queue) == (TX_QUEUE_SIZE - 1u)));
+    TEST_CHECK(tx_queue_write(queue, &msg[TX_QUEUE_SIZE - 1u], 1u));
+    TEST_CHECK(tx_queue_used(queue) == TX_QUEUE_SIZE);
+    TEST_CHECK(!tx_queue_write(queue, msg, 1u));
+
+    /* The full buffer comes out in two parts, in order */
+    n = tx_queue_peek(queue, &data);
+    TEST_CHECK((n == (TX_QUEUE_SIZE - 20u)) && (memcmp(data, msg, n) == 0));
+    tx_queue_consume(queue, n);
+    n = tx_queue_peek(queue, &data);
+    TEST_CHECK((n == 20u) && (memcmp(data, &msg[TX_QUEUE_SIZE - 20u], n) == 0));
+    tx_queue_consume(queue, n);
+    TEST_CHECK(tx_queue_used(queue) == 0u);
+}
+
+/*******************************************************************************
+* Function Name: producer
+********************************************************************************
+* Summary:
+*  Producer thread: writes messages of random length with the payload
+*  stream, and retries a message that does not fit after yielding to the
+*  consumer, like the main loop does for the stream frames.
+*
+*******************************************************************************/
+static void *producer(void *arg)
+{
+    queue_test_t *t = (queue_test_t *)arg;
+    uint8_t msg[1u + MSG_PAYLOAD_MAX];
+    uint32_t rng = 2463534242u;
+    uint32_t pos = 0u;
+    uint32_t i;
+
+    while (pos < TEST_PAYLOAD)
+    {
+        uint32_t len = 1u + (next_random(&rng) % MSG_PAYLOAD_MAX);
+
+        if (len > (TEST_PAYLOAD - pos))
+        {
+            len = TEST_PAYLOAD - pos;
+        }
+
+        msg[0] = (uint8_t)len;
+        for (i = 0u; i < len; i++)
+        {
+            msg[1u + i] = pattern(pos + i);
+        }
+
+        while (!tx_queue_write(&t->queue, msg, 1u + len))
+        {
+            t->fullWrites++;
+            (void)sched_yield();
+        }
+
+        pos += len;
+        t->messages++;
+    }
+
+    __atomic_store_n(&t->done, 1u, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: consumer
+********************************************************************************
+* Summary:
+*  Consumer thread: peeks the contiguous data, checks a random part of it
+*  byte by byte, and consumes that part, until the producer is done and the
+*  queue is empty.
+*
+*******************************************************************************/
+static void *consumer(void *arg)
+{
+    queue_test_t *t = (queue_test_t *)arg;
+    uint32_t rng = 88675123u;
+    uint32_t remaining = 0u;    /* Payload bytes left in the current message */
+    uint32_t pos = 0u;
+
+    for (;;)
+    {
+        uint32_t done = __atomic_load_n(&t->done, __ATOMIC_ACQUIRE);
+        uint32_t used = tx_queue_used(&t->queue);
+        const uint8_t *data;
+        uint32_t n = tx_queue_peek(&t->queue, &data);
+        uint32_t offset = (uint32_t)(data - t->queue.buf);
+        uint32_t i;
+
+        if (n == 0u)
+        {
+            /* Only complete messages are published */
+            t->partialMessages += (remaining != 0u) ? 1u : 0u;
+            if (done != 0u)
+            {
+                break;
+            }
+            (void)sched_yield();
+            continue;
+        }
+
+        t->oversizedPeeks += ((offset + n) > TX_QUEUE_SIZE) ? 1u : 0u;
+        t->splitPeeks += (((offset + n) == TX_QUEUE_SIZE) && (used > n)) ? 1u : 0u;
+
+        /* Random reads, like the UART FIFO taking what fits */
+        n = 1u + (next_random(&rng) % n);
+        for (i = 0u; i < n; i++)
+        {
+            if (remaining == 0u)
+            {
+                remaining = data[i];
+                t->mismatches += ((remaining == 0u) || (remaining > MSG_PAYLOAD_MAX)) ? 1u : 0u;
+            }
+            else
+            {
+                t->mismatches += (data[i] != pattern(pos)) ? 1u : 0u;
+                pos++;
+                remaining--;
+            }
+        }
+        tx_queue_consume(&t->queue, n);
+    }
+
+    t->bytes = pos;
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: test_threads
+********************************************************************************
+* Summary:
+*  Runs the producer and the consumer thread with the indexes starting close
+*  to their wrap around: every payload byte arrives in order, the queue runs
+*  full, the contiguous data is split at the end of the buffer, and no
+*  partial message is ever visible.
+*
+*******************************************************************************/
+static void test_threads(void)
+{
+    pthread_t producerThread;
+    pthread_t consumerThread;
+    bool started;
+
+    memset(&g_test, 0, sizeof(g_test));
+    g_test.queue.head = WRAP_START;
+    g_test.queue.tail = WRAP_START;
+
+    started = (pthread_create(&consumerThread, NULL, &consumer, &g_test) == 0);
+    TEST_CHECK(started);
+    if (!started)
+    {
+        return;
+    }
+    TEST_CHECK(pthread_create(&producerThread, NULL, &producer, &g_test) == 0);
+
+    (void)pthread_join(producerThread, NULL);
+    (void)pthread_join(consumerThread, NULL);
+
+    TEST_CHECK(g_test.bytes == TEST_PAYLOAD);
+    TEST_CHECK(g_test.mismatches == 0u);
+    TEST_CHECK(g_test.partialMessages == 0u);
+    TEST_CHECK(g_test.oversizedPeeks == 0u);
+    TEST_CHECK(g_test.fullWrites > 0u);
+    TEST_CHECK(g_test.splitPeeks > 0u);
+    TEST_CHECK(g_test.queue.head == g_test.queue.tail);
+    TEST_CHECK(g_test.queue.head < WRAP_START);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the tests of the transmit queue.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_wrap();
+    test_threads();
+
+    return TEST_REPORT("test_tx_queue");
+}
+/* [] END OF FILE */
@@ -0,0 +1,282 @@
+/******************************************************************************
+* File Name:   test_uart_format.c
+*
+* Description: This file contains the host test of the fixed-format integer
+*              formatter. The output is compared with glibc snprintf() for edge
+*              and random values and for complete result lines, then both are
+*              timed for the result line.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include <inttypes.h>
+#include <string.h>
+#include "test_common.h"
+#include "uart_format.h"
+#include "cycle_probe.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of random values compared per function */
+#define RANDOM_VALUES   (1000000u)
+
+/* Number of result lines built per timing run */
+#define BENCH_LINES     (200000u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const uint32_t EDGE_U32[] =
+{
+    0u, 1u, 9u, 10u, 99u, 100u, 4095u, 4096u, 65535u, 65536u,
+    999999999u, 1000000000u, 2147483647u, 2147483648u, 4294967295u
+};
+
+static const int32_t EDGE_I32[] =
+{
+    0, 1, -1, 9, -9, 10, -10, 256, -32768, 32767,
+    INT32_MAX, INT32_MIN, INT32_MIN + 1
+};
+
+/* Output format names as shown on the terminal */
+static const char *FORMAT_NAMES[] =
+{
+    "Unsigned right aligned",
+    "Signed right aligned",
+    "Unsigned left aligned",
+    "Signed left aligned"
+};
+
+static uint32_t g_rng = 0x2545F491u;
+
+/* Sink of the benchmark output, so the formatting is not optimized away */
+static volatile char g_sink;
+
+/*******************************************************************************
+* Function Name: next_random
+********************************************************************************
+* Summary:
+*  Returns the next value of a 32-bit xorshift generator.
+*
+*******************************************************************************/
+static uint32_t next_random(void)
+{
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 17;
+    g_rng ^= g_rng << 5;
+    return g_rng;
+}
+
+/*******************************************************************************
+* Function Name: check_u32
+********************************************************************************
+* Summary:
+*  Compares uart_format_u32() with snprintf("%" PRIu32) for one value.
+*
+*******************************************************************************/
+static void check_u32(uint32_t value)
+{
+    char out[UART_FORMAT_U32_MAX_LEN + 1u];
+    char ref[32];
+    uint32_t len = uart_format_u32(out, value);
+    int refLen = snprintf(ref, sizeof(ref), "%" PRIu32, value);
+
+    TEST_CHECK((len == (uint32_t)refLen) && (memcmp(out, ref, len) == 0));
+}
+
+/*******************************************************************************
+* Function Name: check_i32
+********************************************************************************
+* Summary:
+*  Compares uart_format_i32() with snprintf("%" PRId32) for one value.
+*
+*******************************************************************************/
+static void check_i32(int32_t value)
+{
+    char out[UART_FORMAT_U32_MAX_LEN + 1u];
+    char ref[32];
+    uint32_t len = uart_format_i32(out, value);
+    int refLen = snprintf(ref, sizeof(ref), "%" PRId32, value);
+
+    TEST_CHECK((len == (uint32_t)refLen) && (memcmp(out, ref, len) == 0));
+}
+
+/*******************************************************************************
+* Function Name: format_line
+********************************************************************************
+* Summary:
+*  Builds the result lines like output_result() in main.c.
+*
+*******************************************************************************/
+static uint32_t format_line(char *buf, const char *format, int32_t averageCount,
+                            uint16_t raw, uint32_t voltageMv)
+{
+    uint32_t len = 0u;
+
+    len += uart_format_str(&buf[len], "Output format: ");
+    len += uart_format_str(&buf[len], format);
+    len += uart_format_str(&buf[len], "\r\nAverage count: ");
+    len += uart_format_i32(&buf[len], averageCount);
+    len += uart_format_str(&buf[len], "\r\nConversion result raw value: 0x");
+    len += uart_format_u32(&buf[len], raw);
+    len += uart_format_str(&buf[len], "\r\nPotentiometer voltage: ");
+    len += uart_format_u32(&buf[len], voltageMv);
+    len += uart_format_str(&buf[len], "mV\r\n\x1b[4F");
+
+    return len;
+}
+
+/*******************************************************************************
+* Function Name: printf_line
+********************************************************************************
+* Summary:
+*  Builds the result lines with the printf format used before uart_format.c.
+*
+*******************************************************************************/
+static int printf_line(char *buf, size_t size, const char *format, int32_t averageCount,
+                       uint16_t raw, uint32_t voltageMv)
+{
+    return snprintf(buf, size,
+                    "Output format: %s\r\nAverage count: %" PRId32 "\r\n"
+                    "Conversion result raw value: 0x%" PRIu16 "\r\n"
+                    "Potentiometer voltage: %" PRIu32 "mV\r\n"
+                    "\x1b[4F",
+                    format, averageCount, raw, voltageMv);
+}
+
+/*******************************************************************************
+* Function Name: test_lines
+********************************************************************************
+* Summary:
+*  Compares complete result lines for all output formats, the average counts
+*  of the example and random results.
+*
+*******************************************************************************/
+static void test_lines(void)
+{
+    char out[160];
+    char ref[160];
+    uint32_t format;
+    int32_t averageCount;
+    uint32_t i;
+
+    for (format = 0u; format < (sizeof(FORMAT_NAMES) / sizeof(FORMAT_NAMES[0])); format++)
+    {
+        for (averageCount = 1; averageCount <= 256; averageCount *= 2)
+        {
+            for (i = 0u; i < 1000u; i++)
+            {
+                uint16_t raw = (uint16_t)next_random();
+                uint32_t voltageMv = next_random() % 6000u;
+                uint32_t len = format_line(out, FORMAT_NAMES[format], averageCount, raw, voltageMv);
+                int refLen = printf_line(ref, sizeof(ref), FORMAT_NAMES[format], averageCount, raw, voltageMv);
+
+                TEST_CHECK((len == (uint32_t)refLen) && (memcmp(out, ref, len) == 0));
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_lines
+********************************************************************************
+* Summary:
+*  Times building the result lines with uart_format.c and with snprintf() and
+*  prints the time per line.
+*
+*******************************************************************************/
+static void bench_lines(void)
+{
+    char buf[160];
+    uint32_t start;
+    uint32_t formatNs;
+    uint32_t printfNs;
+    uint32_t i;
+
+    start = cycle_probe_now();
+    for (i = 0u; i < BENCH_LINES; i++)
+    {
+        uint32_t len = format_line(buf, FORMAT_NAMES[i & 3u], 16, (uint16_t)i, i % 5000u);
+        g_sink = buf[len - 1u];
+    }
+    formatNs = cycle_probe_elapsed(start);
+
+    start = cycle_probe_now();
+    for (i = 0u; i < BENCH_LINES; i++)
+    {
+        int len = printf_line(buf, sizeof(buf), FORMAT_NAMES[i & 3u], 16, (uint16_t)i, i % 5000u);
+        g_sink = buf[len - 1];
+    }
+    printfNs = cycle_probe_elapsed(start);
+
+    printf("result line: uart_format %.1f ns, snprintf %.1f ns\r\n",
+           (double)formatNs / BENCH_LINES, (double)printfNs / BENCH_LINES);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the golden output checks and the timing of the formatter.
+*
+*******************************************************************************/
+int main(void)
+{
+    uint32_t i;
+
+    for (i = 0u; i < (sizeof(EDGE_U32) / sizeof(EDGE_U32[0])); i++)
+    {
+        check_u32(EDGE_U32[i]);
+    }
+    for (i = 0u; i < (sizeof(EDGE_I32) / sizeof(EDGE_I32[0])); i++)
+    {
+        check_i32(EDGE_I32[i]);
+    }
+    for (i = 0u; i < RANDOM_VALUES; i++)
+    {
+        uint32_t value = next_random();
+
+        /* Also cover the short values, random 32-bit values mostly have 10 digits */
+        check_u32(value >> (i % 32u));
+        check_i32((int32_t)value >> (i % 32u));
+    }
+    test_lines();
+
+    bench_lines();
+
+    return TEST_REPORT("test_uart_format");
+}
+/* [] END OF FILE */
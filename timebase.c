@@ -0,0 +1,277 @@
+/******************************************************************************
+* File Name:   timebase.c
+*
+* Description: This file contains the 64-bit time base. It accumulates the
+*              time stamp differences of cycle_probe_now(), scaled by the CPU
+*              clock divider, so it counts undivided CPU cycles on the target
+*              and nanoseconds on a PC, without wrapping around. With
+*              CYCLE_PROBE_SYSTICK, the SysTick interrupt counts the wrap
+*              arounds of the 24-bit counter.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "timebase.h"
+#include "cycle_probe.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Time base value */
+static uint64_t timebaseTicks = 0u;
+
+/* Time base ticks per time stamp tick, the current CPU clock divider */
+static uint32_t timebaseScale = 1u;
+
+/* Time base ticks per second, taken once at the undivided CPU clock, 0 until then */
+#if defined(__ARM_ARCH)
+static uint32_t timebaseHz = 0u;
+#else
+static uint32_t timebaseHz = 1000000000u;
+#endif
+
+#if defined(__ARM_ARCH) && (CYCLE_PROBE_SYSTICK)
+/* Wrap arounds of the SysTick counter, and the counter extended with them
+ * at the last update */
+static volatile uint32_t timebaseWraps = 0u;
+static uint64_t timebaseCount = 0u;
+#else
+/* Time stamp of the last update */
+static uint32_t timebaseLast = 0u;
+#endif
+
+/*******************************************************************************
+* Function Name: timebase_update
+********************************************************************************
+* Summary:
+*  Advances the time base to the current time stamp and returns it. Must be
+*  called with interrupts disabled.
+*
+*  With CYCLE_PROBE_SYSTICK, the 24-bit counter is extended with the wrap
+*  arounds counted by SysTick_Handler(), so the time base does not depend on
+*  how often it is read. A wrap around whose interrupt is still pending is
+*  counted here; the counter is read again after it, so that the value
+*  belongs to the counted period.
+*
+*******************************************************************************/
+static uint32_t timebase_update(void)
+{
+#if defined(__ARM_ARCH) && (CYCLE_PROBE_SYSTICK)
+    uint32_t wraps = timebaseWraps;
+    uint32_t now = cycle_probe_now();
+    uint64_t count;
+
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0u)
+    {
+        wraps++;
+        now = cycle_probe_now();
+    }
+
+    count = ((uint64_t)wraps * (CYCLE_PROBE_COUNTER_MASK + 1u)) + (now & CYCLE_PROBE_COUNTER_MASK);
+    timebaseTicks += (count - timebaseCount) * timebaseScale;
+    timebaseCount = count;
+#else
+    uint32_t now = cycle_probe_now();
+
+    timebaseTicks += (uint64_t)cycle_probe_diff(now, timebaseLast) * timebaseScale;
+    timebaseLast = now;
+#endif
+
+    return now;
+}
+
+/*******************************************************************************
+* Function Name: timebase_clock
+********************************************************************************
+* Summary:
+*  Returns the time base ticks per second. On the target, the undivided CPU
+*  clock is taken from SystemCoreClock the first time, before the divider
+*  is changed; SystemCoreClock is not updated at the same time as the
+*  divider, so it is not used afterwards.
+*
+*******************************************************************************/
+static uint32_t timebase_clock(void)
+{
+#if defined(__ARM_ARCH)
+    if (timebaseHz == 0u)
+    {
+        timebaseHz = SystemCoreClock * timebaseScale;
+    }
+#endif
+
+    return timebaseHz;
+}
+
+/*******************************************************************************
+* Function Name: timebase_now
+********************************************************************************
+* Summary:
+*  Returns the current 64-bit time. With the DWT cycle counter, the time base
+*  must be read at least once per wrap around period of the counter (2^32
+*  cycles), which the main loop does. With CYCLE_PROBE_SYSTICK, the SysTick
+*  interrupt keeps it up to date.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint64_t - Ticks since the time stamp counter was started
+*
+*******************************************************************************/
+uint64_t timebase_now(void)
+{
+    uint64_t ticks;
+#if defined(__ARM_ARCH)
+    uint32_t interruptState = Cy_SysLib_EnterCriticalSection();
+#endif
+
+    (void)timebase_update();
+    ticks = timebaseTicks;
+
+#if defined(__ARM_ARCH)
+    Cy_SysLib_ExitCriticalSection(interruptState);
+#endif
+
+    return ticks;
+}
+
+/*******************************************************************************
+* Function Name: timebase_extend
+********************************************************************************
+* Summary:
+*  Converts a 32-bit time stamp taken with cycle_probe_now() into the 64-bit
+*  time. The time stamp must not be older than one wrap around period of the
+*  counter. This lets an interrupt handler tag data with a plain counter read
+*  and leaves the extension to the consumer.
+*
+* Parameters:
+*  uint32_t timestamp - Time stamp from cycle_probe_now()
+*
+* Return:
+*  uint64_t - 64-bit time of the time stamp
+*
+*******************************************************************************/
+uint64_t timebase_extend(uint32_t timestamp)
+{
+    uint64_t ticks;
+    uint32_t now;
+#if defined(__ARM_ARCH)
+    uint32_t interruptState = Cy_SysLib_EnterCriticalSection();
+#endif
+
+    now = timebase_update();
+    ticks = timebaseTicks - ((uint64_t)cycle_probe_diff(now, timestamp) * timebaseScale);
+
+#if defined(__ARM_ARCH)
+    Cy_SysLib_ExitCriticalSection(interruptState);
+#endif
+
+    return ticks;
+}
+
+/*******************************************************************************
+* Function Name: timebase_set_divider
+********************************************************************************
+* Summary:
+*  Must be called right before the CPU clock divider is changed. The time
+*  base is advanced at the old rate, and every time stamp tick from then on
+*  counts as divider ticks, so the time base keeps counting undivided CPU
+*  cycles. A time stamp taken before the change must not be extended after
+*  it.
+*
+* Parameters:
+*  uint32_t divider - The new CPU clock divider
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void timebase_set_divider(uint32_t divider)
+{
+#if defined(__ARM_ARCH)
+    uint32_t interruptState = Cy_SysLib_EnterCriticalSection();
+#endif
+
+    (void)timebase_clock();
+    (void)timebase_update();
+    timebaseScale = divider;
+
+#if defined(__ARM_ARCH)
+    Cy_SysLib_ExitCriticalSection(interruptState);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: timebase_hz
+********************************************************************************
+* Summary:
+*  Returns the number of time base ticks per second. On the target this is
+*  the undivided CPU clock, whatever divider is set, also between
+*  timebase_set_divider() and the update of SystemCoreClock.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t - Tick frequency in Hz
+*
+*******************************************************************************/
+uint32_t timebase_hz(void)
+{
+    return timebase_clock();
+}
+
+#if defined(__ARM_ARCH) && (CYCLE_PROBE_SYSTICK)
+/*******************************************************************************
+* Function Name: SysTick_Handler
+********************************************************************************
+* Summary:
+*  SysTick interrupt handler, called at every wrap around of the counter.
+*  Counts the wrap arounds for the time base. The low-power mode, the other
+*  user of SysTick, is not available with CYCLE_PROBE_SYSTICK.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void SysTick_Handler(void)
+{
+    timebaseWraps++;
+}
+#endif
+/* [] END OF FILE */
@@ -0,0 +1,368 @@
+/******************************************************************************
+* File Name:   adc_analyze.c
+*
+* Description: This file contains the analysis program of capture files. It maps a
+*              capture file of adc_capture, analyzes the records on a number of
+*              threads, and reports the statistics and the spectrum; it can also
+*              measure how the analysis scales with the number of threads.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <errno.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "analyze.h"
+#include "signal_source.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Time base frequency and sample period of the synthetic records */
+#define SYNTH_TICK_HZ       (320000000u)
+#define SYNTH_SAMPLE_TICKS  (3200u)
+
+/* Samples per block of the synthetic records, like the stream */
+#define SYNTH_BLOCK         (32u)
+
+/* Runs per thread count of the scaling benchmark, the fastest counts */
+#define BENCH_RUNS          (3u)
+
+/*******************************************************************************
+* Function Name: now_seconds
+********************************************************************************
+* Summary:
+*  Returns the monotonic time in seconds.
+*
+*******************************************************************************/
+static double now_seconds(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+/*******************************************************************************
+* Function Name: synthesize
+********************************************************************************
+* Summary:
+*  Returns records of the synthetic sine, for the benchmark without a capture.
+*
+*******************************************************************************/
+static capture_record_t *synthesize(uint64_t count)
+{
+    capture_record_t *rec = (capture_record_t *)calloc((size_t)count, sizeof(capture_record_t));
+    signal_source_t src;
+    uint64_t i;
+
+    if (rec == NULL)
+    {
+        return NULL;
+    }
+
+    signal_source_init(&src, SIGNAL_SINE, 42u);
+    for (i = 0u; i < count; i++)
+    {
+        rec[i].time = (i - (i % SYNTH_BLOCK)) * SYNTH_SAMPLE_TICKS;
+        rec[i].result = signal_source_next_result(&src, 1u, 0u, UNSIGNED_RIGHT_ALIGNED);
+        rec[i].averageCount = 1u;
+        rec[i].outputFormat = UNSIGNED_RIGHT_ALIGNED;
+        rec[i].index = (uint8_t)(i % SYNTH_BLOCK);
+    }
+
+    return rec;
+}
+
+/*******************************************************************************
+* Function Name: sample_rate
+********************************************************************************
+* Summary:
+*  Estimates the sample rate from the first two consecutive blocks with a
+*  valid time.
+*
+* Return:
+*  double - Samples per second, 0 if unknown
+*
+*******************************************************************************/
+static double sample_rate(const capture_record_t *rec, uint64_t count, uint32_t tickHz)
+{
+    uint64_t i;
+    uint64_t n;
+
+    for (i = 0u; i < count; i++)
+    {
+        if ((rec[i].index != 0u) || ((rec[i].flags & CAPTURE_FLAG_TIME_INVALID) != 0u))
+        {
+            continue;
+        }
+
+        for (n = 1u; ((i + n) < count) && (rec[i + n].index == n); n++)
+        {
+        }
+
+        if (((i + n) < count) && (rec[i + n].index == 0u) && (rec[i + n].time > rec[i].time) &&
+            ((rec[i + n].flags & CAPTURE_FLAG_TIME_INVALID) == 0u))
+        {
+            return ((double)tickHz * (double)n) / (double)(rec[i + n].time - rec[i].time);
+        }
+    }
+
+    return 0.0;
+}
+
+/*******************************************************************************
+* Function Name: report
+********************************************************************************
+* Summary:
+*  Prints the statistics and the spectral peak, and the spectrum as CSV lines
+*  to the standard output if requested.
+*
+*******************************************************************************/
+static void report(const analyze_result_t *res, double rateHz, bool spectrum)
+{
+    const adc_stats_t *st = &res->stats;
+    uint32_t peak = 1u;
+    uint32_t i;
+
+    fprintf(stderr, "%" PRIu32 " records, %" PRIu64 " without a valid time\n", st->count, res->invalidTime);
+    if (st->count != 0u)
+    {
+        fprintf(stderr, "min %u, mean %.3f, max %u, standard deviation %.3f counts\n", st->min, st->mean,
+                st->max, sqrt(adc_stats_variance(st)));
+    }
+    if (res->segments == 0u)
+    {
+        return;
+    }
+
+    for (i = 2u; i < ANALYZE_BINS; i++)
+    {
+        peak = (res->power[i] > res->power[peak]) ? i : peak;
+    }
+    fprintf(stderr, "spectrum of %" PRIu64 " segments of %u: peak at bin %" PRIu32 " (%.6f Hz), %.1f dB\n",
+            res->segments, ANALYZE_FFT_SIZE, peak, ((double)peak * rateHz) / ANALYZE_FFT_SIZE,
+            10.0 * log10(res->power[peak] + 1e-30));
+
+    if (spectrum)
+    {
+        printf("bin,frequency_hz,power_db\n");
+        for (i = 0u; i < ANALYZE_BINS; i++)
+        {
+            printf("%" PRIu32 ",%.6f,%.3f\n", i, ((double)i * rateHz) / ANALYZE_FFT_SIZE,
+                   10.0 * log10(res->power[i] + 1e-30));
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench
+********************************************************************************
+* Summary:
+*  Times the analysis with 1, 2, 4, ... up to maxThreads threads and prints
+*  the scaling as CSV lines.
+*
+*******************************************************************************/
+static int bench(const capture_record_t *rec, uint64_t count, uint32_t maxThreads)
+{
+    static analyze_result_t res;
+    double base = 0.0;
+    double best;
+    double t;
+    uint32_t threads;
+    uint32_t r;
+
+    printf("threads,seconds,records_per_s,speedup,efficiency\n");
+    threads = 1u;
+    for (;;)
+    {
+        best = 0.0;
+        for (r = 0u; r < BENCH_RUNS; r++)
+        {
+            t = now_seconds();
+            if (analyze_run(rec, count, threads, &res) != 0)
+            {
+                return -1;
+            }
+            t = now_seconds() - t;
+            best = ((r == 0u) || (t < best)) ? t : best;
+        }
+
+        base = (threads == 1u) ? best : base;
+        printf("%" PRIu32 ",%.6f,%.0f,%.3f,%.3f\n", threads, best, (double)count / best, base / best,
+               base / best / (double)threads);
+
+        if (threads == maxThreads)
+        {
+            break;
+        }
+        threads = ((threads * 2u) < maxThreads) ? (threads * 2u) : maxThreads;
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: usage
+********************************************************************************
+* Summary:
+*  Prints the command line options.
+*
+*******************************************************************************/
+static void usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-j threads] [-s] [-B] <capture file>\n"
+                    "       %s [-j threads] [-s] [-B] -S <records>\n"
+                    "  -j  number of threads (default: online CPUs, at most %u)\n"
+                    "  -s  write the spectrum as CSV to the standard output\n"
+                    "  -B  measure the scaling from 1 thread up to -j threads, as CSV\n"
+                    "  -S  analyze records of a synthetic sine instead of a capture file\n",
+            name, name, ANALYZE_MAX_THREADS);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Analyzes a capture file or synthetic records.
+*
+*******************************************************************************/
+int main(int argc, char **argv)
+{
+    static analyze_result_t res;
+    capture_map_t map = { NULL, NULL, 0u };
+    const capture_record_t *rec;
+    capture_record_t *synthetic = NULL;
+    uint64_t count = 0u;
+    uint32_t tickHz;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t threads = (cpus < 1) ? 1u : ((cpus > (long)ANALYZE_MAX_THREADS) ? ANALYZE_MAX_THREADS : (uint32_t)cpus);
+    bool spectrum = false;
+    bool benchmark = false;
+    double t;
+    int opt;
+    int rc;
+
+    while ((opt = getopt(argc, argv, "j:sBS:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'j':
+                threads = (uint32_t)strtoul(optarg, NULL, 10);
+                break;
+            case 's':
+                spectrum = true;
+                break;
+            case 'B':
+                benchmark = true;
+                break;
+            case 'S':
+                count = strtoull(optarg, NULL, 10);
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+
+    if ((threads == 0u) || (threads > ANALYZE_MAX_THREADS) || ((count == 0u) != ((argc - optind) == 1)) ||
+        ((argc - optind) > 1))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (count != 0u)
+    {
+        synthetic = synthesize(count);
+        if (synthetic == NULL)
+        {
+            perror("synthetic records");
+            return 1;
+        }
+        rec = synthetic;
+        tickHz = SYNTH_TICK_HZ;
+    }
+    else
+    {
+        if (capture_open(argv[optind], &map) != 0)
+        {
+            perror(argv[optind]);
+            return 1;
+        }
+        rec = map.records;
+        count = map.header->records;
+        tickHz = map.header->tickHz;
+    }
+
+    if (benchmark)
+    {
+        rc = bench(rec, count, threads);
+    }
+    else
+    {
+        t = now_seconds();
+        rc = analyze_run(rec, count, threads, &res);
+        t = now_seconds() - t;
+        if (rc == 0)
+        {
+            report(&res, sample_rate(rec, count, tickHz), spectrum);
+            fprintf(stderr, "%" PRIu32 " threads, %.3f s, %.0f records/s\n", threads, t, (double)count / t);
+        }
+    }
+    if (rc != 0)
+    {
+        perror("analysis");
+    }
+
+    free(synthetic);
+    if (map.header != NULL)
+    {
+        capture_close(&map);
+    }
+
+    return (rc == 0) ? 0 : 1;
+}
+/* [] END OF FILE */
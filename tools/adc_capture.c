@@ -0,0 +1,255 @@
+/******************************************************************************
+* File Name:   adc_capture.c
+*
+* Description: This file contains the Linux capture program of the framed sample
+*              stream. It reads the stream from the KitProg3 serial port, a file, or
+*              the standard input, and writes the decoded samples to a memory-mapped
+*              capture file with fixed-size records.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#if !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include "capture.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Default capacity of the capture file: 16 M records, 256 MB */
+#define DEFAULT_CAPACITY    (16777216u)
+
+/* Default baud rate of the serial port, the rate of the firmware UART */
+#define DEFAULT_BAUD        (115200u)
+
+/*******************************************************************************
+* Function Name: baud_speed
+********************************************************************************
+* Summary:
+*  Returns the termios speed of a baud rate, or B0 if it has none.
+*
+*******************************************************************************/
+static speed_t baud_speed(unsigned long baud)
+{
+    switch (baud)
+    {
+        case 9600u:     return B9600;
+        case 19200u:    return B19200;
+        case 38400u:    return B38400;
+        case 57600u:    return B57600;
+        case 115200u:   return B115200;
+        case 230400u:   return B230400;
+        case 460800u:   return B460800;
+        case 921600u:   return B921600;
+        case 1000000u:  return B1000000;
+        case 2000000u:  return B2000000;
+        case 3000000u:  return B3000000;
+        default:        return B0;
+    }
+}
+
+/*******************************************************************************
+* Function Name: open_input
+********************************************************************************
+* Summary:
+*  Opens the stream input. A serial port is set to raw 8N1 at the given baud
+*  rate without flow control; "-" is the standard input.
+*
+*******************************************************************************/
+static int open_input(const char *path, unsigned long baud)
+{
+    struct termios tio;
+    speed_t speed = baud_speed(baud);
+    int fd;
+
+    if (strcmp(path, "-") == 0)
+    {
+        return STDIN_FILENO;
+    }
+
+    fd = open(path, O_RDONLY | O_NOCTTY);
+    if ((fd < 0) || !isatty(fd))
+    {
+        return fd;
+    }
+
+    if (speed == B0)
+    {
+        fprintf(stderr, "%s: unsupported baud rate %lu\n", path, baud);
+        (void)close(fd);
+        errno = EINVAL;
+        return -1;
+    }
+
+    if (tcgetattr(fd, &tio) != 0)
+    {
+        (void)close(fd);
+        return -1;
+    }
+    cfmakeraw(&tio);
+    tio.c_cflag |= (CLOCAL | CREAD);
+    tio.c_cflag &= ~(tcflag_t)(CSTOPB | CRTSCTS);
+    tio.c_cc[VMIN] = 1u;
+    tio.c_cc[VTIME] = 0u;
+    (void)cfsetispeed(&tio, speed);
+    (void)cfsetospeed(&tio, speed);
+    if ((tcsetattr(fd, TCSANOW, &tio) != 0) || (tcflush(fd, TCIFLUSH) != 0))
+    {
+        (void)close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+/*******************************************************************************
+* Function Name: on_signal
+********************************************************************************
+* Summary:
+*  Ends the capture on SIGINT or SIGTERM; the file keeps the samples received.
+*
+*******************************************************************************/
+static void on_signal(int sig)
+{
+    (void)sig;
+    capture_stop();
+}
+
+/*******************************************************************************
+* Function Name: usage
+********************************************************************************
+* Summary:
+*  Prints the command line options.
+*
+*******************************************************************************/
+static void usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-b baud] [-n records] [-q] <serial port|stream file|-> <capture file>\n"
+                    "  -b  baud rate of a serial port (default %u)\n"
+                    "  -n  capacity of the capture file in records (default %u)\n"
+                    "  -q  no progress output\n", name, DEFAULT_BAUD, DEFAULT_CAPACITY);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Captures the stream until its end, Ctrl+C, or until the capture file is
+*  full, then reports the receive statistics and the throughput.
+*
+*******************************************************************************/
+int main(int argc, char **argv)
+{
+    capture_options_t options = { .path = NULL, .capacity = DEFAULT_CAPACITY, .progress = true };
+    const stream_decoder_stats_t *st;
+    capture_result_t result;
+    struct sigaction sa;
+    unsigned long baud = DEFAULT_BAUD;
+    int opt;
+    int fd;
+
+    while ((opt = getopt(argc, argv, "b:n:q")) != -1)
+    {
+        switch (opt)
+        {
+            case 'b':
+                baud = strtoul(optarg, NULL, 10);
+                break;
+            case 'n':
+                options.capacity = strtoull(optarg, NULL, 10);
+                break;
+            case 'q':
+                options.progress = false;
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+
+    if (((argc - optind) != 2) || (options.capacity == 0u))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+    options.path = argv[optind + 1];
+
+    fd = open_input(argv[optind], baud);
+    if (fd < 0)
+    {
+        perror(argv[optind]);
+        return 1;
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = &on_signal;
+    (void)sigemptyset(&sa.sa_mask);
+    (void)sigaction(SIGINT, &sa, NULL);
+    (void)sigaction(SIGTERM, &sa, NULL);
+
+    if (capture_run(fd, &options, &result) != 0)
+    {
+        perror(options.path);
+        return 1;
+    }
+
+    st = &result.stream;
+    fprintf(stderr, "%" PRIu64 " records in %s%s\n", result.records, options.path,
+            result.full ? " (full)" : "");
+    fprintf(stderr, "%" PRIu64 " bytes, %" PRIu64 " frames (%" PRIu64 " configuration), %" PRIu64 " samples\n",
+            st->bytes, st->frames, st->configFrames, st->samples);
+    fprintf(stderr, "CRC errors %" PRIu64 ", malformed %" PRIu64 ", lost %" PRIu64 ", duplicates %" PRIu64
+            ", skipped bytes %" PRIu64 "\n", st->crcErrors, st->malformed, st->lostFrames, st->duplicates,
+            st->skippedBytes);
+    if (result.seconds > 0.0)
+    {
+        fprintf(stderr, "%.3f s, %.1f kB/s, %.0f samples/s\n", result.seconds,
+                (double)st->bytes / 1000.0 / result.seconds, (double)st->samples / result.seconds);
+    }
+
+    return ((st->crcErrors | st->malformed | st->lostFrames) != 0u) ? 1 : 0;
+}
+/* [] END OF FILE */
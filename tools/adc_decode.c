@@ -0,0 +1,125 @@
+/******************************************************************************
+* File Name:   adc_decode.c
+*
+* Description: This file contains the host decoder program of the framed sample
+*              stream. It reads a stream recorded from the UART, writes the samples
+*              in CSV format, and reports the frame statistics and the compression
+*              ratio.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include <stdio.h>
+#include <inttypes.h>
+#include "stream_decoder.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Bytes read from the input at once */
+#define READ_SIZE (4096u)
+
+/*******************************************************************************
+* Function Name: print_block
+********************************************************************************
+* Summary:
+*  Writes the samples of a decoded frame as CSV lines: sequence number, time
+*  of the first sample of the frame in seconds, whether that time is known,
+*  index of the sample in the frame, and the result.
+*
+*******************************************************************************/
+static void print_block(void *context, const stream_decoder_block_t *block)
+{
+    FILE *out = (FILE *)context;
+    double timeS = (double)block->time / (double)block->config->tickHz;
+    uint32_t i;
+
+    for (i = 0u; i < block->count; i++)
+    {
+        fprintf(out, "%u,%.9f,%u,%" PRIu32 ",%u\n", block->sequence, timeS, block->timeValid ? 1u : 0u,
+                i, block->samples[i]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Decodes the file given as the argument, or the standard input.
+*
+*******************************************************************************/
+int main(int argc, char **argv)
+{
+    static stream_decoder_t dec;
+    uint8_t buf[READ_SIZE];
+    const stream_decoder_stats_t *st = &dec.stats;
+    FILE *in = stdin;
+    size_t n;
+
+    if (argc > 2)
+    {
+        fprintf(stderr, "usage: %s [stream file]\n", argv[0]);
+        return 2;
+    }
+
+    if ((argc == 2) && ((in = fopen(argv[1], "rb")) == NULL))
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    stream_decoder_init(&dec, &print_block, stdout);
+    printf("sequence,time_s,time_valid,sample,result\n");
+
+    while ((n = fread(buf, 1u, sizeof(buf), in)) != 0u)
+    {
+        stream_decoder_feed(&dec, buf, (uint32_t)n);
+    }
+
+    fprintf(stderr, "%" PRIu64 " bytes, %" PRIu64 " frames (%" PRIu64 " configuration), %" PRIu64 " samples\n",
+            st->bytes, st->frames, st->configFrames, st->samples);
+    fprintf(stderr, "CRC errors %" PRIu64 ", malformed %" PRIu64 ", lost %" PRIu64 ", duplicates %" PRIu64
+            ", skipped bytes %" PRIu64 "\n", st->crcErrors, st->malformed, st->lostFrames, st->duplicates,
+            st->skippedBytes);
+    if (st->samples != 0u)
+    {
+        /* Relative to 16-bit binary samples, including the frames and time stamps */
+        fprintf(stderr, "%.3f bytes per sample, compression ratio %.2f:1\n",
+                (double)st->bytes / (double)st->samples, (double)(2u * st->samples) / (double)st->bytes);
+    }
+
+    return ((st->crcErrors | st->malformed | st->lostFrames) != 0u) ? 1 : 0;
+}
+/* [] END OF FILE */
@@ -0,0 +1,357 @@
+/******************************************************************************
+* File Name:   analyze.c
+*
+* Description: This file contains the multithreaded analysis of capture files. The
+*              records are split into chunks that the threads take from a shared
+*              counter; each chunk gets its own statistics, which are merged in
+*              chunk order, so the result does not depend on the number of threads.
+*              The spectrum is the mean periodogram of Hann windowed segments.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include "analyze.h"
+
+_Static_assert((ANALYZE_CHUNK_RECORDS % ANALYZE_FFT_SIZE) == 0u, "segments must not cross chunks");
+_Static_assert((ANALYZE_FFT_SIZE & (ANALYZE_FFT_SIZE - 1u)) == 0u, "ANALYZE_FFT_SIZE must be a power of two");
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define ANALYZE_PI  (3.14159265358979323846)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Work shared by the threads */
+typedef struct
+{
+    const capture_record_t *records;
+    uint64_t count;
+    uint64_t chunks;
+    atomic_uint_fast64_t next;          /* Next chunk to be taken */
+    adc_stats_t *chunkStats;            /* Statistics of each chunk */
+    uint64_t *chunkInvalid;             /* Records without a valid time in each chunk */
+    double window[ANALYZE_FFT_SIZE];    /* Hann window */
+    double windowPower;                 /* Sum of the squared window values */
+    double cosTable[ANALYZE_FFT_SIZE / 2u];
+    double sinTable[ANALYZE_FFT_SIZE / 2u];
+} analyze_job_t;
+
+/* One thread and the spectrum of the segments it analyzed */
+typedef struct
+{
+    analyze_job_t *job;
+    pthread_t thread;
+    uint64_t segments;
+    double power[ANALYZE_BINS];
+} analyze_worker_t;
+
+/*******************************************************************************
+* Function Name: analyze_fft
+********************************************************************************
+* Summary:
+*  In-place radix-2 FFT of ANALYZE_FFT_SIZE complex values.
+*
+*******************************************************************************/
+static void analyze_fft(const analyze_job_t *job, double *re, double *im)
+{
+    uint32_t i;
+    uint32_t j = 0u;
+    uint32_t bit;
+    uint32_t len;
+    uint32_t k;
+    double t;
+
+    for (i = 1u; i < ANALYZE_FFT_SIZE; i++)
+    {
+        for (bit = ANALYZE_FFT_SIZE >> 1; (j & bit) != 0u; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j |= bit;
+
+        if (i < j)
+        {
+            t = re[i]; re[i] = re[j]; re[j] = t;
+            t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+    }
+
+    for (len = 2u; len <= ANALYZE_FFT_SIZE; len <<= 1)
+    {
+        uint32_t half = len >> 1;
+        uint32_t step = ANALYZE_FFT_SIZE / len;
+
+        for (i = 0u; i < ANALYZE_FFT_SIZE; i += len)
+        {
+            for (k = 0u; k < half; k++)
+            {
+                double wr = job->cosTable[k * step];
+                double wi = job->sinTable[k * step];
+                double xr = (re[i + k + half] * wr) - (im[i + k + half] * wi);
+                double xi = (re[i + k + half] * wi) + (im[i + k + half] * wr);
+
+                re[i + k + half] = re[i + k] - xr;
+                im[i + k + half] = im[i + k] - xi;
+                re[i + k] += xr;
+                im[i + k] += xi;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: analyze_segment
+********************************************************************************
+* Summary:
+*  Adds the periodogram of one segment, without its mean, to the spectrum of
+*  a worker.
+*
+*******************************************************************************/
+static void analyze_segment(analyze_worker_t *worker, const capture_record_t *rec)
+{
+    const analyze_job_t *job = worker->job;
+    double re[ANALYZE_FFT_SIZE];
+    double im[ANALYZE_FFT_SIZE];
+    double mean = 0.0;
+    double scale;
+    uint32_t i;
+
+    for (i = 0u; i < ANALYZE_FFT_SIZE; i++)
+    {
+        mean += (double)rec[i].result;
+    }
+    mean /= (double)ANALYZE_FFT_SIZE;
+
+    for (i = 0u; i < ANALYZE_FFT_SIZE; i++)
+    {
+        re[i] = ((double)rec[i].result - mean) * job->window[i];
+        im[i] = 0.0;
+    }
+
+    analyze_fft(job, re, im);
+
+    /* One-sided: the bins between DC and half the sample rate hold both halves */
+    for (i = 0u; i < ANALYZE_BINS; i++)
+    {
+        scale = ((i == 0u) || (i == (ANALYZE_FFT_SIZE / 2u))) ? 1.0 : 2.0;
+        worker->power[i] += scale * ((re[i] * re[i]) + (im[i] * im[i])) / job->windowPower;
+    }
+    worker->segments++;
+}
+
+/*******************************************************************************
+* Function Name: analyze_worker
+********************************************************************************
+* Summary:
+*  Thread function: takes chunks from the shared counter until none is left,
+*  and analyzes them. Taking the next free chunk balances the load like work
+*  stealing does, since all chunks have the same size.
+*
+*******************************************************************************/
+static void *analyze_worker(void *arg)
+{
+    analyze_worker_t *worker = (analyze_worker_t *)arg;
+    analyze_job_t *job = worker->job;
+    const capture_record_t *rec;
+    adc_stats_t *stats;
+    uint64_t chunk;
+    uint64_t size;
+    uint64_t invalid;
+    uint64_t i;
+
+    while ((chunk = atomic_fetch_add(&job->next, 1u)) < job->chunks)
+    {
+        rec = &job->records[chunk * ANALYZE_CHUNK_RECORDS];
+        size = job->count - (chunk * ANALYZE_CHUNK_RECORDS);
+        size = (size > ANALYZE_CHUNK_RECORDS) ? ANALYZE_CHUNK_RECORDS : size;
+        stats = &job->chunkStats[chunk];
+        invalid = 0u;
+
+        adc_stats_reset(stats);
+        for (i = 0u; i < size; i++)
+        {
+            adc_stats_add(stats, rec[i].result);
+            invalid += ((rec[i].flags & CAPTURE_FLAG_TIME_INVALID) != 0u) ? 1u : 0u;
+        }
+        job->chunkInvalid[chunk] = invalid;
+
+        for (i = 0u; (i + ANALYZE_FFT_SIZE) <= size; i += ANALYZE_FFT_SIZE)
+        {
+            analyze_segment(worker, &rec[i]);
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: analyze_run
+********************************************************************************
+* Summary:
+*  Analyzes records on a number of threads: statistics of the results, the
+*  records without a valid time, and the spectrum of the full segments. The
+*  calling thread is one of them. The statistics do not depend on the number
+*  of threads; the spectrum only differs by the rounding of its sums.
+*
+* Parameters:
+*  const capture_record_t *records  - Records, for example of capture_open()
+*  uint64_t count                   - Number of records
+*  uint32_t threads                 - 1 to ANALYZE_MAX_THREADS
+*  analyze_result_t *result         - Receives the analysis
+*
+* Return:
+*  int - 0 on success, -1 with errno set on failure
+*
+*******************************************************************************/
+int analyze_run(const capture_record_t *records, uint64_t count, uint32_t threads, analyze_result_t *result)
+{
+    analyze_worker_t *workers;
+    analyze_job_t *job;
+    uint32_t started;
+    uint32_t i;
+    uint64_t c;
+
+    if ((threads == 0u) || (threads > ANALYZE_MAX_THREADS))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    /* adc_stats_t counts up to 2^32 - 1 results */
+    if (count > UINT32_MAX)
+    {
+        errno = EOVERFLOW;
+        return -1;
+    }
+
+    job = (analyze_job_t *)malloc(sizeof(*job));
+    workers = (analyze_worker_t *)calloc(threads, sizeof(*workers));
+    if ((job == NULL) || (workers == NULL))
+    {
+        free(job);
+        free(workers);
+        errno = ENOMEM;
+        return -1;
+    }
+
+    job->records = records;
+    job->count = count;
+    job->chunks = (count + ANALYZE_CHUNK_RECORDS - 1u) / ANALYZE_CHUNK_RECORDS;
+    atomic_init(&job->next, 0u);
+    job->chunkStats = (adc_stats_t *)malloc((size_t)(job->chunks + 1u) * sizeof(adc_stats_t));
+    job->chunkInvalid = (uint64_t *)malloc((size_t)(job->chunks + 1u) * sizeof(uint64_t));
+    if ((job->chunkStats == NULL) || (job->chunkInvalid == NULL))
+    {
+        free(job->chunkStats);
+        free(job->chunkInvalid);
+        free(job);
+        free(workers);
+        errno = ENOMEM;
+        return -1;
+    }
+
+    job->windowPower = 0.0;
+    for (i = 0u; i < ANALYZE_FFT_SIZE; i++)
+    {
+        job->window[i] = 0.5 - (0.5 * cos((2.0 * ANALYZE_PI * (double)i) / (double)ANALYZE_FFT_SIZE));
+        job->windowPower += job->window[i] * job->window[i];
+    }
+    for (i = 0u; i < (ANALYZE_FFT_SIZE / 2u); i++)
+    {
+        job->cosTable[i] = cos((2.0 * ANALYZE_PI * (double)i) / (double)ANALYZE_FFT_SIZE);
+        job->sinTable[i] = -sin((2.0 * ANALYZE_PI * (double)i) / (double)ANALYZE_FFT_SIZE);
+    }
+
+    /* A thread that cannot be created leaves its chunks to the others */
+    for (i = 0u; i < threads; i++)
+    {
+        workers[i].job = job;
+    }
+    for (started = 1u; started < threads; started++)
+    {
+        if (pthread_create(&workers[started].thread, NULL, &analyze_worker, &workers[started]) != 0)
+        {
+            break;
+        }
+    }
+    (void)analyze_worker(&workers[0]);
+    for (i = 1u; i < started; i++)
+    {
+        (void)pthread_join(workers[i].thread, NULL);
+    }
+
+    adc_stats_reset(&result->stats);
+    result->invalidTime = 0u;
+    result->segments = 0u;
+    memset(result->power, 0, sizeof(result->power));
+
+    for (c = 0u; c < job->chunks; c++)
+    {
+        adc_stats_merge(&result->stats, &job->chunkStats[c]);
+        result->invalidTime += job->chunkInvalid[c];
+    }
+    for (i = 0u; i < threads; i++)
+    {
+        result->segments += workers[i].segments;
+        for (c = 0u; c < ANALYZE_BINS; c++)
+        {
+            result->power[c] += workers[i].power[c];
+        }
+    }
+    for (c = 0u; (c < ANALYZE_BINS) && (result->segments != 0u); c++)
+    {
+        result->power[c] /= (double)result->segments;
+    }
+
+    free(job->chunkStats);
+    free(job->chunkInvalid);
+    free(job);
+    free(workers);
+
+    return 0;
+}
+/* [] END OF FILE */
@@ -0,0 +1,92 @@
+/******************************************************************************
+* File Name:   analyze.h
+*
+* Description: This file contains the definitions of the multithreaded analysis of
+*              capture files.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ANALYZE_H
+#define ANALYZE_H
+
+#include <stdint.h>
+#include "adc_result.h"
+#include "capture.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Records per chunk, the unit of work of the threads */
+#define ANALYZE_CHUNK_RECORDS   (65536u)
+
+/* Size of the FFT segments of the spectrum, a power of two that divides
+ * ANALYZE_CHUNK_RECORDS
+ */
+#define ANALYZE_FFT_SIZE        (1024u)
+
+/* Bins of the one-sided spectrum, DC to half the sample rate */
+#define ANALYZE_BINS            ((ANALYZE_FFT_SIZE / 2u) + 1u)
+
+/* Maximum number of threads */
+#define ANALYZE_MAX_THREADS     (64u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Analysis of a sequence of records */
+typedef struct
+{
+    adc_stats_t stats;              /* Statistics of the results */
+    uint64_t invalidTime;           /* Records without a valid time */
+    uint64_t segments;              /* FFT segments in the spectrum */
+    double power[ANALYZE_BINS];     /* Mean power of the segments, in squared counts per bin */
+} analyze_result_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+int analyze_run(const capture_record_t *records, uint64_t count, uint32_t threads, analyze_result_t *result);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* ANALYZE_H */
+/* [] END OF FILE */
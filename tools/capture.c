@@ -0,0 +1,499 @@
+/******************************************************************************
+* File Name:   capture.c
+*
+* Description: This file contains the capture of the framed sample stream into a
+*              memory-mapped file. A reader thread only reads the serial port or
+*              file and queues the bytes in a single-producer single-consumer byte
+*              queue; the calling thread decodes them and writes the records into
+*              the mapped file, so writing to the disk never blocks the reading.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "capture.h"
+#include "tx_queue.h"
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "The capture file layout is little endian"
+#endif
+
+_Static_assert(sizeof(capture_header_t) == 128u, "capture_header_t must stay 128 bytes");
+_Static_assert(sizeof(capture_record_t) == 16u, "capture_record_t must stay 16 bytes");
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Bytes read from the stream at once */
+#define CAPTURE_READ_SIZE   (4096u)
+
+/* Time the reader waits for data before it checks for a stop request, in ms */
+#define CAPTURE_POLL_MS     (100)
+
+/* Time the threads wait for the other side of the queue, in ns */
+#define CAPTURE_WAIT_NS     (200000L)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* State shared by the reader thread and the writer */
+typedef struct
+{
+    int fd;
+    int error;              /* errno of a failed read, 0 if none */
+    atomic_bool done;       /* The reader has queued its last bytes */
+    atomic_bool closed;     /* The writer no longer empties the queue */
+    tx_queue_t queue;
+} capture_reader_t;
+
+/* Writer state, the context of the decoder callback */
+typedef struct
+{
+    capture_header_t *header;
+    capture_record_t *records;
+    uint64_t count;
+    bool full;
+} capture_writer_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Set by capture_stop(), also from a signal handler */
+static atomic_bool g_captureStop;
+
+/*******************************************************************************
+* Function Name: capture_wait
+********************************************************************************
+* Summary:
+*  Waits CAPTURE_WAIT_NS for the other thread.
+*
+*******************************************************************************/
+static void capture_wait(void)
+{
+    const struct timespec wait = { 0, CAPTURE_WAIT_NS };
+
+    (void)nanosleep(&wait, NULL);
+}
+
+/*******************************************************************************
+* Function Name: capture_seconds
+********************************************************************************
+* Summary:
+*  Returns the monotonic time in seconds.
+*
+*******************************************************************************/
+static double capture_seconds(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+/*******************************************************************************
+* Function Name: capture_read
+********************************************************************************
+* Summary:
+*  Reader thread: queues the bytes of the stream until its end, a read error,
+*  or a stop request. The end of a file, and the hang-up of a serial port or
+*  pseudo terminal (EIO), end the stream. When the queue is full, the reader
+*  waits for the writer, which only copies into memory, instead of dropping
+*  bytes; bytes already read are queued even after a stop request.
+*
+*******************************************************************************/
+static void *capture_read(void *arg)
+{
+    capture_reader_t *rd = (capture_reader_t *)arg;
+    struct pollfd pfd = { .fd = rd->fd, .events = POLLIN, .revents = 0 };
+    uint8_t buf[CAPTURE_READ_SIZE];
+    ssize_t n;
+    int ready;
+
+    while (!atomic_load(&g_captureStop))
+    {
+        ready = poll(&pfd, 1u, CAPTURE_POLL_MS);
+        if ((ready < 0) && (errno != EINTR))
+        {
+            rd->error = errno;
+            break;
+        }
+        if (ready <= 0)
+        {
+            continue;
+        }
+
+        n = read(rd->fd, buf, sizeof(buf));
+        if (n < 0)
+        {
+            if ((errno == EINTR) || (errno == EAGAIN))
+            {
+                continue;
+            }
+            rd->error = (errno == EIO) ? 0 : errno;
+            break;
+        }
+        if (n == 0)
+        {
+            break;
+        }
+
+        while (!tx_queue_write(&rd->queue, buf, (uint32_t)n) && !atomic_load(&rd->closed))
+        {
+            capture_wait();
+        }
+    }
+
+    atomic_store(&rd->done, true);
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: capture_record
+********************************************************************************
+* Summary:
+*  Decoder callback: writes the samples of a block as records into the mapped
+*  file, until it is full.
+*
+*******************************************************************************/
+static void capture_record(void *context, const stream_decoder_block_t *block)
+{
+    capture_writer_t *wr = (capture_writer_t *)context;
+    capture_record_t *rec;
+    uint32_t i;
+
+    if (wr->header->tickHz == 0u)
+    {
+        wr->header->tickHz = block->config->tickHz;
+    }
+
+    for (i = 0u; i < block->count; i++)
+    {
+        if (wr->count == wr->header->capacity)
+        {
+            wr->full = true;
+            return;
+        }
+
+        rec = &wr->records[wr->count++];
+        rec->time = block->time;
+        rec->result = block->samples[i];
+        rec->averageCount = block->config->averageCount;
+        rec->outputFormat = block->config->outputFormat;
+        rec->index = (uint8_t)i;
+        rec->flags = block->timeValid ? 0u : CAPTURE_FLAG_TIME_INVALID;
+        rec->reserved = 0u;
+    }
+}
+
+/*******************************************************************************
+* Function Name: capture_run
+********************************************************************************
+* Summary:
+*  Captures the stream read from a file descriptor into a new capture file
+*  until the end of the stream, capture_stop(), or until the file is full.
+*  The file is preallocated for options->capacity records and mapped as a
+*  whole, then truncated to the records written; its header holds the
+*  record count and the receive statistics.
+*
+* Parameters:
+*  int fd                              - Serial port, pseudo terminal, file, or pipe
+*  const capture_options_t *options    - Capture settings
+*  capture_result_t *result            - Receives the outcome
+*
+* Return:
+*  int - 0 on success, -1 with errno set on failure
+*
+*******************************************************************************/
+int capture_run(int fd, const capture_options_t *options, capture_result_t *result)
+{
+    static stream_decoder_t dec;
+    const size_t mapSize = sizeof(capture_header_t) + ((size_t)options->capacity * sizeof(capture_record_t));
+    capture_reader_t *rd;
+    capture_writer_t wr;
+    pthread_t reader;
+    const uint8_t *data;
+    uint32_t size;
+    double start;
+    double lastProgress;
+    void *map;
+    int out;
+    int err;
+
+    out = open(options->path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (out < 0)
+    {
+        return -1;
+    }
+
+    if (ftruncate(out, (off_t)mapSize) != 0)
+    {
+        err = errno;
+        (void)close(out);
+        errno = err;
+        return -1;
+    }
+
+    map = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, out, 0);
+    rd = (capture_reader_t *)malloc(sizeof(*rd));
+    if ((map == MAP_FAILED) || (rd == NULL))
+    {
+        err = (rd == NULL) ? ENOMEM : errno;
+        free(rd);
+        if (map != MAP_FAILED)
+        {
+            (void)munmap(map, mapSize);
+        }
+        (void)close(out);
+        errno = err;
+        return -1;
+    }
+    (void)posix_madvise(map, mapSize, POSIX_MADV_SEQUENTIAL);
+
+    wr.header = (capture_header_t *)map;
+    wr.records = (capture_record_t *)((uint8_t *)map + sizeof(capture_header_t));
+    wr.count = 0u;
+    wr.full = false;
+    memset(wr.header, 0, sizeof(*wr.header));
+    memcpy(wr.header->magic, CAPTURE_MAGIC, sizeof(wr.header->magic));
+    wr.header->version = CAPTURE_VERSION;
+    wr.header->headerSize = (uint32_t)sizeof(capture_header_t);
+    wr.header->recordSize = (uint32_t)sizeof(capture_record_t);
+    wr.header->capacity = options->capacity;
+
+    stream_decoder_init(&dec, &capture_record, &wr);
+    rd->fd = fd;
+    rd->error = 0;
+    atomic_init(&rd->done, false);
+    atomic_init(&rd->closed, false);
+    tx_queue_reset(&rd->queue);
+    atomic_store(&g_captureStop, false);
+
+    start = capture_seconds();
+    lastProgress = start;
+
+    err = pthread_create(&reader, NULL, &capture_read, rd);
+    if (err != 0)
+    {
+        atomic_store(&rd->done, true);
+    }
+
+    while (err == 0)
+    {
+        /* Read the flag first: once it is set, the queue holds the last bytes */
+        bool done = atomic_load(&rd->done);
+
+        size = tx_queue_peek(&rd->queue, &data);
+        if (size != 0u)
+        {
+            stream_decoder_feed(&dec, data, size);
+            tx_queue_consume(&rd->queue, size);
+
+            if (wr.full)
+            {
+                atomic_store(&rd->closed, true);
+                capture_stop();
+                break;
+            }
+        }
+        else if (done)
+        {
+            break;
+        }
+        else
+        {
+            capture_wait();
+        }
+
+        if (options->progress && ((capture_seconds() - lastProgress) >= 1.0))
+        {
+            lastProgress = capture_seconds();
+            fprintf(stderr, "\r%" PRIu64 " records, %.1f kB/s, %" PRIu64 " CRC errors, %" PRIu64 " frames lost   ",
+                    wr.count, (double)dec.stats.bytes / 1000.0 / (lastProgress - start), dec.stats.crcErrors,
+                    dec.stats.lostFrames);
+        }
+    }
+
+    if (err == 0)
+    {
+        (void)pthread_join(reader, NULL);
+        err = rd->error;
+    }
+
+    wr.header->records = wr.count;
+    wr.header->bytes = dec.stats.bytes;
+    wr.header->frames = dec.stats.frames;
+    wr.header->crcErrors = dec.stats.crcErrors;
+    wr.header->lostFrames = dec.stats.lostFrames;
+    wr.header->skippedBytes = dec.stats.skippedBytes;
+
+    result->stream = dec.stats;
+    result->records = wr.count;
+    result->full = wr.full;
+    result->seconds = capture_seconds() - start;
+
+    if (options->progress)
+    {
+        fprintf(stderr, "\n");
+    }
+
+    (void)msync(map, mapSize, MS_SYNC);
+    (void)munmap(map, mapSize);
+    if ((ftruncate(out, (off_t)(sizeof(capture_header_t) + (wr.count * sizeof(capture_record_t)))) != 0) &&
+        (err == 0))
+    {
+        err = errno;
+    }
+    (void)close(out);
+    free(rd);
+
+    errno = err;
+
+    return (err == 0) ? 0 : -1;
+}
+
+/*******************************************************************************
+* Function Name: capture_stop
+********************************************************************************
+* Summary:
+*  Requests the end of a running capture. The bytes already read are still
+*  written. Can be called from a signal handler.
+*
+*******************************************************************************/
+void capture_stop(void)
+{
+    atomic_store(&g_captureStop, true);
+}
+
+/*******************************************************************************
+* Function Name: capture_open
+********************************************************************************
+* Summary:
+*  Maps a capture file for reading and checks its header.
+*
+* Parameters:
+*  const char *path    - Capture file
+*  capture_map_t *map  - Receives the header and the records
+*
+* Return:
+*  int - 0 on success, -1 with errno set on failure
+*
+*******************************************************************************/
+int capture_open(const char *path, capture_map_t *map)
+{
+    const capture_header_t *header;
+    struct stat st;
+    void *data;
+    int fd;
+    int err = 0;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    if (fstat(fd, &st) != 0)
+    {
+        err = errno;
+    }
+    else if ((size_t)st.st_size < sizeof(capture_header_t))
+    {
+        err = EINVAL;
+    }
+
+    data = (err == 0) ? mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+    if ((err == 0) && (data == MAP_FAILED))
+    {
+        err = errno;
+    }
+    (void)close(fd);
+
+    if (err != 0)
+    {
+        errno = err;
+        return -1;
+    }
+
+    header = (const capture_header_t *)data;
+    if ((memcmp(header->magic, CAPTURE_MAGIC, sizeof(header->magic)) != 0) ||
+        (header->version != CAPTURE_VERSION) || (header->headerSize != sizeof(capture_header_t)) ||
+        (header->recordSize != sizeof(capture_record_t)) ||
+        (header->records > (((size_t)st.st_size - sizeof(capture_header_t)) / sizeof(capture_record_t))))
+    {
+        (void)munmap(data, (size_t)st.st_size);
+        errno = EINVAL;
+        return -1;
+    }
+
+    map->header = header;
+    map->records = (const capture_record_t *)((const uint8_t *)data + header->headerSize);
+    map->size = (size_t)st.st_size;
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: capture_close
+********************************************************************************
+* Summary:
+*  Unmaps a capture file mapped by capture_open().
+*
+*******************************************************************************/
+void capture_close(capture_map_t *map)
+{
+    (void)munmap((void *)map->header, map->size);
+    map->header = NULL;
+    map->records = NULL;
+    map->size = 0u;
+}
+/* [] END OF FILE */
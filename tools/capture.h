@@ -0,0 +1,139 @@
+/******************************************************************************
+* File Name:   capture.h
+*
+* Description: This file contains the declarations of the capture of the framed
+*              sample stream into a memory-mapped file: the file layout with its
+*              fixed header and packed sample records, the capture itself, and the
+*              mapping of a capture file for reading.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "stream_decoder.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* First bytes of a capture file */
+#define CAPTURE_MAGIC       "ADCCAP\r\n"
+
+/* Version of the file layout */
+#define CAPTURE_VERSION     (1u)
+
+/* Record flag: the time of the block is not known, a frame was lost before it */
+#define CAPTURE_FLAG_TIME_INVALID   (1u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* File header, 128 bytes. All fields are little endian, like the host */
+typedef struct
+{
+    char magic[8];          /* CAPTURE_MAGIC */
+    uint32_t version;       /* CAPTURE_VERSION */
+    uint32_t headerSize;    /* sizeof(capture_header_t), the records start here */
+    uint32_t recordSize;    /* sizeof(capture_record_t) */
+    uint32_t tickHz;        /* Time base frequency of the first configuration frame */
+    uint64_t capacity;      /* Records the file was preallocated for */
+    uint64_t records;       /* Records written */
+    uint64_t bytes;         /* Stream bytes received */
+    uint64_t frames;        /* Frames with a valid CRC */
+    uint64_t crcErrors;     /* Frame candidates with a wrong CRC */
+    uint64_t lostFrames;    /* Frames missing from the sequence numbers */
+    uint64_t skippedBytes;  /* Bytes outside of valid frames */
+    uint8_t reserved[48];
+} capture_header_t;
+
+/* One sample, 16 bytes */
+typedef struct
+{
+    uint64_t time;          /* Time of the first sample of its block, in tickHz ticks */
+    uint16_t result;        /* Decoded result */
+    uint16_t averageCount;  /* Settings the result was converted with */
+    uint8_t outputFormat;
+    uint8_t index;          /* Index of the sample in its block */
+    uint8_t flags;          /* CAPTURE_FLAG_xxx */
+    uint8_t reserved;
+} capture_record_t;
+
+/* Capture settings */
+typedef struct
+{
+    const char *path;       /* Capture file, created or truncated */
+    uint64_t capacity;      /* Records the file is preallocated and mapped for */
+    bool progress;          /* Print the throughput to stderr once per second */
+} capture_options_t;
+
+/* Capture outcome */
+typedef struct
+{
+    stream_decoder_stats_t stream;
+    uint64_t records;       /* Records written */
+    bool full;              /* The capture stopped because the file was full */
+    double seconds;         /* Time from the start to the end of the capture */
+} capture_result_t;
+
+/* A capture file mapped for reading */
+typedef struct
+{
+    const capture_header_t *header;
+    const capture_record_t *records;
+    size_t size;
+} capture_map_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+int capture_run(int fd, const capture_options_t *options, capture_result_t *result);
+void capture_stop(void);
+int capture_open(const char *path, capture_map_t *map);
+void capture_close(capture_map_t *map);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CAPTURE_H */
+/* [] END OF FILE */
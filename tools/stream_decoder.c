@@ -0,0 +1,280 @@
+/******************************************************************************
+* File Name:   stream_decoder.c
+*
+* Description: This file contains the host decoder of the framed sample stream.
+*              The frames are found by their synchronization bytes and checked
+*              with their CRC, so the decoder resynchronizes after corrupted or
+*              truncated frames; lost frames are counted from the sequence numbers.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include <string.h>
+#include "stream_decoder.h"
+
+/*******************************************************************************
+* Function Name: stream_decoder_init
+********************************************************************************
+* Summary:
+*  Initializes a decoder. Sample frames are only returned once a configuration
+*  frame has been received.
+*
+* Parameters:
+*  stream_decoder_t *dec               - Decoder
+*  stream_decoder_callback_t callback  - Called for every decoded sample frame
+*  void *context                       - Passed to the callback
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void stream_decoder_init(stream_decoder_t *dec, stream_decoder_callback_t callback, void *context)
+{
+    memset(dec, 0, sizeof(*dec));
+    dec->callback = callback;
+    dec->context = context;
+}
+
+/*******************************************************************************
+* Function Name: stream_decoder_skip
+********************************************************************************
+* Summary:
+*  Removes bytes from the start of the receive buffer.
+*
+*******************************************************************************/
+static void stream_decoder_skip(stream_decoder_t *dec, uint32_t size)
+{
+    memmove(dec->buf, &dec->buf[size], dec->len - size);
+    dec->len -= size;
+}
+
+/*******************************************************************************
+* Function Name: stream_decoder_frame
+********************************************************************************
+* Summary:
+*  Handles a frame with a valid CRC: checks its sequence number and decodes
+*  its payload.
+*
+*******************************************************************************/
+static void stream_decoder_frame(stream_decoder_t *dec, uint8_t type, uint16_t sequence,
+                                 const uint8_t *payload, uint32_t length)
+{
+    stream_decoder_block_t block;
+    uint64_t delta;
+    uint32_t used;
+    uint32_t size;
+
+    dec->stats.frames++;
+
+    if (dec->haveSequence)
+    {
+        if (sequence == dec->lastSequence)
+        {
+            dec->stats.duplicates++;
+            return;
+        }
+
+        if (stream_frame_sequence_gap(dec->lastSequence, sequence) != 0u)
+        {
+            /* The time of a sample frame is relative to the frame before it */
+            dec->stats.lostFrames += stream_frame_sequence_gap(dec->lastSequence, sequence);
+            dec->timeValid = false;
+        }
+    }
+    dec->haveSequence = true;
+    dec->lastSequence = sequence;
+
+    if (type == STREAM_FRAME_TYPE_CONFIG)
+    {
+        if ((length != STREAM_FRAME_CONFIG_SIZE) ||
+            (stream_frame_unpack_config(payload, length, &dec->config) == 0u))
+        {
+            dec->stats.malformed++;
+            return;
+        }
+
+        dec->stats.configFrames++;
+        dec->haveConfig = true;
+        dec->timeValid = true;
+        dec->time = dec->config.time;
+    }
+    else if (type == STREAM_FRAME_TYPE_SAMPLES)
+    {
+        used = stream_frame_unpack_varint(payload, length, &delta);
+        size = (used != 0u) ? stream_decode_block(&payload[used], length - used, dec->samples) : 0u;
+
+        if ((size == 0u) || ((used + size) != length))
+        {
+            dec->stats.malformed++;
+            return;
+        }
+
+        if (!dec->haveConfig)
+        {
+            dec->stats.unconfigured++;
+            return;
+        }
+
+        dec->time += delta;
+        dec->stats.samples += payload[used];
+
+        block.config = &dec->config;
+        block.time = dec->time;
+        block.timeValid = dec->timeValid;
+        block.sequence = sequence;
+        block.count = payload[used];
+        block.samples = dec->samples;
+
+        if (dec->callback != NULL)
+        {
+            dec->callback(dec->context, &block);
+        }
+    }
+    else
+    {
+        dec->stats.malformed++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: stream_decoder_parse
+********************************************************************************
+* Summary:
+*  Takes the next step on the receive buffer: drops the bytes before the next
+*  synchronization bytes, or handles the frame at the start of the buffer. A
+*  frame candidate with an impossible length or a wrong CRC loses its first
+*  byte only, so a real frame inside it is still found.
+*
+* Return:
+*  bool - True if bytes were consumed, false if more bytes are needed
+*
+*******************************************************************************/
+static bool stream_decoder_parse(stream_decoder_t *dec)
+{
+    const uint8_t *buf = dec->buf;
+    uint32_t length;
+    uint32_t end;
+    uint16_t crc;
+    uint32_t i = 0u;
+
+    while ((i < dec->len) && !((buf[i] == STREAM_FRAME_SYNC0) &&
+                               (((i + 1u) == dec->len) || (buf[i + 1u] == STREAM_FRAME_SYNC1))))
+    {
+        i++;
+    }
+
+    if (i != 0u)
+    {
+        dec->stats.skippedBytes += i;
+        stream_decoder_skip(dec, i);
+        return true;
+    }
+
+    if (dec->len < STREAM_FRAME_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    length = buf[6] | ((uint32_t)buf[7] << 8);
+    if (length > STREAM_DECODER_PAYLOAD_MAX)
+    {
+        dec->stats.skippedBytes++;
+        stream_decoder_skip(dec, 1u);
+        return true;
+    }
+
+    end = STREAM_FRAME_HEADER_SIZE + length;
+    if (dec->len < (end + STREAM_FRAME_TRAILER_SIZE))
+    {
+        return false;
+    }
+
+    crc = (uint16_t)(buf[end] | ((uint16_t)buf[end + 1u] << 8));
+    if (crc != stream_frame_crc16(&buf[2], end - 2u))
+    {
+        dec->stats.crcErrors++;
+        dec->stats.skippedBytes++;
+        stream_decoder_skip(dec, 1u);
+        return true;
+    }
+
+    stream_decoder_frame(dec, buf[2], (uint16_t)(buf[4] | ((uint16_t)buf[5] << 8)),
+                         &buf[STREAM_FRAME_HEADER_SIZE], length);
+    stream_decoder_skip(dec, end + STREAM_FRAME_TRAILER_SIZE);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: stream_decoder_feed
+********************************************************************************
+* Summary:
+*  Decodes the next bytes of the stream, in chunks of any size. The callback
+*  is called for every complete sample frame.
+*
+* Parameters:
+*  stream_decoder_t *dec - Decoder
+*  const uint8_t *data   - Received bytes
+*  uint32_t size         - Number of bytes
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void stream_decoder_feed(stream_decoder_t *dec, const uint8_t *data, uint32_t size)
+{
+    uint32_t n;
+
+    dec->stats.bytes += size;
+
+    while (size != 0u)
+    {
+        n = sizeof(dec->buf) - dec->len;
+        if (n > size)
+        {
+            n = size;
+        }
+
+        memcpy(&dec->buf[dec->len], data, n);
+        dec->len += n;
+        data += n;
+        size -= n;
+
+        while (stream_decoder_parse(dec))
+        {
+        }
+    }
+}
+/* [] END OF FILE */
@@ -0,0 +1,124 @@
+/******************************************************************************
+* File Name:   stream_decoder.h
+*
+* Description: This file contains the declarations of the host decoder of the
+*              framed sample stream. It finds the frames in a byte stream, checks
+*              them, and returns the decoded sample blocks with their time.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef STREAM_DECODER_H
+#define STREAM_DECODER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "stream_codec.h"
+#include "stream_frame.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest payload of a frame sent by the application */
+#define STREAM_DECODER_PAYLOAD_MAX (STREAM_FRAME_VARINT_MAX_SIZE + STREAM_BLOCK_MAX_SIZE)
+
+/* Receive buffer, holds one frame of the largest size */
+#define STREAM_DECODER_BUF_SIZE (STREAM_FRAME_OVERHEAD + STREAM_DECODER_PAYLOAD_MAX)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* One decoded sample frame */
+typedef struct
+{
+    const stream_frame_config_t *config;    /* Settings the samples were taken with */
+    uint64_t time;          /* Time of the first sample, in config->tickHz ticks */
+    bool timeValid;         /* False if a frame was lost since the last configuration frame */
+    uint16_t sequence;      /* Sequence number of the frame */
+    uint32_t count;         /* Number of samples */
+    const uint16_t *samples;
+} stream_decoder_block_t;
+
+/* Called for every decoded sample frame */
+typedef void (*stream_decoder_callback_t)(void *context, const stream_decoder_block_t *block);
+
+/* Receive statistics */
+typedef struct
+{
+    uint64_t bytes;         /* Bytes fed to the decoder */
+    uint64_t frames;        /* Frames with a valid CRC */
+    uint64_t configFrames;  /* Configuration frames */
+    uint64_t samples;       /* Samples decoded */
+    uint64_t skippedBytes;  /* Bytes discarded while searching for the next frame */
+    uint64_t crcErrors;     /* Frame candidates with a wrong CRC */
+    uint64_t malformed;     /* Frames with a valid CRC but an unknown type or an undecodable payload */
+    uint64_t lostFrames;    /* Frames missing from the sequence numbers */
+    uint64_t duplicates;    /* Frames received twice in a row, dropped */
+    uint64_t unconfigured;  /* Sample frames before the first configuration frame, dropped */
+} stream_decoder_stats_t;
+
+/* Decoder state */
+typedef struct
+{
+    uint8_t buf[STREAM_DECODER_BUF_SIZE];
+    uint32_t len;           /* Bytes in buf */
+    bool haveSequence;      /* lastSequence holds the sequence number of a frame */
+    uint16_t lastSequence;
+    bool haveConfig;        /* config holds the settings of a configuration frame */
+    bool timeValid;
+    stream_frame_config_t config;
+    uint64_t time;          /* Time of the last frame */
+    uint16_t samples[STREAM_BLOCK_SAMPLES];
+    stream_decoder_stats_t stats;
+    stream_decoder_callback_t callback;
+    void *context;
+} stream_decoder_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void stream_decoder_init(stream_decoder_t *dec, stream_decoder_callback_t callback, void *context);
+void stream_decoder_feed(stream_decoder_t *dec, const uint8_t *data, uint32_t size);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* STREAM_DECODER_H */
+/* [] END OF FILE */
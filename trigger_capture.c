@@ -0,0 +1,295 @@
+/******************************************************************************
+* File Name:   trigger_capture.c
+*
+* Description: This file contains the trigger capture. The decoded results
+*              are written into a circular buffer while a level, edge or
+*              window trigger is armed; once it fires, a set number of
+*              post-trigger samples is collected and the buffer is frozen,
+*              so that the samples around the event can be exported.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "trigger_capture.h"
+#include "sample_ring.h"
+#include "tcm_placement.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest decoded result, the upper end of the ranges */
+#define SAMPLE_MAX (0xFFFFu)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+const char *TRIGGER_TYPE_STR[TRIGGER_TYPE_NUM] =
+{
+    "Level       ",
+    "Rising edge ",
+    "Falling edge",
+    "Window      "
+};
+
+/*******************************************************************************
+* Function Name: set_range
+********************************************************************************
+* Summary:
+*  Converts the range [low, high] into the low/span form compared by
+*  trigger_capture_add(). An empty range (high < low) contains no sample.
+*
+* Parameters:
+*  uint32_t low   - Lowest sample inside the range
+*  uint32_t high  - Highest sample inside the range
+*  uint32_t *base - Receives the low end
+*  uint32_t *span - Receives the width minus one
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void set_range(uint32_t low, uint32_t high, uint32_t *base, uint32_t *span)
+{
+    if (high < low)
+    {
+        /* No 16-bit sample is above SAMPLE_MAX, every sample is outside */
+        *base = SAMPLE_MAX + 1u;
+        *span = 0u;
+    }
+    else
+    {
+        *base = low;
+        *span = high - low;
+    }
+}
+
+/*******************************************************************************
+* Function Name: trigger_capture_arm
+********************************************************************************
+* Summary:
+*  Discards the previous capture and arms the trigger. The number of
+*  pre-trigger samples is reduced if the window does not fit the buffer.
+*  Called from the main loop; the capture is idle while it is set up, so
+*  trigger_capture_add() may interrupt it.
+*
+* Parameters:
+*  trigger_capture_t *capture      - Capture to be armed
+*  const trigger_config_t *config  - Trigger settings
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void trigger_capture_arm(trigger_capture_t *capture, const trigger_config_t *config)
+{
+    uint32_t level = config->level;
+
+    capture->state = TRIGGER_IDLE;
+    SAMPLE_RING_BARRIER();
+
+    capture->count = 0u;
+    capture->postSamples = (config->postSamples < TRIGGER_CAPTURE_SIZE) ?
+                           config->postSamples : (TRIGGER_CAPTURE_SIZE - 1u);
+    capture->preSamples = TRIGGER_CAPTURE_SIZE - 1u - capture->postSamples;
+    if (config->preSamples < capture->preSamples)
+    {
+        capture->preSamples = config->preSamples;
+    }
+
+    /* The ranges hold the samples that do not end the current state */
+    switch (config->type)
+    {
+        case TRIGGER_RISING_EDGE:
+            set_range(level + 1u, SAMPLE_MAX, &capture->low, &capture->span);
+            set_range(0u, level, &capture->fireLow, &capture->fireSpan);
+            break;
+
+        case TRIGGER_FALLING_EDGE:
+            set_range(0u, level - 1u, &capture->low, &capture->span);
+            set_range(level, SAMPLE_MAX, &capture->fireLow, &capture->fireSpan);
+            break;
+
+        case TRIGGER_WINDOW:
+            set_range(level, config->high, &capture->fireLow, &capture->fireSpan);
+            break;
+
+        case TRIGGER_LEVEL:
+        default:
+            set_range(0u, level, &capture->fireLow, &capture->fireSpan);
+            break;
+    }
+
+    /* The settings must be complete before the interrupt handler sees the new state */
+    SAMPLE_RING_BARRIER();
+    if ((config->type == TRIGGER_RISING_EDGE) || (config->type == TRIGGER_FALLING_EDGE))
+    {
+        capture->state = TRIGGER_ARMING;
+    }
+    else
+    {
+        capture->low = capture->fireLow;
+        capture->span = capture->fireSpan;
+        SAMPLE_RING_BARRIER();
+        capture->state = TRIGGER_ARMED;
+    }
+}
+
+/*******************************************************************************
+* Function Name: trigger_capture_disarm
+********************************************************************************
+* Summary:
+*  Stops the capture, or releases a completed one, so that the following
+*  samples are ignored until the trigger is armed again.
+*
+* Parameters:
+*  trigger_capture_t *capture - Capture to be stopped
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void trigger_capture_disarm(trigger_capture_t *capture)
+{
+    capture->state = TRIGGER_IDLE;
+}
+
+/*******************************************************************************
+* Function Name: trigger_capture_add
+********************************************************************************
+* Summary:
+*  Adds one decoded result to the capture. While waiting for the trigger,
+*  this costs one store and one comparison; the sample is ignored when the
+*  capture is idle or done. Called by the producer of the results only.
+*
+* Parameters:
+*  trigger_capture_t *capture - Capture
+*  uint16_t sample            - Decoded result
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+TCM_CODE void trigger_capture_add(trigger_capture_t *capture, uint16_t sample)
+{
+    int32_t state = capture->state;
+
+    if ((state == TRIGGER_IDLE) || (state == TRIGGER_DONE))
+    {
+        return;
+    }
+
+    capture->buf[capture->count & (TRIGGER_CAPTURE_SIZE - 1u)] = sample;
+    capture->count++;
+
+    if (state == TRIGGER_FIRED)
+    {
+        if (--capture->remaining == 0u)
+        {
+            /* The samples must be complete before the main loop sees the capture done */
+            SAMPLE_RING_BARRIER();
+            capture->state = TRIGGER_DONE;
+        }
+    }
+    else if (((uint32_t)sample - capture->low) > capture->span)
+    {
+        if (state == TRIGGER_ARMING)
+        {
+            /* On the start side of the edge, now wait for the crossing */
+            capture->low = capture->fireLow;
+            capture->span = capture->fireSpan;
+            capture->state = TRIGGER_ARMED;
+        }
+        else if (capture->postSamples == 0u)
+        {
+            capture->triggerCount = capture->count - 1u;
+            SAMPLE_RING_BARRIER();
+            capture->state = TRIGGER_DONE;
+        }
+        else
+        {
+            capture->triggerCount = capture->count - 1u;
+            capture->remaining = capture->postSamples;
+            capture->state = TRIGGER_FIRED;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: trigger_capture_read
+********************************************************************************
+* Summary:
+*  Copies the captured window in time order: up to preSamples samples before
+*  the trigger sample, the trigger sample, and postSamples samples after it.
+*  Fewer pre-trigger samples are returned if the trigger fired before the
+*  buffer held preSamples of them.
+*
+* Parameters:
+*  const trigger_capture_t *capture - Capture in TRIGGER_DONE state
+*  uint16_t *window                 - Receives the window, TRIGGER_CAPTURE_SIZE samples at most
+*  uint32_t *triggerPos             - Receives the index of the trigger sample in window
+*
+* Return:
+*  uint32_t - Number of samples in window, 0 if the capture is not done
+*
+*******************************************************************************/
+uint32_t trigger_capture_read(const trigger_capture_t *capture, uint16_t *window, uint32_t *triggerPos)
+{
+    uint32_t pre;
+    uint32_t start;
+    uint32_t length;
+    uint32_t i;
+
+    if (capture->state != TRIGGER_DONE)
+    {
+        return 0u;
+    }
+
+    /* The samples must not be read before the state that published them */
+    SAMPLE_RING_BARRIER();
+
+    pre = (capture->triggerCount < capture->preSamples) ? capture->triggerCount : capture->preSamples;
+    start = capture->triggerCount - pre;
+    length = pre + 1u + capture->postSamples;
+
+    for (i = 0u; i < length; i++)
+    {
+        window[i] = capture->buf[(start + i) & (TRIGGER_CAPTURE_SIZE - 1u)];
+    }
+
+    *triggerPos = pre;
+
+    return length;
+}
+/* [] END OF FILE */
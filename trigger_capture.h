@@ -0,0 +1,125 @@
+/******************************************************************************
+* File Name:   trigger_capture.h
+*
+* Description: This file contains the declarations of the trigger capture,
+*              which keeps the samples before and after a trigger event on
+*              the decoded AN0 results.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef TRIGGER_CAPTURE_H
+#define TRIGGER_CAPTURE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of samples in the capture buffer, must be a power of two.
+ * preSamples + 1 + postSamples of a trigger must not exceed it */
+#define TRIGGER_CAPTURE_SIZE (512u)
+
+/* Trigger condition on the decoded result */
+enum TriggerType
+{
+    TRIGGER_LEVEL,          /* Result above level */
+    TRIGGER_RISING_EDGE,    /* Result rises from level or below to above level */
+    TRIGGER_FALLING_EDGE,   /* Result falls from level or above to below level */
+    TRIGGER_WINDOW,         /* Result outside [low, high] */
+    TRIGGER_TYPE_NUM
+};
+
+/* Capture state */
+enum TriggerState
+{
+    TRIGGER_IDLE,           /* Not armed, samples are ignored */
+    TRIGGER_ARMING,         /* Edge triggers: waiting for the result to be on the start side of the level */
+    TRIGGER_ARMED,          /* Waiting for the trigger condition */
+    TRIGGER_FIRED,          /* Collecting the post-trigger samples */
+    TRIGGER_DONE            /* Capture complete and frozen */
+};
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Trigger settings */
+typedef struct
+{
+    int32_t type;           /* enum TriggerType */
+    uint16_t level;         /* Level of TRIGGER_LEVEL and the edge triggers, lower limit of TRIGGER_WINDOW */
+    uint16_t high;          /* Upper limit of TRIGGER_WINDOW */
+    uint16_t preSamples;    /* Samples kept before the trigger sample */
+    uint16_t postSamples;   /* Samples collected after the trigger sample */
+} trigger_config_t;
+
+/* Capture state. While waiting, a sample ends the current state when it is
+ * outside [low, low + span]; this takes a single unsigned comparison */
+typedef struct
+{
+    uint16_t buf[TRIGGER_CAPTURE_SIZE];
+    uint32_t count;         /* Samples written since arming */
+    uint32_t triggerCount;  /* Samples written before the trigger sample */
+    uint32_t remaining;     /* Post-trigger samples still to be collected */
+    uint32_t low;
+    uint32_t span;
+    uint32_t fireLow;       /* Range of TRIGGER_ARMED, used after TRIGGER_ARMING */
+    uint32_t fireSpan;
+    uint32_t preSamples;
+    uint32_t postSamples;
+    volatile int32_t state; /* enum TriggerState */
+} trigger_capture_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void trigger_capture_arm(trigger_capture_t *capture, const trigger_config_t *config);
+void trigger_capture_disarm(trigger_capture_t *capture);
+void trigger_capture_add(trigger_capture_t *capture, uint16_t sample);
+uint32_t trigger_capture_read(const trigger_capture_t *capture, uint16_t *window, uint32_t *triggerPos);
+
+extern const char *TRIGGER_TYPE_STR[TRIGGER_TYPE_NUM];
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* TRIGGER_CAPTURE_H */
+/* [] END OF FILE */
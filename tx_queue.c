@@ -0,0 +1,181 @@
+/******************************************************************************
+* File Name:   tx_queue.c
+*
+* Description: This file contains the UART transmit queue. Producers write whole
+*              messages (result lines, stream frames) into the queue without
+*              waiting for the UART; the main loop moves the queued bytes into the
+*              UART transmit FIFO as space becomes available. The queue is lock
+*              free for one producer and one consumer, so the consumer side could
+*              also be served by a separate I/O core.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "tx_queue.h"
+#include "sample_ring.h"
+#include "tcm_placement.h"
+
+/*******************************************************************************
+* Function Name: tx_queue_reset
+********************************************************************************
+* Summary:
+*  Empties the queue. Must not be called while the producer or the consumer
+*  is active.
+*
+* Parameters:
+*  tx_queue_t *queue - Queue to be reset
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void tx_queue_reset(tx_queue_t *queue)
+{
+    queue->head = 0u;
+    queue->tail = 0u;
+}
+
+/*******************************************************************************
+* Function Name: tx_queue_write
+********************************************************************************
+* Summary:
+*  Appends a message to the queue. The message is either queued completely or
+*  not at all, so a full queue never leaves a partial line or frame behind.
+*  Called by the producer only.
+*
+* Parameters:
+*  tx_queue_t *queue - Queue to be written
+*  const void *data  - Message
+*  uint32_t size     - Message size in bytes
+*
+* Return:
+*  bool - false if there is not enough free space and nothing was queued
+*
+*******************************************************************************/
+TCM_CODE bool tx_queue_write(tx_queue_t *queue, const void *data, uint32_t size)
+{
+    const uint8_t *src = (const uint8_t *)data;
+    uint32_t head = queue->head;
+    uint32_t i;
+
+    if ((TX_QUEUE_SIZE - (head - queue->tail)) < size)
+    {
+        return false;
+    }
+
+    /* The consumer must have finished with the space before it is reused */
+    SAMPLE_RING_BARRIER();
+
+    for (i = 0u; i < size; i++)
+    {
+        queue->buf[(head + i) & (TX_QUEUE_SIZE - 1u)] = src[i];
+    }
+
+    /* The message must be visible before the consumer can see the new head */
+    SAMPLE_RING_BARRIER();
+    queue->head = head + size;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: tx_queue_peek
+********************************************************************************
+* Summary:
+*  Returns the oldest queued bytes that are stored contiguously, without
+*  removing them. Called by the consumer only.
+*
+* Parameters:
+*  tx_queue_t *queue    - Queue to be read
+*  const uint8_t **data - Receives the address of the first queued byte
+*
+* Return:
+*  uint32_t - Number of contiguous bytes at *data, 0 if the queue is empty
+*
+*******************************************************************************/
+uint32_t tx_queue_peek(tx_queue_t *queue, const uint8_t **data)
+{
+    uint32_t tail = queue->tail;
+    uint32_t used = queue->head - tail;
+    uint32_t offset = tail & (TX_QUEUE_SIZE - 1u);
+
+    /* The bytes must not be read before the head that published them */
+    SAMPLE_RING_BARRIER();
+
+    *data = &queue->buf[offset];
+
+    return ((offset + used) > TX_QUEUE_SIZE) ? (TX_QUEUE_SIZE - offset) : used;
+}
+
+/*******************************************************************************
+* Function Name: tx_queue_consume
+********************************************************************************
+* Summary:
+*  Removes bytes returned by tx_queue_peek() from the queue. Called by the
+*  consumer only.
+*
+* Parameters:
+*  tx_queue_t *queue - Queue to be read
+*  uint32_t size     - Number of bytes to be removed
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void tx_queue_consume(tx_queue_t *queue, uint32_t size)
+{
+    /* The bytes must have been read before the producer can reuse the space */
+    SAMPLE_RING_BARRIER();
+    queue->tail += size;
+}
+
+/*******************************************************************************
+* Function Name: tx_queue_used
+********************************************************************************
+* Summary:
+*  Returns the number of queued bytes.
+*
+* Parameters:
+*  const tx_queue_t *queue - Queue
+*
+* Return:
+*  uint32_t - Number of queued bytes
+*
+*******************************************************************************/
+TCM_CODE uint32_t tx_queue_used(const tx_queue_t *queue)
+{
+    return queue->head - queue->tail;
+}
+/* [] END OF FILE */
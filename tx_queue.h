@@ -0,0 +1,84 @@
+/******************************************************************************
+* File Name:   tx_queue.h
+*
+* Description: This file contains the interface of the UART transmit queue.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef TX_QUEUE_H
+#define TX_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Size of the queue in bytes, must be a power of two. The PC tools use a larger one */
+#ifndef TX_QUEUE_SIZE
+#define TX_QUEUE_SIZE (2048u)
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Queue state. head is only written by the producer, tail only by the consumer */
+typedef struct
+{
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    uint8_t buf[TX_QUEUE_SIZE];
+} tx_queue_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void tx_queue_reset(tx_queue_t *queue);
+bool tx_queue_write(tx_queue_t *queue, const void *data, uint32_t size);
+uint32_t tx_queue_peek(tx_queue_t *queue, const uint8_t **data);
+void tx_queue_consume(tx_queue_t *queue, uint32_t size);
+uint32_t tx_queue_used(const tx_queue_t *queue);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* TX_QUEUE_H */
+/* [] END OF FILE */
@@ -0,0 +1,138 @@
+/******************************************************************************
+* File Name:   uart_format.c
+*
+* Description: This file contains a small fixed-format integer formatter.
+*              It replaces the newlib printf family on the result output path so
+*              that the result lines are built without the vfprintf overhead.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "uart_format.h"
+#include "tcm_placement.h"
+
+/*******************************************************************************
+* Function Name: uart_format_str
+********************************************************************************
+* Summary:
+*  Copies a NUL terminated string into the output buffer. The terminating NUL
+*  character is not copied.
+*
+* Parameters:
+*  char *buf       - Output buffer
+*  const char *str - String to be copied
+*
+* Return:
+*  uint32_t - Number of characters written
+*
+*******************************************************************************/
+TCM_CODE uint32_t uart_format_str(char *buf, const char *str)
+{
+    uint32_t len = 0u;
+
+    while (str[len] != '\0')
+    {
+        buf[len] = str[len];
+        len++;
+    }
+
+    return len;
+}
+
+/*******************************************************************************
+* Function Name: uart_format_u32
+********************************************************************************
+* Summary:
+*  Writes the decimal representation of an unsigned value, equivalent to
+*  printf("%" PRIu32).
+*
+* Parameters:
+*  char *buf      - Output buffer, at least UART_FORMAT_U32_MAX_LEN characters
+*  uint32_t value - Value to be formatted
+*
+* Return:
+*  uint32_t - Number of characters written
+*
+*******************************************************************************/
+TCM_CODE uint32_t uart_format_u32(char *buf, uint32_t value)
+{
+    char digits[UART_FORMAT_U32_MAX_LEN];
+    uint32_t count = 0u;
+    uint32_t len = 0u;
+
+    /* Produce the digits from least to most significant */
+    do
+    {
+        digits[count++] = (char)('0' + (value % 10u));
+        value /= 10u;
+    } while (value != 0u);
+
+    /* Then write them out in the printing order */
+    while (count != 0u)
+    {
+        buf[len++] = digits[--count];
+    }
+
+    return len;
+}
+
+/*******************************************************************************
+* Function Name: uart_format_i32
+********************************************************************************
+* Summary:
+*  Writes the decimal representation of a signed value, equivalent to
+*  printf("%" PRId32).
+*
+* Parameters:
+*  char *buf     - Output buffer, at least UART_FORMAT_U32_MAX_LEN characters
+*  int32_t value - Value to be formatted
+*
+* Return:
+*  uint32_t - Number of characters written
+*
+*******************************************************************************/
+TCM_CODE uint32_t uart_format_i32(char *buf, int32_t value)
+{
+    if (value < 0)
+    {
+        buf[0] = '-';
+
+        /* Negate in unsigned arithmetic so INT32_MIN is handled too */
+        return 1u + uart_format_u32(&buf[1], 0u - (uint32_t)value);
+    }
+
+    return uart_format_u32(buf, (uint32_t)value);
+}
+/* [] END OF FILE */